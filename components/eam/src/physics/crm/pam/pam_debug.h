@@ -26,11 +26,13 @@ inline void pam_debug_init( pam::PamCoupler &coupler ) {
   auto nz   = coupler.get_option<int>("crm_nz");
   auto nens = coupler.get_option<int>("ncrms");
   //------------------------------------------------------------------------------------------------
-  dm_device.register_and_allocate<real>("debug_save_temp", "saved temp for debug", {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("debug_save_rhod", "saved rhod for debug", {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("debug_save_rhov", "saved rhov for debug", {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("debug_save_rhoc", "saved rhoc for debug", {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("debug_save_rhoi", "saved rhoi for debug", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+  if (!dm_device.entry_exists("debug_save_temp")) {
+    dm_device.register_and_allocate<real>("debug_save_temp", "saved temp for debug", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+    dm_device.register_and_allocate<real>("debug_save_rhod", "saved rhod for debug", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+    dm_device.register_and_allocate<real>("debug_save_rhov", "saved rhov for debug", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+    dm_device.register_and_allocate<real>("debug_save_rhoc", "saved rhoc for debug", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+    dm_device.register_and_allocate<real>("debug_save_rhoi", "saved rhoi for debug", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+  }
   auto debug_save_temp = dm_device.get<real,4>("debug_save_temp");
   auto debug_save_rhod = dm_device.get<real,4>("debug_save_rhod");
   auto debug_save_rhov = dm_device.get<real,4>("debug_save_rhov");
@@ -20,6 +20,8 @@
 
 #include "pam_hyperdiffusion.h"
 
+#include <memory>
+
 // Needed for p3_init
 #include "p3_functions.hpp"
 #include "p3_f90.hpp"
@@ -27,6 +29,54 @@
 #include "pam_debug.h"
 bool constexpr enable_check_state = false;
 
+// With MMF_PAM_PERSISTENT the coupler state and the PAM sub-models are created on the first
+// call and kept alive across GCM physics calls, so each call only needs to copy the GCM input
+// and saved CRM state in and out. Otherwise everything is created and destroyed on every call.
+#ifdef MMF_PAM_PERSISTENT
+bool constexpr use_persistent_state = true;
+#else
+bool constexpr use_persistent_state = false;
+#endif
+
+// PAM sub-models - these only live beyond a single call when use_persistent_state is true
+struct PamModels {
+  Microphysics micro;
+  SGS          sgs;
+  Dycore       dycore;
+  Radiation    rad;
+  int          nens;
+};
+std::unique_ptr<PamModels> pam_models;
+
+// Allocate the coupler state and initialize the sub-models
+void pam_init_models( pam::PamCoupler &coupler, bool verbose ) {
+  auto nens   = coupler.get_option<int>("ncrms");
+  auto crm_nz = coupler.get_option<int>("crm_nz");
+  auto crm_nx = coupler.get_option<int>("crm_nx");
+  auto crm_ny = coupler.get_option<int>("crm_ny");
+  coupler.allocate_coupler_state( crm_nz , crm_ny , crm_nx , nens );
+
+  // set up the grid - this needs to happen before initializing coupler objects
+  pam_state_set_grid(coupler);
+
+  pam_models.reset( new PamModels() );
+  pam_models->nens = nens;
+  pam_models->micro .init(coupler);
+  pam_models->sgs   .init(coupler);
+  pam_models->dycore.init(coupler,verbose); // pass is_first_step to control verbosity in PAM-C
+  pam_models->rad   .init(coupler);
+}
+
+// Finalize the sub-models and release the coupler state
+void pam_finalize_models( pam::PamCoupler &coupler ) {
+  pam_models->micro .finalize(coupler);
+  pam_models->sgs   .finalize(coupler);
+  pam_models->dycore.finalize(coupler);
+  pam_models->rad   .finalize(coupler);
+  pam_models.reset();
+  pam_interface::finalize();
+}
+
 extern "C" void pam_driver() {
   //------------------------------------------------------------------------------------------------
   using yakl::intrinsics::abs;
@@ -62,27 +112,30 @@ extern "C" void pam_driver() {
   coupler.set_option<real>("sponge_time_scale",60);        // minimum damping timescale at top
   coupler.set_option<bool>("crm_acceleration_ceaseflag",false);
   //------------------------------------------------------------------------------------------------
-  // Allocate the coupler state and retrieve host/device data managers
-  coupler.allocate_coupler_state( crm_nz , crm_ny , crm_nx , nens );
-
-  // set up the grid - this needs to happen before initializing coupler objects
-  pam_state_set_grid(coupler);
+  // Allocate the coupler state and create objects for dycor, microphysics, and turbulence
+  bool verbose = is_first_step || is_restart;
+  if (!pam_models) {
+    pam_init_models(coupler,verbose);
+  } else {
+    if (pam_models->nens != nens) {
+      if (coupler.get_option<bool>("am_i_root")) {
+        printf("pam_driver: Error: ncrms changed from %d to %d with persistent PAM state\n",
+               pam_models->nens, nens);
+      }
+      exit(-1);
+    }
+    // the GCM interface heights change every call, so the grid still needs to be updated
+    pam_state_set_grid(coupler);
+  }
+  auto &micro  = pam_models->micro;
+  auto &sgs    = pam_models->sgs;
+  auto &dycore = pam_models->dycore;
+  auto &rad    = pam_models->rad;
   //------------------------------------------------------------------------------------------------
   // get seperate data manager objects for host and device
   auto &dm_device = coupler.get_data_manager_device_readwrite();
   auto &dm_host   = coupler.get_data_manager_host_readwrite();
   //------------------------------------------------------------------------------------------------
-  // Create objects for dycor, microphysics, and turbulence and initialize them
-  bool verbose = is_first_step || is_restart;
-  Microphysics micro;
-  SGS          sgs;
-  Dycore       dycore;
-  Radiation    rad;
-  micro .init(coupler);
-  sgs   .init(coupler);
-  dycore.init(coupler,verbose); // pass is_first_step to control verbosity in PAM-C
-  rad   .init(coupler);
-  //------------------------------------------------------------------------------------------------
   // update coupler GCM state with input GCM state
   pam_state_update_gcm_state(coupler);
 
@@ -251,16 +304,24 @@ extern "C" void pam_driver() {
   }
 
   //------------------------------------------------------------------------------------------------
-  // Finalize and clean up
-  micro .finalize(coupler);
-  sgs   .finalize(coupler);
-  dycore.finalize(coupler);
-  rad   .finalize(coupler);
-  pam_interface::finalize();
+  // Finalize and clean up (with persistent state, see pam_release_host_mirrors)
+  if (!use_persistent_state) {
+    pam_finalize_models(coupler);
+  }
   //------------------------------------------------------------------------------------------------
 }
 
+// With persistent state, the host data manager still holds the mirrors of the GCM arrays of the
+// previous call, which crm_physics has deallocated. Drop them before the new ones are mirrored.
+// Otherwise the whole coupler is finalized at the end of each call, so there is nothing to do.
+extern "C" void pam_release_host_mirrors() {
+  if (pam_models) {
+    pam_interface::get_coupler().get_data_manager_host_readwrite().finalize();
+  }
+}
+
 extern "C" void pam_finalize() {
+  if (pam_models) { pam_finalize_models(pam_interface::get_coupler()); }
   #if defined(P3_CXX) || defined(SHOC_CXX)
   pam::deallocate_scream_cxx_globals();
   // if using SL tracer advection then COMPOSE will call Kokkos::finalize(), otherwise, call it here
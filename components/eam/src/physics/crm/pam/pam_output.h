@@ -28,17 +28,19 @@ inline void pam_output_compute_means( pam::PamCoupler &coupler ) {
   auto crm_bm    = dm_device.get<real,4>("ice_rime_vol");
   //------------------------------------------------------------------------------------------------
   // Create arrays to hold the current column average of the CRM internal columns
-  dm_device.register_and_allocate<real>("qv_mean", "domain mean qv", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("qc_mean", "domain mean qc", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("qi_mean", "domain mean qi", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("qr_mean", "domain mean qr", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("nc_mean", "domain mean nc", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("ni_mean", "domain mean ni", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("nr_mean", "domain mean nr", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("qm_mean", "domain mean qm", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("bm_mean", "domain mean bm", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("rho_d_mean", "domain mean rho_d", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("rho_v_mean", "domain mean rho_v", {gcm_nlev,nens},{"gcm_lev","nens"});
+  if (!dm_device.entry_exists("qv_mean")) {
+    dm_device.register_and_allocate<real>("qv_mean", "domain mean qv", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("qc_mean", "domain mean qc", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("qi_mean", "domain mean qi", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("qr_mean", "domain mean qr", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("nc_mean", "domain mean nc", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("ni_mean", "domain mean ni", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("nr_mean", "domain mean nr", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("qm_mean", "domain mean qm", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("bm_mean", "domain mean bm", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("rho_d_mean", "domain mean rho_d", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("rho_v_mean", "domain mean rho_v", {gcm_nlev,nens},{"gcm_lev","nens"});
+  }
   auto qv_mean = dm_device.get<real,2>("qv_mean");
   auto qc_mean = dm_device.get<real,2>("qc_mean");
   auto qi_mean = dm_device.get<real,2>("qi_mean");
@@ -56,14 +56,16 @@ inline void pam_radiation_init( pam::PamCoupler &coupler ) {
   coupler.set_option<real>("rad_ny_fac",rad_ny_fac);
   //------------------------------------------------------------------------------------------------
   // register aggregted quantities
-  dm.register_and_allocate<real>("rad_aggregation_cnt","number of aggregated samples",{nens},{"nens"});
-  dm.register_and_allocate<real>("rad_temperature","rad column mean temperature",      {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_qv"         ,"rad column mean water vapor",      {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_qc"         ,"rad column mean cloud liq amount", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_qi"         ,"rad column mean cloud ice amount", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_nc"         ,"rad column mean cloud liq number", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_ni"         ,"rad column mean cloud ice number", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_cld"        ,"rad column mean cloud fraction",   {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+  if (!dm.entry_exists("rad_aggregation_cnt")) {
+    dm.register_and_allocate<real>("rad_aggregation_cnt","number of aggregated samples",{nens},{"nens"});
+    dm.register_and_allocate<real>("rad_temperature","rad column mean temperature",      {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+    dm.register_and_allocate<real>("rad_qv"         ,"rad column mean water vapor",      {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+    dm.register_and_allocate<real>("rad_qc"         ,"rad column mean cloud liq amount", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+    dm.register_and_allocate<real>("rad_qi"         ,"rad column mean cloud ice amount", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+    dm.register_and_allocate<real>("rad_nc"         ,"rad column mean cloud liq number", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+    dm.register_and_allocate<real>("rad_ni"         ,"rad column mean cloud ice number", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+    dm.register_and_allocate<real>("rad_cld"        ,"rad column mean cloud fraction",   {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+  }
   //------------------------------------------------------------------------------------------------
   // initialize aggregted quantities
   auto rad_aggregation_cnt = dm.get<real,1>("rad_aggregation_cnt");
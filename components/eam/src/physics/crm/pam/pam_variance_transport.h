@@ -12,15 +12,17 @@ inline void pam_variance_transport_init( pam::PamCoupler &coupler ) {
   auto ny           = coupler.get_option<int>("crm_ny");
   auto nx           = coupler.get_option<int>("crm_nx");
   //------------------------------------------------------------------------------------------------
-  dm_device.register_and_allocate<real>("vt_temp",      "temperature variance", {nz,nens}, {"z","nens"} );
-  dm_device.register_and_allocate<real>("vt_rhov",      "water vapor variance", {nz,nens}, {"z","nens"} );
-  dm_device.register_and_allocate<real>("vt_uvel",      "u momentum variance",  {nz,nens}, {"z","nens"} );
-  dm_device.register_and_allocate<real>("vt_temp_pert", "temperature perturbation from horz mean", {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("vt_rhov_pert", "water vapor perturbation from horz mean", {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("vt_uvel_pert", "u momentum perturbation from horz mean",  {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("vt_temp_forcing_tend", "temperature variance forcing tendency", {nz,nens}, {"z","nens"} );
-  dm_device.register_and_allocate<real>("vt_rhov_forcing_tend", "water vapor variance forcing tendency", {nz,nens}, {"z","nens"} );
-  dm_device.register_and_allocate<real>("vt_uvel_forcing_tend", "u momentum variance forcing tendency",  {nz,nens}, {"z","nens"} );
+  if (!dm_device.entry_exists("vt_temp")) {
+    dm_device.register_and_allocate<real>("vt_temp",      "temperature variance", {nz,nens}, {"z","nens"} );
+    dm_device.register_and_allocate<real>("vt_rhov",      "water vapor variance", {nz,nens}, {"z","nens"} );
+    dm_device.register_and_allocate<real>("vt_uvel",      "u momentum variance",  {nz,nens}, {"z","nens"} );
+    dm_device.register_and_allocate<real>("vt_temp_pert", "temperature perturbation from horz mean", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+    dm_device.register_and_allocate<real>("vt_rhov_pert", "water vapor perturbation from horz mean", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+    dm_device.register_and_allocate<real>("vt_uvel_pert", "u momentum perturbation from horz mean",  {nz,ny,nx,nens}, {"z","y","x","nens"} );
+    dm_device.register_and_allocate<real>("vt_temp_forcing_tend", "temperature variance forcing tendency", {nz,nens}, {"z","nens"} );
+    dm_device.register_and_allocate<real>("vt_rhov_forcing_tend", "water vapor variance forcing tendency", {nz,nens}, {"z","nens"} );
+    dm_device.register_and_allocate<real>("vt_uvel_forcing_tend", "u momentum variance forcing tendency",  {nz,nens}, {"z","nens"} );
+  }
   //------------------------------------------------------------------------------------------------
 }
 
@@ -218,9 +220,11 @@ inline void pam_variance_transport_compute_feedback( pam::PamCoupler &coupler )
   auto gcm_vt_rhov  = dm_host.get<real const,2>("input_vt_q").createDeviceCopy();
   auto gcm_vt_uvel  = dm_host.get<real const,2>("input_vt_u").createDeviceCopy();
   //------------------------------------------------------------------------------------------------
-  dm_device.register_and_allocate<real>("vt_temp_feedback_tend", "feedback tend of temp variance", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("vt_rhov_feedback_tend", "feedback tend of rhov variance", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("vt_uvel_feedback_tend", "feedback tend of uvel variance", {gcm_nlev,nens},{"gcm_lev","nens"});
+  if (!dm_device.entry_exists("vt_temp_feedback_tend")) {
+    dm_device.register_and_allocate<real>("vt_temp_feedback_tend", "feedback tend of temp variance", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("vt_rhov_feedback_tend", "feedback tend of rhov variance", {gcm_nlev,nens},{"gcm_lev","nens"});
+    dm_device.register_and_allocate<real>("vt_uvel_feedback_tend", "feedback tend of uvel variance", {gcm_nlev,nens},{"gcm_lev","nens"});
+  }
   auto vt_temp_feedback_tend = dm_device.get<real,2>("vt_temp_feedback_tend"  );
   auto vt_rhov_feedback_tend = dm_device.get<real,2>("vt_rhov_feedback_tend"  );
   auto vt_uvel_feedback_tend = dm_device.get<real,2>("vt_uvel_feedback_tend"  );
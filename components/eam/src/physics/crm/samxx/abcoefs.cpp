@@ -2,24 +2,35 @@
 #include "abcoefs.h"
 
 // Compute the coefficients for the Adams-Bashforth scheme
+// Each CRM has its own time step history in dt3, so the coefficients are per CRM
 void abcoefs() {
-  if (nstep >= 3) {
-    realHost1d dt3Host("dt3Host",3);
-    dt3.deep_copy_to(dt3Host);
-    yakl::fence();
-    real alpha = dt3Host(nb-1) / dt3Host(na-1);
-    real beta  = dt3Host(nc-1) / dt3Host(na-1);
-    ct = (2.+3.* alpha) / (6.* (alpha + beta) * beta);
-    bt = -(1.+2.*(alpha + beta) * ct)/(2. * alpha);
-    at = 1. - bt - ct;
-  } else if (nstep >= 2) {
-    at = 3./2.;
-    bt = -1./2.;
-    ct = 0.;
-  } else {
-    at = 1.;
-    bt = 0.;
-    ct = 0.;
-  }
+  YAKL_SCOPE( dt3   , ::dt3 );
+  YAKL_SCOPE( at    , ::at );
+  YAKL_SCOPE( bt    , ::bt );
+  YAKL_SCOPE( ct    , ::ct );
+  YAKL_SCOPE( na    , ::na );
+  YAKL_SCOPE( nb    , ::nb );
+  YAKL_SCOPE( nc    , ::nc );
+  YAKL_SCOPE( nstep , ::nstep );
+  YAKL_SCOPE( ncrms , ::ncrms );
+
+  // for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    if (nstep >= 3) {
+      real alpha = dt3(nb-1,icrm) / dt3(na-1,icrm);
+      real beta  = dt3(nc-1,icrm) / dt3(na-1,icrm);
+      ct(icrm) = (2.+3.* alpha) / (6.* (alpha + beta) * beta);
+      bt(icrm) = -(1.+2.*(alpha + beta) * ct(icrm))/(2. * alpha);
+      at(icrm) = 1. - bt(icrm) - ct(icrm);
+    } else if (nstep >= 2) {
+      at(icrm) = 3./2.;
+      bt(icrm) = -1./2.;
+      ct(icrm) = 0.;
+    } else {
+      at(icrm) = 1.;
+      bt(icrm) = 0.;
+      ct(icrm) = 0.;
+    }
+  });
 }
 
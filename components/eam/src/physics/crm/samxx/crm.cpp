@@ -53,6 +53,7 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_
   dt_glob = dt_gl;
   pcols = pcols_in;
   ncrms = ncrms_in;
+  ncrms_all = ncrms_in;
   igstep = igstep_in;
   use_VT = use_VT_in;
   use_ESMT = use_ESMT_in;
@@ -21,8 +21,8 @@ void crmsurface(real1d &bflx) {
 
   //  for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
-    uhl(icrm) = uhl(icrm) + dtn*utend(0,icrm);
-    vhl(icrm) = vhl(icrm) + dtn*vtend(0,icrm);
+    uhl(icrm) = uhl(icrm) + dtn(icrm)*utend(0,icrm);
+    vhl(icrm) = vhl(icrm) + dtn(icrm)*vtend(0,icrm);
     taux0(icrm) = 0.0;
     tauy0(icrm) = 0.0;
   });
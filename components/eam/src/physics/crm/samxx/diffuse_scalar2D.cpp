@@ -83,7 +83,7 @@ void diffuse_scalar2D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
     parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
       int kb=k-1;
       real rhoi = 1.0/(adz(k,icrm)*rho(k,icrm));
-      dfdt(k,j,i,icrm)=dtn*(dfdt(k,j,i,icrm)-(flx(k+offz_flx,j,i+offx_flx,icrm)-flx(kb+offz_flx,j,i+offx_flx,icrm))*rhoi);
+      dfdt(k,j,i,icrm)=dtn(icrm)*(dfdt(k,j,i,icrm)-(flx(k+offz_flx,j,i+offx_flx,icrm)-flx(kb+offz_flx,j,i+offx_flx,icrm))*rhoi);
       field(k,j,i+offx_s,icrm)=field(k,j,i+offx_s,icrm) + dfdt(k,j,i,icrm);
     });
   }
@@ -173,7 +173,7 @@ void diffuse_scalar2D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt
     parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
       int kb=k-1;
       real rhoi = 1.0/(adz(k,icrm)*rho(k,icrm));
-      dfdt(k,j,i,icrm)=dtn*(dfdt(k,j,i,icrm)-(flx(k+offz_flx,j,i+offx_flx,icrm)-flx(kb+offz_flx,j,i+offx_flx,icrm))*rhoi);
+      dfdt(k,j,i,icrm)=dtn(icrm)*(dfdt(k,j,i,icrm)-(flx(k+offz_flx,j,i+offx_flx,icrm)-flx(kb+offz_flx,j,i+offx_flx,icrm))*rhoi);
       field(ind_field,k,j,i+offx_s,icrm)=field(ind_field,k,j,i+offx_s,icrm) + dfdt(k,j,i,icrm);
     });
   }
@@ -263,7 +263,7 @@ void diffuse_scalar2D(real5d &field, int ind_field, real4d &fluxb, int ind_fluxb
     parallel_for( SimpleBounds<3>(nzm,nx,ncrms) , YAKL_LAMBDA (int k, int i, int icrm) {
       int kb=k-1;
       real rhoi = 1.0/(adz(k,icrm)*rho(k,icrm));
-      dfdt(k,j,i,icrm)=dtn*(dfdt(k,j,i,icrm)-(flx(k+offz_flx,j,i+offx_flx,icrm)-flx(kb+offz_flx,j,i+offx_flx,icrm))*rhoi);
+      dfdt(k,j,i,icrm)=dtn(icrm)*(dfdt(k,j,i,icrm)-(flx(k+offz_flx,j,i+offx_flx,icrm)-flx(kb+offz_flx,j,i+offx_flx,icrm))*rhoi);
       field(ind_field,k,j,i+offx_s,icrm)=field(ind_field,k,j,i+offx_s,icrm) + dfdt(k,j,i,icrm);
     });
   }
@@ -109,7 +109,7 @@ void diffuse_scalar3D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
     parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int kb=k-1;
       real rhoi = 1.0/(adz(k,icrm)*rho(k,icrm));
-      dfdt(k,j,i,icrm)=dtn*(dfdt(k,j,i,icrm)-(flx_z(k+offz_flx,j+offy_flx,i+offx_flx,icrm)-
+      dfdt(k,j,i,icrm)=dtn(icrm)*(dfdt(k,j,i,icrm)-(flx_z(k+offz_flx,j+offy_flx,i+offx_flx,icrm)-
                                               flx_z(kb+offz_flx,j+offy_flx,i+offx_flx,icrm))*rhoi);
       field(k,j+offy_s,i+offx_s,icrm)=field(k,j+offy_s,i+offx_s,icrm)+dfdt(k,j,i,icrm);
     });
@@ -226,7 +226,7 @@ void diffuse_scalar3D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt
     parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int kb=k-1;
       real rhoi = 1.0/(adz(k,icrm)*rho(k,icrm));
-      dfdt(k,j,i,icrm)=dtn*(dfdt(k,j,i,icrm)-(flx_z(k+offz_flx,j+offy_flx,i+offx_flx,icrm)-
+      dfdt(k,j,i,icrm)=dtn(icrm)*(dfdt(k,j,i,icrm)-(flx_z(k+offz_flx,j+offy_flx,i+offx_flx,icrm)-
                                               flx_z(kb+offz_flx,j+offy_flx,i+offx_flx,icrm))*rhoi);
       field(ind_field,k,j+offy_s,i+offx_s,icrm)=field(ind_field,k,j+offy_s,i+offx_s,icrm)+dfdt(k,j,i,icrm);
     });
@@ -344,7 +344,7 @@ void diffuse_scalar3D(real5d &field, int ind_field, real4d &fluxb, int ind_fluxb
     parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
       int kb=k-1;
       real rhoi = 1.0/(adz(k,icrm)*rho(k,icrm));
-      dfdt(k,j,i,icrm)=dtn*(dfdt(k,j,i,icrm)-(flx_z(k+offz_flx,j+offy_flx,i+offx_flx,icrm)-
+      dfdt(k,j,i,icrm)=dtn(icrm)*(dfdt(k,j,i,icrm)-(flx_z(k+offz_flx,j+offy_flx,i+offx_flx,icrm)-
                                               flx_z(kb+offz_flx,j+offy_flx,i+offx_flx,icrm))*rhoi);
       field(ind_field,k,j+offy_s,i+offx_s,icrm)=field(ind_field,k,j+offy_s,i+offx_s,icrm)+dfdt(k,j,i,icrm);
     });
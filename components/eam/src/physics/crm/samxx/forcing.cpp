@@ -30,9 +30,9 @@ void forcing() {
   //     for (int i=0; i<nx; i++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
   parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    t(k, j+offy_s, i+offx_s, icrm) = t(k, j+offy_s, i+offx_s, icrm) + ttend(k,icrm) * dtn;
+    t(k, j+offy_s, i+offx_s, icrm) = t(k, j+offy_s, i+offx_s, icrm) + ttend(k,icrm) * dtn(icrm);
     micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) = 
-          micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) + qtend(k,icrm) * dtn;
+          micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) + qtend(k,icrm) * dtn(icrm);
 
     if (micro_field(index_water_vapor, k, j+offy_s, i+offx_s, icrm) < 0.0) {
       yakl::atomicAdd(nneg(k,icrm),1);
@@ -12,6 +12,7 @@ void kurant () {
   YAKL_SCOPE( dz    , ::dz );
   YAKL_SCOPE( adzw  , ::adzw );
   YAKL_SCOPE( ncrms , ::ncrms );
+  YAKL_SCOPE( ncycle_crm , ::ncycle_crm );
 
   int constexpr max_ncycle = 4;
   real cfl;
@@ -64,12 +65,27 @@ void kurant () {
     exit(-1);
   }
 
-  kurant_sgs(cfl);
+  kurant_sgs(tmpMax);
+
+  cfl_loc = pmax(tmpMax.data());
+  cfl = max(cfl,cfl_loc);
 
   ncycle = max(ncycle,max(1,static_cast<int>(ceil(cfl/0.7))));
 
+  // Each CRM only takes the number of subcycles its own cfl requires,
+  // ncycle is the largest of them
+  // for (int icrm=0; icrm<ncrms; icrm++) {
+  parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+    real cfl_crm = 0.0;
+    for (int k=0; k<nzm; k++) {
+      cfl_crm = max(cfl_crm,tmpMax(k,icrm));
+    }
+    ncycle_crm(icrm) = max(1,static_cast<int>(ceil(cfl_crm/0.7)));
+  });
+
 #ifdef MMF_FIXED_SUBCYCLE
   ncycle = max_ncycle;
+  yakl::memset(ncycle_crm,max_ncycle);
 #endif
 
   if(ncycle > max_ncycle) {
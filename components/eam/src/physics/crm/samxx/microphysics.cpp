@@ -45,7 +45,7 @@ void precip_fall(int hydro_type, real4d &omega) {
     rhofac(k,icrm) = sqrt(1.29/rho(k,icrm));
     irhoadz(k,icrm) = 1.0/(rho(k,icrm)*adz(k,icrm));
     int kb = max(0,k-1);
-    real wmax       = dz(icrm)*adz(kb,icrm)/dtn;   // Velocity equivalent to a cfl of 1.0.
+    real wmax       = dz(icrm)*adz(kb,icrm)/dtn(icrm);   // Velocity equivalent to a cfl of 1.0.
     iwmax(k,icrm)   = 1.0/wmax;
   });
 
@@ -77,7 +77,7 @@ void precip_fall(int hydro_type, real4d &omega) {
     wp(k,j,i,icrm)=rhofac(k,icrm)*tmp;
     tmp = wp(k,j,i,icrm)*iwmax(k,icrm);
     prec_cfl_arr(k,j,i,icrm) = tmp;
-    wp(k,j,i,icrm) = -wp(k,j,i,icrm)*rhow(k,icrm)*dtn/dz(icrm);
+    wp(k,j,i,icrm) = -wp(k,j,i,icrm)*rhow(k,icrm)*dtn(icrm)/dz(icrm);
     if (k == 0) {
       fz(nz-1,j,i,icrm)=0.0;
       www(nz-1,j,i,icrm)=0.0;
@@ -234,7 +234,7 @@ void precip_fall(int hydro_type, real4d &omega) {
                                tabs(k,j,i,icrm), a_pr, a_gr);
         wp(k,j,i,icrm) = rhofac(k,icrm)*tmp;
         // Decrease precipitation velocity by factor of nprec
-        wp(k,j,i,icrm) = -wp(k,j,i,icrm)*rhow(k,icrm)*dtn/dz(icrm)/nprec;
+        wp(k,j,i,icrm) = -wp(k,j,i,icrm)*rhow(k,icrm)*dtn(icrm)/dz(icrm)/nprec;
         // Note: Don't bother checking CFL condition at each
         // substep since it's unlikely that the CFL will
         // increase very much between substeps when using
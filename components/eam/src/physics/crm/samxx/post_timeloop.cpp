@@ -512,7 +512,7 @@ void post_timeloop() {
     }
 
     real tmp1 = dz(icrm)/rhow(k,icrm);
-    real tmp2 = tmp1/dtn; // dtn is calculated inside of the icyc loop. It seems wrong to use it here ???? +++mhwang
+    real tmp2 = tmp1/dtn(icrm); // dtn is calculated inside of the icyc loop. It seems wrong to use it here ???? +++mhwang
 
     for (int l=0; l<nmicro_fields; l++) {                                           
       mkwsb(l,k,icrm) = mkwsb(l,k,icrm) * tmp1*rhow(k,icrm) * factor_xy/((real) nstop);     //kg/m3/s --> kg/m2/s
@@ -92,9 +92,9 @@ void precip_proc(real5d &q, int ind_q, real5d &qp, int ind_qp) {
           accrcg = accrgc(k,icrm) * tmp;
           accrig = accrgi(k,icrm) * tmp;
         }
-        qcc = (qcc+dtn*autor*qcw0)/(1.0+dtn*(accrr+accrcs+accrcg+autor));
-        qii = (qii+dtn*autos*qci0)/(1.0+dtn*(accris+accrig+autos));
-        dq = dtn *(accrr*qcc + autor*(qcc-qcw0)+(accris+accrig)*qii + (accrcs+accrcg)*qcc + autos*(qii-qci0));
+        qcc = (qcc+dtn(icrm)*autor*qcw0)/(1.0+dtn(icrm)*(accrr+accrcs+accrcg+autor));
+        qii = (qii+dtn(icrm)*autos*qci0)/(1.0+dtn(icrm)*(accris+accrig+autos));
+        dq = dtn(icrm) *(accrr*qcc + autor*(qcc-qcw0)+(accris+accrig)*qii + (accrcs+accrcg)*qcc + autos*(qii-qci0));
         dq = min(dq,qn(k,j,i,icrm));
         qp(ind_qp,k,j+offy_s,i+offx_s,icrm) = qp(ind_qp,k,j+offy_s,i+offx_s,icrm) + dq;
         q(ind_q,k,j+offy_s,i+offx_s,icrm) = q(ind_q,k,j+offy_s,i+offx_s,icrm) - dq;
@@ -125,7 +125,7 @@ void precip_proc(real5d &q, int ind_q, real5d &qp, int ind_qp) {
           qgg = qp(ind_qp,k,j+offy_s,i+offx_s,icrm) * (1.0-omp)*omg;
           dq = dq + evapg1(k,icrm)*sqrt(qgg) + evapg2(k,icrm)*pow(qgg,powg2);
         }
-        dq = dq * dtn * (q(ind_q,k,j+offy_s,i+offx_s,icrm) /qsatt-1.0);
+        dq = dq * dtn(icrm) * (q(ind_q,k,j+offy_s,i+offx_s,icrm) /qsatt-1.0);
         dq = max(-0.5*qp(ind_qp,k,j+offy_s,i+offx_s,icrm),dq);
         qp(ind_qp,k,j+offy_s,i+offx_s,icrm) = qp(ind_qp,k,j+offy_s,i+offx_s,icrm) + dq;
         q(ind_q,k,j+offy_s,i+offx_s,icrm) = q(ind_q,k,j+offy_s,i+offx_s,icrm) - dq;
@@ -45,8 +45,6 @@ void press_rhs() {
 
   real rdx=1.0/dx;
   real rdy=1.0/dy;
-  real btat=bt/at;
-  real ctat=ct/at;
 
   if (RUN3D) {
 
@@ -61,7 +59,9 @@ void press_rhs() {
       real rdn = rhow(k,icrm)/rho(k,icrm)*rdz;
       int jc=j+1;
       int ic=i+1;
-      real dta=1.0/dt3(na-1)/at;
+      real dta=1.0/dt3(na-1,icrm)/at(icrm);
+      real btat=bt(icrm)/at(icrm);
+      real ctat=ct(icrm)/at(icrm);
       p(k,j+offy_p,i+offx_p,icrm)=( rdx*(u(k,j+offy_u,ic+offx_u,icrm)-u(k,j+offy_u,i+offx_u,icrm))+
                                   rdy*(v(k,jc+offy_v,i+offx_v,icrm)-v(k,j+offy_v,i+offx_v,icrm))+
                                   (w(kc,j+offy_w,i+offx_w,icrm)*rup-w(k,j+offy_w,i+offx_w,icrm)*rdn) )*dta +
@@ -89,7 +89,9 @@ void press_rhs() {
       real rup = rhow(kc,icrm)/rho(k,icrm)*rdz;
       real rdn = rhow(k,icrm)/rho(k,icrm)*rdz;
       int ic=i+1;
-      real dta=1.0/dt3(na-1)/at;
+      real dta=1.0/dt3(na-1,icrm)/at(icrm);
+      real btat=bt(icrm)/at(icrm);
+      real ctat=ct(icrm)/at(icrm);
 
       p(k,j+offy_p,i+offx_p,icrm)=(rdx*(u(k,j+offy_u,ic+offx_u,icrm)-u(k,j+offy_u,i+offx_u,icrm))+
                                   (w(kc,j+offy_w,i+offx_w,icrm)*rup-w(k,j+offy_w,i+offx_w,icrm)*rdn) )*dta +
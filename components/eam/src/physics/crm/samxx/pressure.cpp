@@ -20,7 +20,10 @@ void pressure() {
   int constexpr n3j=3*ny_gl/2+1;
   int constexpr fftySize = ny > 4 ? ny : 4;
 
-  real4d f ("f" , nzslab, ny2, nx2, ncrms);
+  // The FFT plans are set up for all CRMs, so size f for all of them
+  // even when some CRMs have finished subcycling (ncrms < ncrms_all)
+  real4d f ("f" , nzslab, ny2, nx2, ncrms_all);
+  if (ncrms < ncrms_all) { yakl::memset(f,0.); }
   real4d ff("ff", nzm,ny2,nx+1,ncrms);
   real2d a ("a" , nzm, ncrms);
   real2d c ("c" , nzm, ncrms);
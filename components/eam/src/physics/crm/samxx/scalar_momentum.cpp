@@ -41,8 +41,13 @@ void scalar_momentum_pgf( real4d& scalar_wind, real4d& tend ) {
    real4d w_i("w_i",nzm,ny,nx,ncrms);
    real4d pgf("pgf",nzm,ny,nx,ncrms);
    int nx2 = nx+2;
-   real4d w_hat("w_hat",nzm,ny,nx2,ncrms);
-   real4d pgf_hat("pgf_hat",nzm,ny,nx2,ncrms);
+   // Sized for all CRMs to match the FFT plan, see pressure()
+   real4d w_hat("w_hat",nzm,ny,nx2,ncrms_all);
+   real4d pgf_hat("pgf_hat",nzm,ny,nx2,ncrms_all);
+   if (ncrms < ncrms_all) {
+      yakl::memset(w_hat,0.);
+      yakl::memset(pgf_hat,0.);
+   }
 
    // The loop over "y" points is mostly unessary, since ESMT
    // is for 2D CRMs, but it is useful for directly comparing
@@ -265,8 +270,8 @@ void scalar_momentum_tend() {
    //    for (int i=0; i<nx; i++) {
    //      for (int icrm=0; icrm<ncrms; icrm++) {
    parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-     u_esmt(k,j+offy_s,i+offx_s,icrm) = u_esmt(k,j+offy_s,i+offx_s,icrm) + u_esmt_pgf_3D(k,j,i,icrm)*dtn;
-     v_esmt(k,j+offy_s,i+offx_s,icrm) = v_esmt(k,j+offy_s,i+offx_s,icrm) + v_esmt_pgf_3D(k,j,i,icrm)*dtn;
+     u_esmt(k,j+offy_s,i+offx_s,icrm) = u_esmt(k,j+offy_s,i+offx_s,icrm) + u_esmt_pgf_3D(k,j,i,icrm)*dtn(icrm);
+     v_esmt(k,j+offy_s,i+offx_s,icrm) = v_esmt(k,j+offy_s,i+offx_s,icrm) + v_esmt_pgf_3D(k,j,i,icrm)*dtn(icrm);
    });
 
 }
@@ -32,7 +32,7 @@ extern "C" void setparm() {
     dy=dx;
   }
 
-  dtn = dt;
+  yakl::memset(dtn,dt);
 
   //Instead of writing function I just inline what sgs_setparm does
   dosmagor = true;
@@ -1,17 +1,87 @@
 
 #include "timeloop.h"
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+// The time levels na, nb, nc are rotated after each subcycle. CRMs icrm_beg, ...,
+// ncrms_all-1 have finished subcycling and sit out the current subcycle, so rotate
+// their tendencies and time steps the other way to keep their Adams-Bashforth history.
+void hold_time_levels(int icrm_beg) {
+  YAKL_SCOPE( dudt , :: dudt );
+  YAKL_SCOPE( dvdt , :: dvdt );
+  YAKL_SCOPE( dwdt , :: dwdt );
+  YAKL_SCOPE( dt3  , :: dt3 );
+  YAKL_SCOPE( na   , :: na );
+  YAKL_SCOPE( nb   , :: nb );
+  YAKL_SCOPE( nc   , :: nc );
+
+  int nhold = ncrms_all - icrm_beg;
+
+  // The rotation turns slot na-1 into nb-1, nb-1 into nc-1 and nc-1 into na-1,
+  // so move the data one slot the other way
+  // for (int k=0; k<nz; k++) {
+  //   for (int j=0; j<nyp1; j++) {
+  //     for (int i=0; i<nxp1; i++) {
+  //       for (int icrm=icrm_beg; icrm<ncrms_all; icrm++) {
+  parallel_for( SimpleBounds<4>(nz,nyp1,nxp1,nhold) , YAKL_LAMBDA (int k, int j, int i, int ihold) {
+    int icrm = icrm_beg + ihold;
+    if (k < nzm && j < ny) {
+      real tmp_a = dudt(na-1,k,j,i,icrm);
+      real tmp_b = dudt(nb-1,k,j,i,icrm);
+      real tmp_c = dudt(nc-1,k,j,i,icrm);
+      dudt(nc-1,k,j,i,icrm) = tmp_a;
+      dudt(na-1,k,j,i,icrm) = tmp_b;
+      dudt(nb-1,k,j,i,icrm) = tmp_c;
+    }
+    if (k < nzm && i < nx) {
+      real tmp_a = dvdt(na-1,k,j,i,icrm);
+      real tmp_b = dvdt(nb-1,k,j,i,icrm);
+      real tmp_c = dvdt(nc-1,k,j,i,icrm);
+      dvdt(nc-1,k,j,i,icrm) = tmp_a;
+      dvdt(na-1,k,j,i,icrm) = tmp_b;
+      dvdt(nb-1,k,j,i,icrm) = tmp_c;
+    }
+    if (j < ny && i < nx) {
+      real tmp_a = dwdt(na-1,k,j,i,icrm);
+      real tmp_b = dwdt(nb-1,k,j,i,icrm);
+      real tmp_c = dwdt(nc-1,k,j,i,icrm);
+      dwdt(nc-1,k,j,i,icrm) = tmp_a;
+      dwdt(na-1,k,j,i,icrm) = tmp_b;
+      dwdt(nb-1,k,j,i,icrm) = tmp_c;
+    }
+    if (k == 0 && j == 0 && i == 0) {
+      real tmp_a = dt3(na-1,icrm);
+      real tmp_b = dt3(nb-1,icrm);
+      real tmp_c = dt3(nc-1,icrm);
+      dt3(nc-1,icrm) = tmp_a;
+      dt3(na-1,icrm) = tmp_b;
+      dt3(nb-1,icrm) = tmp_c;
+    }
+  });
+}
+
 
 void timeloop() {
   YAKL_SCOPE( crm_output_subcycle_factor , :: crm_output_subcycle_factor );
   YAKL_SCOPE( t                        , :: t );
   YAKL_SCOPE( crm_rad_qrad             , :: crm_rad_qrad );
+  YAKL_SCOPE( dt                       , :: dt );
   YAKL_SCOPE( dtn                      , :: dtn );
-  YAKL_SCOPE( ncrms                    , :: ncrms );
+  YAKL_SCOPE( dtfactor                 , :: dtfactor );
+  YAKL_SCOPE( ncycle_crm               , :: ncycle_crm );
   YAKL_SCOPE( na                       , :: na );
   YAKL_SCOPE( dt3                      , :: dt3 );
   YAKL_SCOPE( use_VT                   , :: use_VT );
   YAKL_SCOPE( use_ESMT                 , :: use_ESMT );
 
+  // Each CRM only takes the ncycle_crm subcycles it needs. The CRMs are kept sorted by
+  // decreasing ncycle_crm, so that the ones taking part in subcycle icyc are the first
+  // ncrms_cycle[icyc], and the others are skipped by lowering ncrms for that subcycle.
+  // crm_order[icrm] is the original index of the CRM now at position icrm.
+  std::vector<int> crm_order(ncrms_all);
+  std::iota(crm_order.begin(),crm_order.end(),0);
+
   nstep = 0;
 
   do {
@@ -23,15 +93,38 @@ void timeloop() {
     //------------------------------------------------------------------
     kurant();
 
+    auto ncycle_crm_host = ncycle_crm.createHostCopy();
+    std::vector<int> order(ncrms_all);
+    std::iota(order.begin(),order.end(),0);
+    std::stable_sort(order.begin(),order.end(),[&] (int icrm1, int icrm2) {
+      return ncycle_crm_host(icrm1) > ncycle_crm_host(icrm2);
+    });
+    if (! std::is_sorted(order.begin(),order.end())) {
+      std::vector<int> crm_order_old = crm_order;
+      intHost1d perm_host("perm",ncrms_all);
+      for (int icrm=0; icrm<ncrms_all; icrm++) {
+        perm_host(icrm) = order[icrm];
+        crm_order[icrm] = crm_order_old[order[icrm]];
+      }
+      permute_crms(perm_host.createDeviceCopy());
+    }
+
+    std::vector<int> ncrms_cycle(ncycle+1,0);
+    for (int icrm=0; icrm<ncrms_all; icrm++) {
+      for (int icyc=1; icyc<=ncycle_crm_host(icrm); icyc++) {
+        ncrms_cycle[icyc]++;
+      }
+    }
+
     for(int icyc=1; icyc<=ncycle; icyc++) {
       icycle = icyc;
-      dtn = dt/ncycle;
-      parallel_for( 1 , YAKL_LAMBDA ( int i ) {
-        dt3(na-1) = dtn;
-      });
-      dtfactor = dtn/dt;
+      ncrms = ncrms_cycle[icyc];
 
+      // for (int icrm=0; icrm<ncrms; icrm++) {
       parallel_for( ncrms , YAKL_LAMBDA (int icrm) {
+        dtn(icrm) = dt/ncycle_crm(icrm);
+        dt3(na-1,icrm) = dtn(icrm);
+        dtfactor(icrm) = dtn(icrm)/dt;
         crm_output_subcycle_factor(icrm) = crm_output_subcycle_factor(icrm)+1;
       });
 
@@ -66,7 +159,7 @@ void timeloop() {
       parallel_for( SimpleBounds<4>(nzm,ny,nx,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
         int i_rad = i / (nx/crm_nx_rad);
         int j_rad = j / (ny/crm_ny_rad);
-        t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn;
+        t(k,j+offy_s,i+offx_s,icrm) = t(k,j+offy_s,i+offx_s,icrm) + crm_rad_qrad(k,j_rad,i_rad,icrm)*dtn(icrm);
       });
 
       //----------------------------------------------------------
@@ -182,14 +275,29 @@ void timeloop() {
       //----------------------------------------------------------
       // Rotate the dynamic tendency arrays for Adams-bashforth scheme:
 
+      if (ncrms < ncrms_all) {
+        hold_time_levels(ncrms);
+      }
+
       int nn=na;
       na=nc;
       nc=nb;
       nb=nn;
     } // icycle
 
+    ncrms = ncrms_all;
+
     post_icycle();
 
   } while (nstep < nstop);
 
+  // Put the CRMs back in their original order
+  if (! std::is_sorted(crm_order.begin(),crm_order.end())) {
+    intHost1d perm_host("perm",ncrms_all);
+    for (int icrm=0; icrm<ncrms_all; icrm++) {
+      perm_host(crm_order[icrm]) = icrm;
+    }
+    permute_crms(perm_host.createDeviceCopy());
+  }
+
 }
@@ -26,5 +26,7 @@
 #include "scalar_momentum.h"
 #include "crm_variance_transport.h"
 
+void hold_time_levels(int icrm_beg);
+
 void timeloop();
 
@@ -86,7 +86,13 @@ void allocate() {
   adz              = real2d( "adz             "                        , nzm    , ncrms ); 
   adzw             = real2d( "adzw            "                        , nz     , ncrms ); 
   dz               = real1d( "dz              "                                 , ncrms ); 
-  dt3              = real1d( "dt3             " , 3                                     ); 
+  dt3              = real2d( "dt3             " , 3                             , ncrms ); 
+  ncycle_crm       = int1d ( "ncycle_crm      "                                 , ncrms ); 
+  dtn              = real1d( "dtn             "                                 , ncrms ); 
+  dtfactor         = real1d( "dtfactor        "                                 , ncrms ); 
+  at               = real1d( "at              "                                 , ncrms ); 
+  bt               = real1d( "bt              "                                 , ncrms ); 
+  ct               = real1d( "ct              "                                 , ncrms ); 
   u                = real4d( "u               "     , nzm , dimy_u     , dimx_u , ncrms ); 
   v                = real4d( "v               "     , nzm , dimy_v     , dimx_v , ncrms ); 
   w                = real4d( "w               "     , nz  , dimy_w     , dimx_w , ncrms ); 
@@ -268,6 +274,12 @@ void allocate() {
   yakl::memset(adzw              ,0.);
   yakl::memset(dz                ,0.);
   yakl::memset(dt3               ,0.);
+  yakl::memset(ncycle_crm        ,1 );
+  yakl::memset(dtn               ,0.);
+  yakl::memset(dtfactor          ,0.);
+  yakl::memset(at                ,0.);
+  yakl::memset(bt                ,0.);
+  yakl::memset(ct                ,0.);
   yakl::memset(u                 ,0.);
   yakl::memset(v                 ,0.);
   yakl::memset(w                 ,0.);
@@ -551,7 +563,13 @@ void finalize() {
   adz              = real2d(); 
   adzw             = real2d(); 
   dz               = real1d(); 
-  dt3              = real1d(); 
+  dt3              = real2d(); 
+  ncycle_crm       = int1d (); 
+  dtn              = real1d(); 
+  dtfactor         = real1d(); 
+  at               = real1d(); 
+  bt               = real1d(); 
+  ct               = real1d(); 
   u                = real4d();
   v                = real4d();
   w                = real4d();
@@ -1521,6 +1539,311 @@ void perturb_arrays() {
 }
 
 
+void permute_crms(int1d const &perm) {
+  permute_crms( u                          , ncrms_all , perm );
+  permute_crms( v                          , ncrms_all , perm );
+  permute_crms( w                          , ncrms_all , perm );
+  permute_crms( t                          , ncrms_all , perm );
+  permute_crms( p                          , ncrms_all , perm );
+  permute_crms( u_esmt                     , ncrms_all , perm );
+  permute_crms( v_esmt                     , ncrms_all , perm );
+  permute_crms( tke2                       , ncrms_all , perm );
+  permute_crms( tk2                        , ncrms_all , perm );
+  permute_crms( sstxy                      , ncrms_all , perm );
+  permute_crms( fcory                      , ncrms_all , perm );
+  permute_crms( sgs_field                  , ncrms_all , perm );
+  permute_crms( sgs_field_diag             , ncrms_all , perm );
+  permute_crms( micro_field                , ncrms_all , perm );
+  permute_crms( tabs                       , ncrms_all , perm );
+  permute_crms( qv                         , ncrms_all , perm );
+  permute_crms( qcl                        , ncrms_all , perm );
+  permute_crms( qpl                        , ncrms_all , perm );
+  permute_crms( qci                        , ncrms_all , perm );
+  permute_crms( qpi                        , ncrms_all , perm );
+  permute_crms( dudt                       , ncrms_all , perm );
+  permute_crms( dvdt                       , ncrms_all , perm );
+  permute_crms( dwdt                       , ncrms_all , perm );
+  permute_crms( misc                       , ncrms_all , perm );
+  permute_crms( fluxbu                     , ncrms_all , perm );
+  permute_crms( fluxbv                     , ncrms_all , perm );
+  permute_crms( fluxbt                     , ncrms_all , perm );
+  permute_crms( fluxbq                     , ncrms_all , perm );
+  permute_crms( fluxtu                     , ncrms_all , perm );
+  permute_crms( fluxtv                     , ncrms_all , perm );
+  permute_crms( fluxtt                     , ncrms_all , perm );
+  permute_crms( fluxtq                     , ncrms_all , perm );
+  permute_crms( fzero                      , ncrms_all , perm );
+  permute_crms( precsfc                    , ncrms_all , perm );
+  permute_crms( precssfc                   , ncrms_all , perm );
+  permute_crms( t0                         , ncrms_all , perm );
+  permute_crms( q0                         , ncrms_all , perm );
+  permute_crms( qv0                        , ncrms_all , perm );
+  permute_crms( tabs0                      , ncrms_all , perm );
+  permute_crms( tv0                        , ncrms_all , perm );
+  permute_crms( u0                         , ncrms_all , perm );
+  permute_crms( v0                         , ncrms_all , perm );
+  permute_crms( tg0                        , ncrms_all , perm );
+  permute_crms( qg0                        , ncrms_all , perm );
+  permute_crms( ug0                        , ncrms_all , perm );
+  permute_crms( vg0                        , ncrms_all , perm );
+  permute_crms( p0                         , ncrms_all , perm );
+  permute_crms( tke0                       , ncrms_all , perm );
+  permute_crms( t01                        , ncrms_all , perm );
+  permute_crms( q01                        , ncrms_all , perm );
+  permute_crms( qp0                        , ncrms_all , perm );
+  permute_crms( qn0                        , ncrms_all , perm );
+  permute_crms( prespot                    , ncrms_all , perm );
+  permute_crms( rho                        , ncrms_all , perm );
+  permute_crms( rhow                       , ncrms_all , perm );
+  permute_crms( bet                        , ncrms_all , perm );
+  permute_crms( gamaz                      , ncrms_all , perm );
+  permute_crms( wsub                       , ncrms_all , perm );
+  permute_crms( qtend                      , ncrms_all , perm );
+  permute_crms( ttend                      , ncrms_all , perm );
+  permute_crms( utend                      , ncrms_all , perm );
+  permute_crms( vtend                      , ncrms_all , perm );
+  permute_crms( fcorzy                     , ncrms_all , perm );
+  permute_crms( latitude                   , ncrms_all , perm );
+  permute_crms( longitude                  , ncrms_all , perm );
+  permute_crms( prec_xy                    , ncrms_all , perm );
+  permute_crms( pw_xy                      , ncrms_all , perm );
+  permute_crms( cw_xy                      , ncrms_all , perm );
+  permute_crms( iw_xy                      , ncrms_all , perm );
+  permute_crms( cld_xy                     , ncrms_all , perm );
+  permute_crms( u200_xy                    , ncrms_all , perm );
+  permute_crms( usfc_xy                    , ncrms_all , perm );
+  permute_crms( v200_xy                    , ncrms_all , perm );
+  permute_crms( vsfc_xy                    , ncrms_all , perm );
+  permute_crms( w500_xy                    , ncrms_all , perm );
+  permute_crms( w_max                      , ncrms_all , perm );
+  permute_crms( u_max                      , ncrms_all , perm );
+  permute_crms( twsb                       , ncrms_all , perm );
+  permute_crms( precflux                   , ncrms_all , perm );
+  permute_crms( uwle                       , ncrms_all , perm );
+  permute_crms( uwsb                       , ncrms_all , perm );
+  permute_crms( vwle                       , ncrms_all , perm );
+  permute_crms( vwsb                       , ncrms_all , perm );
+  permute_crms( tkelediss                  , ncrms_all , perm );
+  permute_crms( tdiff                      , ncrms_all , perm );
+  permute_crms( tlat                       , ncrms_all , perm );
+  permute_crms( tlatqi                     , ncrms_all , perm );
+  permute_crms( qifall                     , ncrms_all , perm );
+  permute_crms( qpfall                     , ncrms_all , perm );
+  permute_crms( total_water_evap           , ncrms_all , perm );
+  permute_crms( total_water_prec           , ncrms_all , perm );
+  permute_crms( CF3D                       , ncrms_all , perm );
+  permute_crms( u850_xy                    , ncrms_all , perm );
+  permute_crms( v850_xy                    , ncrms_all , perm );
+  permute_crms( psfc_xy                    , ncrms_all , perm );
+  permute_crms( swvp_xy                    , ncrms_all , perm );
+  permute_crms( cloudtopheight             , ncrms_all , perm );
+  permute_crms( echotopheight              , ncrms_all , perm );
+  permute_crms( cloudtoptemp               , ncrms_all , perm );
+  permute_crms( t_vt                       , ncrms_all , perm );
+  permute_crms( q_vt                       , ncrms_all , perm );
+  permute_crms( u_vt                       , ncrms_all , perm );
+  permute_crms( t_vt_tend                  , ncrms_all , perm );
+  permute_crms( q_vt_tend                  , ncrms_all , perm );
+  permute_crms( u_vt_tend                  , ncrms_all , perm );
+  permute_crms( t_vt_pert                  , ncrms_all , perm );
+  permute_crms( q_vt_pert                  , ncrms_all , perm );
+  permute_crms( u_vt_pert                  , ncrms_all , perm );
+  permute_crms( fcorz                      , ncrms_all , perm );
+  permute_crms( fcor                       , ncrms_all , perm );
+  permute_crms( longitude0                 , ncrms_all , perm );
+  permute_crms( latitude0                  , ncrms_all , perm );
+  permute_crms( z0                         , ncrms_all , perm );
+  permute_crms( uhl                        , ncrms_all , perm );
+  permute_crms( vhl                        , ncrms_all , perm );
+  permute_crms( taux0                      , ncrms_all , perm );
+  permute_crms( tauy0                      , ncrms_all , perm );
+  permute_crms( z                          , ncrms_all , perm );
+  permute_crms( pres                       , ncrms_all , perm );
+  permute_crms( zi                         , ncrms_all , perm );
+  permute_crms( presi                      , ncrms_all , perm );
+  permute_crms( adz                        , ncrms_all , perm );
+  permute_crms( adzw                       , ncrms_all , perm );
+  permute_crms( dt3                        , ncrms_all , perm );
+  permute_crms( dz                         , ncrms_all , perm );
+  permute_crms( ncycle_crm                 , ncrms_all , perm );
+  permute_crms( dtn                        , ncrms_all , perm );
+  permute_crms( dtfactor                   , ncrms_all , perm );
+  permute_crms( at                         , ncrms_all , perm );
+  permute_crms( bt                         , ncrms_all , perm );
+  permute_crms( ct                         , ncrms_all , perm );
+  permute_crms( grdf_x                     , ncrms_all , perm );
+  permute_crms( grdf_y                     , ncrms_all , perm );
+  permute_crms( grdf_z                     , ncrms_all , perm );
+  permute_crms( tkesbbuoy                  , ncrms_all , perm );
+  permute_crms( tkesbshear                 , ncrms_all , perm );
+  permute_crms( tkesbdiss                  , ncrms_all , perm );
+  permute_crms( fluxbmk                    , ncrms_all , perm );
+  permute_crms( fluxtmk                    , ncrms_all , perm );
+  permute_crms( mkwle                      , ncrms_all , perm );
+  permute_crms( mkwsb                      , ncrms_all , perm );
+  permute_crms( mkadv                      , ncrms_all , perm );
+  permute_crms( mkdiff                     , ncrms_all , perm );
+  permute_crms( qn                         , ncrms_all , perm );
+  permute_crms( qpsrc                      , ncrms_all , perm );
+  permute_crms( qpevp                      , ncrms_all , perm );
+  permute_crms( flag_top                   , ncrms_all , perm );
+  permute_crms( u_esmt_sgs                 , ncrms_all , perm );
+  permute_crms( v_esmt_sgs                 , ncrms_all , perm );
+  permute_crms( u_esmt_diff                , ncrms_all , perm );
+  permute_crms( v_esmt_diff                , ncrms_all , perm );
+  permute_crms( fluxb_u_esmt               , ncrms_all , perm );
+  permute_crms( fluxb_v_esmt               , ncrms_all , perm );
+  permute_crms( fluxt_u_esmt               , ncrms_all , perm );
+  permute_crms( fluxt_v_esmt               , ncrms_all , perm );
+  permute_crms( accrsc                     , ncrms_all , perm );
+  permute_crms( accrsi                     , ncrms_all , perm );
+  permute_crms( accrrc                     , ncrms_all , perm );
+  permute_crms( coefice                    , ncrms_all , perm );
+  permute_crms( accrgc                     , ncrms_all , perm );
+  permute_crms( accrgi                     , ncrms_all , perm );
+  permute_crms( evaps1                     , ncrms_all , perm );
+  permute_crms( evaps2                     , ncrms_all , perm );
+  permute_crms( evapr1                     , ncrms_all , perm );
+  permute_crms( evapr2                     , ncrms_all , perm );
+  permute_crms( evapg1                     , ncrms_all , perm );
+  permute_crms( evapg2                     , ncrms_all , perm );
+  permute_crms( t00                        , ncrms_all , perm );
+  permute_crms( tln                        , ncrms_all , perm );
+  permute_crms( qln                        , ncrms_all , perm );
+  permute_crms( qccln                      , ncrms_all , perm );
+  permute_crms( qiiln                      , ncrms_all , perm );
+  permute_crms( uln                        , ncrms_all , perm );
+  permute_crms( vln                        , ncrms_all , perm );
+  permute_crms( uln_esmt                   , ncrms_all , perm );
+  permute_crms( vln_esmt                   , ncrms_all , perm );
+  permute_crms( cwp                        , ncrms_all , perm );
+  permute_crms( cwph                       , ncrms_all , perm );
+  permute_crms( cwpm                       , ncrms_all , perm );
+  permute_crms( cwpl                       , ncrms_all , perm );
+  permute_crms( cltemp                     , ncrms_all , perm );
+  permute_crms( cmtemp                     , ncrms_all , perm );
+  permute_crms( chtemp                     , ncrms_all , perm );
+  permute_crms( cttemp                     , ncrms_all , perm );
+  permute_crms( dd_crm                     , ncrms_all , perm );
+  permute_crms( mui_crm                    , ncrms_all , perm );
+  permute_crms( mdi_crm                    , ncrms_all , perm );
+  permute_crms( ustar                      , ncrms_all , perm );
+  permute_crms( wnd                        , ncrms_all , perm );
+  permute_crms( qtot                       , ncrms_all , perm );
+  permute_crms( colprec                    , ncrms_all , perm );
+  permute_crms( colprecs                   , ncrms_all , perm );
+  permute_crms( bflx                       , ncrms_all , perm );
+  permute_crms( crm_clear_rh               , ncrms_all , perm );
+  permute_crms( crm_clear_rh_cnt           , ncrms_all , perm );
+  permute_crms( lat0                       , ncrms_all , perm );
+  permute_crms( long0                      , ncrms_all , perm );
+  permute_crms( gcolp                      , ncrms_all , perm );
+  permute_crms( crm_input_bflxls           , pcols     , perm );
+  permute_crms( crm_input_wndls            , pcols     , perm );
+  permute_crms( crm_input_zmid             , pcols     , perm );
+  permute_crms( crm_input_zint             , pcols     , perm );
+  permute_crms( crm_input_pmid             , pcols     , perm );
+  permute_crms( crm_input_pint             , pcols     , perm );
+  permute_crms( crm_input_pdel             , pcols     , perm );
+  permute_crms( crm_input_ul               , pcols     , perm );
+  permute_crms( crm_input_vl               , pcols     , perm );
+  permute_crms( crm_input_tl               , pcols     , perm );
+  permute_crms( crm_input_qccl             , pcols     , perm );
+  permute_crms( crm_input_qiil             , pcols     , perm );
+  permute_crms( crm_input_ql               , pcols     , perm );
+  permute_crms( crm_input_tau00            , pcols     , perm );
+  permute_crms( crm_input_ul_esmt          , pcols     , perm );
+  permute_crms( crm_input_vl_esmt          , pcols     , perm );
+  permute_crms( crm_input_t_vt             , pcols     , perm );
+  permute_crms( crm_input_q_vt             , pcols     , perm );
+  permute_crms( crm_input_u_vt             , pcols     , perm );
+  permute_crms( crm_state_u_wind           , pcols     , perm );
+  permute_crms( crm_state_v_wind           , pcols     , perm );
+  permute_crms( crm_state_w_wind           , pcols     , perm );
+  permute_crms( crm_state_temperature      , pcols     , perm );
+  permute_crms( crm_state_qv               , pcols     , perm );
+  permute_crms( crm_state_qp               , pcols     , perm );
+  permute_crms( crm_state_qn               , pcols     , perm );
+  permute_crms( crm_rad_qrad               , pcols     , perm );
+  permute_crms( crm_rad_temperature        , pcols     , perm );
+  permute_crms( crm_rad_qv                 , pcols     , perm );
+  permute_crms( crm_rad_qc                 , pcols     , perm );
+  permute_crms( crm_rad_qi                 , pcols     , perm );
+  permute_crms( crm_rad_cld                , pcols     , perm );
+  permute_crms( crm_output_subcycle_factor , pcols     , perm );
+  permute_crms( crm_output_prectend        , pcols     , perm );
+  permute_crms( crm_output_precstend       , pcols     , perm );
+  permute_crms( crm_output_cld             , pcols     , perm );
+  permute_crms( crm_output_cldtop          , pcols     , perm );
+  permute_crms( crm_output_gicewp          , pcols     , perm );
+  permute_crms( crm_output_gliqwp          , pcols     , perm );
+  permute_crms( crm_output_mctot           , pcols     , perm );
+  permute_crms( crm_output_mcup            , pcols     , perm );
+  permute_crms( crm_output_mcdn            , pcols     , perm );
+  permute_crms( crm_output_mcuup           , pcols     , perm );
+  permute_crms( crm_output_mcudn           , pcols     , perm );
+  permute_crms( crm_output_qc_mean         , pcols     , perm );
+  permute_crms( crm_output_qi_mean         , pcols     , perm );
+  permute_crms( crm_output_qs_mean         , pcols     , perm );
+  permute_crms( crm_output_qg_mean         , pcols     , perm );
+  permute_crms( crm_output_qr_mean         , pcols     , perm );
+  permute_crms( crm_output_mu_crm          , pcols     , perm );
+  permute_crms( crm_output_md_crm          , pcols     , perm );
+  permute_crms( crm_output_eu_crm          , pcols     , perm );
+  permute_crms( crm_output_du_crm          , pcols     , perm );
+  permute_crms( crm_output_ed_crm          , pcols     , perm );
+  permute_crms( crm_output_flux_qt         , pcols     , perm );
+  permute_crms( crm_output_flux_u          , pcols     , perm );
+  permute_crms( crm_output_flux_v          , pcols     , perm );
+  permute_crms( crm_output_fluxsgs_qt      , pcols     , perm );
+  permute_crms( crm_output_tkez            , pcols     , perm );
+  permute_crms( crm_output_tkew            , pcols     , perm );
+  permute_crms( crm_output_tkesgsz         , pcols     , perm );
+  permute_crms( crm_output_tkz             , pcols     , perm );
+  permute_crms( crm_output_flux_qp         , pcols     , perm );
+  permute_crms( crm_output_precflux        , pcols     , perm );
+  permute_crms( crm_output_qt_trans        , pcols     , perm );
+  permute_crms( crm_output_qp_trans        , pcols     , perm );
+  permute_crms( crm_output_qp_fall         , pcols     , perm );
+  permute_crms( crm_output_qp_evp          , pcols     , perm );
+  permute_crms( crm_output_qp_src          , pcols     , perm );
+  permute_crms( crm_output_qt_ls           , pcols     , perm );
+  permute_crms( crm_output_t_ls            , pcols     , perm );
+  permute_crms( crm_output_jt_crm          , pcols     , perm );
+  permute_crms( crm_output_mx_crm          , pcols     , perm );
+  permute_crms( crm_output_cltot           , pcols     , perm );
+  permute_crms( crm_output_clhgh           , pcols     , perm );
+  permute_crms( crm_output_clmed           , pcols     , perm );
+  permute_crms( crm_output_cllow           , pcols     , perm );
+  permute_crms( crm_output_sltend          , pcols     , perm );
+  permute_crms( crm_output_qltend          , pcols     , perm );
+  permute_crms( crm_output_qcltend         , pcols     , perm );
+  permute_crms( crm_output_qiltend         , pcols     , perm );
+  permute_crms( crm_output_t_vt_tend       , pcols     , perm );
+  permute_crms( crm_output_q_vt_tend       , pcols     , perm );
+  permute_crms( crm_output_u_vt_tend       , pcols     , perm );
+  permute_crms( crm_output_t_vt_ls         , pcols     , perm );
+  permute_crms( crm_output_q_vt_ls         , pcols     , perm );
+  permute_crms( crm_output_u_vt_ls         , pcols     , perm );
+  permute_crms( crm_output_ultend          , pcols     , perm );
+  permute_crms( crm_output_vltend          , pcols     , perm );
+  permute_crms( crm_output_tk              , pcols     , perm );
+  permute_crms( crm_output_tkh             , pcols     , perm );
+  permute_crms( crm_output_qcl             , pcols     , perm );
+  permute_crms( crm_output_qci             , pcols     , perm );
+  permute_crms( crm_output_qpl             , pcols     , perm );
+  permute_crms( crm_output_qpi             , pcols     , perm );
+  permute_crms( crm_output_z0m             , pcols     , perm );
+  permute_crms( crm_output_taux            , pcols     , perm );
+  permute_crms( crm_output_tauy            , pcols     , perm );
+  permute_crms( crm_output_precc           , pcols     , perm );
+  permute_crms( crm_output_precl           , pcols     , perm );
+  permute_crms( crm_output_precsc          , pcols     , perm );
+  permute_crms( crm_output_precsl          , pcols     , perm );
+  permute_crms( crm_output_prec_crm        , pcols     , perm );
+}
+
+
 
 real4d u               ;
 real4d v               ;
@@ -1643,9 +1966,16 @@ real2d zi              ;
 real2d presi           ;
 real2d adz             ;
 real2d adzw            ;
-real1d dt3             ;
+real2d dt3             ;
 real1d dz              ;
 
+int1d  ncycle_crm      ;
+real1d dtn             ;
+real1d dtfactor        ;
+real1d at              ;
+real1d bt              ;
+real1d ct              ;
+
 real5d sgs_field       ;
 real5d sgs_field_diag  ;
 real2d grdf_x          ;
@@ -1831,14 +2161,12 @@ int1d  gcolp;
 
 int pcols;
 int ncrms;
+int ncrms_all;
 
 int  nstep                    ;
 int  ncycle                   ;
 int  icycle                   ;
 int  na, nb, nc               ;
-real at, bt, ct               ;
-real dtn                      ;
-real dtfactor                 ;
 int  rank                     ;
 int  ranknn                   ;
 int  rankss                   ;
@@ -31,6 +31,22 @@ inline real arraySum(real1d &arr) {
 }
 
 
+// Reorder the CRMs of arr in place, so that CRM icrm afterwards holds what CRM perm(icrm)
+// held before. The CRM index is the last dimension of arr, of size ncrms_dim, and only
+// its first perm.get_totElems() entries are reordered.
+template <class T, int rank>
+inline void permute_crms(yakl::Array<T,rank,yakl::memDevice,yakl::styleC> &arr, int ncrms_dim, int1d const &perm) {
+  int nperm  = perm.get_totElems();
+  int nouter = arr.get_totElems() / ncrms_dim;
+  auto arr_old = arr.createDeviceCopy();
+  T       *dst = arr.data();
+  T const *src = arr_old.data();
+  parallel_for( SimpleBounds<2>(nouter,nperm) , YAKL_LAMBDA (int iouter, int icrm) {
+    dst[iouter*ncrms_dim+icrm] = src[iouter*ncrms_dim+perm(icrm)];
+  });
+}
+
+
 //////////////////////////////////////////////////////////////////////////////////
 // These arrays use non-1 lower bounds in the Fortran code
 // They must be indexed differently in the C++ code
@@ -54,6 +70,10 @@ extern real5d micro_field   ; // Index as sgs_field_diag(l , k , offy_s    +j ,
 void perturb_arrays();
 
 
+// Reorder the CRMs of all the arrays above, see permute_crms(arr,ncrms_dim,perm)
+void permute_crms(int1d const &perm);
+
+
 void create_and_copy_inputs(real *crm_input_bflxls_p, real *crm_input_wndls_p, real *crm_input_zmid_p, real *crm_input_zint_p, 
                             real *crm_input_pmid_p, real *crm_input_pint_p, real *crm_input_pdel_p, real *crm_input_ul_p, real *crm_input_vl_p, 
                             real *crm_input_tl_p, real *crm_input_qccl_p, real *crm_input_qiil_p, real *crm_input_ql_p, real *crm_input_tau00_p,
@@ -114,14 +134,14 @@ void copy_outputs_and_destroy(real *crm_state_u_wind_p, real *crm_state_v_wind_p
                             
 extern int pcols;
 extern int ncrms;
+// Number of CRMs the arrays are allocated for. Within the subcycle loop, ncrms
+// is lowered to the number of CRMs that have not finished their cycles yet.
+extern int ncrms_all;
 
 extern int  nstep                    ;
 extern int  ncycle                   ;
 extern int  icycle                   ;
 extern int  na, nb, nc               ;
-extern real at, bt, ct               ;
-extern real dtn                      ;
-extern real dtfactor                 ;
 extern int  rank                     ;
 extern int  ranknn                   ;
 extern int  rankss                   ;
@@ -353,9 +373,17 @@ extern real2d zi              ;
 extern real2d presi           ;
 extern real2d adz             ;
 extern real2d adzw            ;
-extern real1d dt3             ;
+extern real2d dt3             ; // Index as dt3(n,icrm) with n = na-1, nb-1, nc-1
 extern real1d dz              ;
 
+// Each CRM is subcycled with its own number of cycles, hence its own time step
+extern int1d  ncycle_crm      ;
+extern real1d dtn             ;
+extern real1d dtfactor        ;
+extern real1d at              ;
+extern real1d bt              ;
+extern real1d ct              ;
+
 extern real2d grdf_x          ;
 extern real2d grdf_y          ;
 extern real2d grdf_z          ;
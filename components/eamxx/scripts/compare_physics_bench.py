@@ -0,0 +1,96 @@
+from utils import expect
+
+import json, pathlib
+
+###############################################################################
+class ComparePhysicsBench(object):
+###############################################################################
+
+    ###########################################################################
+    def __init__(self,file,baseline,tol=0.05):
+    ###########################################################################
+
+        self._file     = pathlib.Path(file).resolve().absolute()
+        self._baseline = pathlib.Path(baseline).resolve().absolute()
+        self._tol      = tol
+
+        for f in [self._file, self._baseline]:
+            expect (f.exists(), f"Error! File '{f}' does not exist.")
+        expect (tol>=0, f"Error! Invalid tolerance {tol}.")
+
+    ###########################################################################
+    def load(self,path):
+    ###########################################################################
+        with open(path,"r") as fd:
+            data = json.load(fd)
+
+        expect ("config" in data and "results" in data,
+                f"Error! File '{path}' is not a physics_bench output file.")
+
+        return data["config"], {self.case_key(r) : r for r in data["results"]}
+
+    ###########################################################################
+    @staticmethod
+    def case_key(result):
+    ###########################################################################
+        """
+        >>> ComparePhysicsBench.case_key({"process":"p3","ncols":1024,"nlevs":72})
+        'p3 ncols=1024 nlevs=72'
+        """
+        return "{} ncols={} nlevs={}".format(result["process"],result["ncols"],result["nlevs"])
+
+    ###########################################################################
+    def compare_case(self,new,old):
+    ###########################################################################
+        """
+        Return the relative change in throughput, and whether it is within tolerance
+
+        >>> cpb = ComparePhysicsBench.__new__(ComparePhysicsBench)
+        >>> cpb._tol = 0.1
+        >>> cpb.compare_case({"cols_per_sec":95},{"cols_per_sec":100})
+        (-0.05, True)
+        >>> cpb.compare_case({"cols_per_sec":80},{"cols_per_sec":100})
+        (-0.2, False)
+        >>> cpb.compare_case({"cols_per_sec":120},{"cols_per_sec":100})
+        (0.2, True)
+        """
+        old_cps = old["cols_per_sec"]
+        new_cps = new["cols_per_sec"]
+        if old_cps<=0:
+            return 0.0, True
+
+        rel = (new_cps - old_cps) / old_cps
+        return round(rel,12), rel>=-self._tol
+
+    ###########################################################################
+    def run(self):
+    ###########################################################################
+        new_cfg, new_res = self.load(self._file)
+        old_cfg, old_res = self.load(self._baseline)
+
+        # Throughput is only comparable for the same build config and resources
+        for key in ["exec_space","precision","pack_size","num_ranks"]:
+            if new_cfg.get(key)!=old_cfg.get(key):
+                print (f"  WARNING: '{key}' differs: {new_cfg.get(key)} (file) vs {old_cfg.get(key)} (baseline)")
+
+        success = True
+        print ("{:<36} {:>14} {:>14} {:>9} {:>14} {:>14}".format(
+            "case","cols/s","baseline","change","bytes/col","kernels/step"))
+        for key, new in new_res.items():
+            if key not in old_res:
+                print (f"{key:<36} (not in baseline)")
+                continue
+
+            old = old_res[key]
+            rel, ok = self.compare_case(new,old)
+            success &= ok
+            print ("{:<36} {:>14.4g} {:>14.4g} {:>+8.1f}% {:>14.4g} {:>14.4g}{}".format(
+                key,new["cols_per_sec"],old["cols_per_sec"],100*rel,
+                new["bytes_per_col"],new["kernels_per_step"],
+                "" if ok else "  <-- REGRESSION"))
+
+        for key in old_res:
+            if key not in new_res:
+                print (f"{key:<36} (only in baseline)")
+
+        return success
@@ -0,0 +1,66 @@
+from utils import expect
+
+import json, pathlib, re
+
+###############################################################################
+class MergeChromeTraces(object):
+###############################################################################
+
+    ###########################################################################
+    def __init__(self,files,output,ranks=None):
+    ###########################################################################
+
+        self._files  = [pathlib.Path(f).resolve().absolute() for f in files]
+        self._output = pathlib.Path(output).resolve().absolute()
+        self._ranks  = None if ranks is None else set(ranks)
+
+        expect (len(self._files)>0, "Error! No trace files provided.")
+        for f in self._files:
+            expect (f.exists(), f"Error! File '{f}' does not exist.")
+
+    ###########################################################################
+    def get_rank(self,path):
+    ###########################################################################
+        """
+        Extract the rank from a trace file name, which has the form <prefix>.rank<N>.json
+
+        >>> mct = MergeChromeTraces.__new__(MergeChromeTraces)
+        >>> mct.get_rank(pathlib.Path("eamxx_trace.rank12.json"))
+        12
+        >>> mct.get_rank(pathlib.Path("foo.json")) is None
+        True
+        """
+        m = re.search(r"\.rank(\d+)\.json$",path.name)
+        return int(m.group(1)) if m else None
+
+    ###########################################################################
+    def run(self):
+    ###########################################################################
+        events = []
+        dropped = 0
+        nfiles = 0
+        for f in self._files:
+            rank = self.get_rank(f)
+            if self._ranks is not None and rank not in self._ranks:
+                continue
+
+            with open(f,"r") as fd:
+                data = json.load(fd)
+
+            expect ("traceEvents" in data,
+                    f"Error! File '{f}' does not look like a chrome trace file.")
+
+            # Each rank writes its own pid, so events can simply be concatenated
+            events += data["traceEvents"]
+            dropped += data.get("otherData",{}).get("dropped_events",0)
+            nfiles += 1
+
+        expect (nfiles>0, "Error! None of the input files matches the requested ranks.")
+
+        merged = {"traceEvents" : events,
+                  "displayTimeUnit" : "ms",
+                  "otherData" : {"dropped_events" : dropped, "num_ranks" : nfiles}}
+        with open(self._output,"w") as fd:
+            json.dump(merged,fd)
+
+        return nfiles, dropped
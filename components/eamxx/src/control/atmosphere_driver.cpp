@@ -7,10 +7,13 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/util/eamxx_load_imbalance.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_timing.hpp"
 #include "share/util/scream_utils.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_node_local_checkpoint.hpp"
+#include "share/io/scorpio_multi_input.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -30,8 +33,11 @@
 #include <unistd.h>
 #endif
 
+#include <cctype>
 #include <fstream>
+#include <iomanip>
 #include <random>
+#include <sstream>
 
 namespace scream {
 
@@ -149,6 +155,21 @@ init_scorpio(const int atm_id)
   // not be, depending on what scorpio does.
   init_gptl(m_gptl_externally_handled);
 
+  // Optionally, record the timeline of timers (and kernels), to write a chrome trace at finalization
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  if (driver_options_pl.get<bool>("enable_timeline_trace",false)) {
+    enable_timeline_tracing(m_atm_comm,
+                            driver_options_pl.get<int>("timeline_trace_buffer_size",1000000),
+                            driver_options_pl.get<int>("timeline_trace_rank_stride",1),
+                            driver_options_pl.get<bool>("timeline_trace_kernels",false));
+  }
+
+  // GPTL timers are renamed under a GPTL prefix (as in CIME runs), so the load
+  // imbalance analysis uses the wall time accumulated by EAMxx instead
+  if (driver_options_pl.get<bool>("enable_load_imbalance_analysis",false)) {
+    enable_timer_wallclock_tracking();
+  }
+
   m_ad_status |= s_scorpio_inited;
 }
 
@@ -247,7 +268,17 @@ void AtmosphereDriver::create_grids()
     // Restarted run -> read geo data from restart file
     const auto& casename = ic_pl.get<std::string>("restart_casename");
     auto filename = find_filename_in_rpointer (casename,true,m_atm_comm,m_run_t0);
-    gm_params.set("ic_filename", filename);
+    if (NodeLocalCheckpoint::is_node_local_checkpoint(filename)) {
+      // Node-local checkpoints do not store geo data, so get it from the original IC file
+      EKAT_REQUIRE_MSG (ic_pl.isParameter("Filename"),
+          "Error! Restarting from a node-local checkpoint requires the original IC file.\n"
+          "  - restart file: " + filename + "\n"
+          "Node-local checkpoints do not store geometric data, so please provide\n"
+          "'Filename' in the initial_conditions section of the input parameters.\n");
+      gm_params.set("ic_filename", ic_pl.get<std::string>("Filename"));
+    } else {
+      gm_params.set("ic_filename", filename);
+    }
     m_atm_params.sublist("provenance").set("initial_conditions_file",filename);
   } else if (ic_pl.isParameter("Filename")) {
     // Initial run, if an IC file is present, pass it.
@@ -891,6 +922,12 @@ void AtmosphereDriver::restart_model ()
 
   m_atm_logger->info("    [EAMxx] Restart filename: " + filename);
 
+  if (NodeLocalCheckpoint::is_node_local_checkpoint(filename)) {
+    restart_model_from_node_local_checkpoint (filename);
+    m_atm_logger->info("  [EAMxx] restart_model ... done!");
+    return;
+  }
+
   for (auto& it : m_field_mgrs) {
     if (fvphyshack and it.second->get_grid()->name() == "Physics GLL") continue;
     if (not it.second->has_group("RESTART")) {
@@ -935,6 +972,35 @@ void AtmosphereDriver::restart_model ()
   m_atm_logger->info("  [EAMxx] restart_model ... done!");
 }
 
+void AtmosphereDriver::
+restart_model_from_node_local_checkpoint (const std::string& manifest)
+{
+  std::vector<Field> fields;
+  for (auto& it : m_field_mgrs) {
+    if (fvphyshack and it.second->get_grid()->name() == "Physics GLL") continue;
+    if (not it.second->has_group("RESTART")) {
+      // No field needs to be restarted on this grid.
+      continue;
+    }
+    const auto& restart_group = it.second->get_groups_info().at("RESTART");
+    for (const auto& fn : restart_group->m_fields_names) {
+      fields.push_back(it.second->get_field(fn));
+    }
+  }
+  NodeLocalCheckpoint::read_fields (manifest,m_atm_comm,fields);
+
+  for (auto& f : fields) {
+    f.get_header().get_tracking().update_time_stamp(m_current_ts);
+  }
+
+  // Restart the num steps counter in the atm time stamp
+  int nsteps = NodeLocalCheckpoint::read_nsteps(manifest,m_atm_comm);
+  m_current_ts.set_num_steps(nsteps);
+  m_run_t0.set_num_steps(nsteps);
+
+  NodeLocalCheckpoint::read_globals(manifest,m_atm_comm,m_atm_process_group->get_restart_extra_data());
+}
+
 void AtmosphereDriver::create_logger () {
   using namespace ekat::logger;
   using ci_string = ekat::CaseInsensitiveString;
@@ -1038,6 +1104,7 @@ void AtmosphereDriver::set_initial_conditions ()
         if (grid_name == "Physics PG2") {
           // Skip
         } else if (grid_name == "Physics GLL" ||
+                   grid_name == "Physics GLL Cost" ||
                    grid_name == "Point Grid") {
           this_grid_topo_file_fnames.push_back("PHIS_d");
           this_grid_topo_eamxx_fnames.push_back(fname);
@@ -1160,6 +1227,12 @@ void AtmosphereDriver::set_initial_conditions ()
     }
   }
 
+  // Fields from the IC file are not read right away. Instead, we gather them all
+  // in a loader, which opens the file and sets up all decompositions before reading.
+  MultiFileInput ic_loader(m_atm_comm);
+  ic_loader.set_logger(m_atm_logger);
+  std::vector<Field> fields_from_file;
+
   // If a filename is specified, use it to load inputs on all grids
   if (ic_pl.isParameter("Filename")) {
     // Now loop over all grids, and load from file the needed fields on each grid (if any).
@@ -1168,7 +1241,12 @@ void AtmosphereDriver::set_initial_conditions ()
     for (const auto& it : m_field_mgrs) {
       const auto& grid_name = it.first;
       if (not m_iop) {
-        read_fields_from_file (ic_fields_names[grid_name],it.second->get_grid(),file_name,m_current_ts);
+        std::vector<Field> fields;
+        for (const auto& fn : ic_fields_names[grid_name]) {
+          fields.push_back(it.second->get_field(fn));
+        }
+        ic_loader.add_fields(file_name,it.second->get_grid(),fields);
+        fields_from_file.insert(fields_from_file.end(),fields.begin(),fields.end());
       } else {
         // For IOP enabled, we load from file and copy data from the closest
         // lat/lon column to every other column
@@ -1180,6 +1258,12 @@ void AtmosphereDriver::set_initial_conditions ()
     }
   }
 
+  // Now read all the IC fields, and set their initial time stamp
+  ic_loader.read_all();
+  for (auto& f : fields_from_file) {
+    f.get_header().get_tracking().update_time_stamp(m_current_ts);
+  }
+
   // If there were any fields that needed to be copied per the input yaml file, now we copy them.
   m_atm_logger->debug("    [EAMxx] Processing fields to copy ...");
   for (const auto& tgt_fid : ic_fields_to_copy) {
@@ -1240,21 +1324,31 @@ void AtmosphereDriver::set_initial_conditions ()
     m_atm_logger->info("    [EAMxx] Reading topography from file ...");
     const auto& file_name = ic_pl.get<std::string>("topography_filename");
     m_atm_logger->info("        filename: " + file_name);
+    MultiFileInput topo_loader(m_atm_comm);
+    topo_loader.set_logger(m_atm_logger);
+    std::vector<Field> topo_fields;
     for (const auto& it : m_field_mgrs) {
       const auto& grid_name = it.first;
       if (not m_iop) {
         // Topography files always use "ncol_d" for the GLL grid value of ncol.
         // To ensure we read in the correct value, we must change the name for that dimension
         auto io_grid = it.second->get_grid();
-        if (grid_name=="Physics GLL") {
+        if (grid_name=="Physics GLL" or grid_name=="Physics GLL Cost") {
           using namespace ShortFieldTagsNames;
           auto grid = io_grid->clone(io_grid->name(),true);
           grid->reset_field_tag_name(COL,"ncol_d");
           io_grid = grid;
         }
-        read_fields_from_file (topography_file_fields_names[grid_name],
-                               topography_eamxx_fields_names[grid_name],
-                               io_grid,file_name,m_current_ts);
+        // Note: alias the fields, so that their name matches the one in the file
+        const auto& fm = it.second;
+        const auto& nc_names = topography_file_fields_names[grid_name];
+        const auto& eamxx_names = topography_eamxx_fields_names[grid_name];
+        std::vector<Field> fields;
+        for (size_t i=0; i<nc_names.size(); ++i) {
+          fields.push_back(fm->get_field(eamxx_names[i]).alias(nc_names[i]));
+        }
+        topo_loader.add_fields(file_name,io_grid,fields);
+        topo_fields.insert(topo_fields.end(),fields.begin(),fields.end());
       } else {
         // For IOP enabled, we load from file and copy data from the closest
         // lat/lon column to every other column
@@ -1265,6 +1359,12 @@ void AtmosphereDriver::set_initial_conditions ()
                                              it.second);
       }
     }
+    // NOTE: aliased fields share the tracking with the original field, so the
+    //       time stamp of the field in the field manager is updated too.
+    topo_loader.read_all();
+    for (auto& f : topo_fields) {
+      f.get_header().get_tracking().update_time_stamp(m_current_ts);
+    }
     // Store in provenance list, for later usage in output file metadata
     m_atm_params.sublist("provenance").set("topography_file",file_name);
     m_atm_logger->debug("    [EAMxx] Processing topography from file ... done!");
@@ -1672,6 +1772,8 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
 
   // Finalize, and then destroy all atmosphere processes
   if (m_atm_process_group.get()) {
+    write_perf_reports();
+    write_load_imbalance_report();
     m_atm_process_group->finalize( /* inputs ? */ );
     m_atm_process_group = nullptr;
   }
@@ -1694,6 +1796,12 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     it.second->clean_up();
   }
 
+  // Write the timeline trace (if enabled on this rank)
+  if (is_timeline_tracing_enabled()) {
+    const auto& driver_options_pl = m_atm_params.sublist("driver_options");
+    write_timeline_trace(m_atm_comm,driver_options_pl.get<std::string>("timeline_trace_file_prefix","eamxx_trace"));
+  }
+
   // Write all timers to file, and possibly finalize gptl
   if (not m_gptl_externally_handled) {
     write_timers_to_file (m_atm_comm,"scream_timing.txt");
@@ -1721,6 +1829,142 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
   stop_timer("EAMxx::finalize");
 }
 
+void AtmosphereDriver::write_perf_reports () {
+  std::vector<AtmosphereProcess::PerfReport> reports;
+  m_atm_process_group->gather_perf_reports(reports);
+  if (reports.size()==0) {
+    return;
+  }
+
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  const auto filename = driver_options_pl.get<std::string>("perf_counters_filename","eamxx_perf_counters.csv");
+  if (m_atm_comm.am_i_root()) {
+    std::ofstream ofs (filename);
+    EKAT_REQUIRE_MSG (ofs.good(),
+        "Error! Could not open file for perf counters report.\n"
+        " - filename: " + filename + "\n");
+    ofs << "process,nsteps,bytes_per_step,kernels_per_step,time_per_step[s],bandwidth[GB/s],time_per_kernel[us]\n";
+    ofs << std::setprecision(6);
+    for (const auto& r : reports) {
+      const double time_per_kernel = r.kernels_per_step>0 ? 1e6*r.time_per_step/r.kernels_per_step : 0;
+      ofs << r.name << ","
+          << r.nsteps << ","
+          << r.bytes_per_step << ","
+          << r.kernels_per_step << ","
+          << r.time_per_step << ","
+          << r.bandwidth << ","
+          << time_per_kernel << "\n";
+    }
+  }
+  m_atm_logger->info("[EAMxx] Per-process performance counters written to " + filename);
+}
+
+void AtmosphereDriver::write_load_imbalance_report () {
+  using vos_t = std::vector<std::string>;
+
+  auto& driver_options_pl = m_atm_params.sublist("driver_options");
+  if (not driver_options_pl.get<bool>("enable_load_imbalance_analysis",false)) {
+    return;
+  }
+
+  // If no timer is specified, analyze the run timers of all atm processes
+  auto timers = driver_options_pl.get<vos_t>("load_imbalance_timers",{});
+  if (timers.size()==0) {
+    m_atm_process_group->gather_run_timers(timers);
+  }
+  const int num_slowest = driver_options_pl.get<int>("load_imbalance_num_slowest_ranks",3);
+
+  // The number of physics columns is our measure of the work assigned to each rank
+  const auto phys_grid = m_grids_manager->get_grid("Physics");
+  const int ncols = phys_grid->get_num_local_dofs();
+
+  std::vector<double> my_times;
+  m_atm_logger->info("[EAMxx] Load imbalance across ranks (times in seconds):");
+  for (const auto& t : timers) {
+    my_times.push_back(get_timer_wallclock(t));
+    if (my_times.back()==0) {
+      m_atm_logger->warn("  [EAMxx] Timer '" + t + "' was not used on this rank after the driver init.");
+    }
+    const auto stats = compute_load_imbalance(m_atm_comm,my_times.back(),ncols,num_slowest);
+
+    std::stringstream ss;
+    ss << std::setprecision(4)
+       << "  " << t << ": min=" << stats.min << ", mean=" << stats.mean << ", max=" << stats.max
+       << ", max/mean=" << stats.imbalance << ", corr(time,ncols)=" << stats.work_correlation
+       << ", slowest ranks:";
+    for (size_t i=0; i<stats.slowest_ranks.size(); ++i) {
+      ss << " " << stats.slowest_ranks[i] << " (" << stats.slowest_costs[i] << ")";
+    }
+    m_atm_logger->info(ss.str());
+  }
+
+  // Optionally, write the time per column of each timer to file, to correlate
+  // the cost with the location. The cost is uniform across the columns of a rank.
+  const auto filename = driver_options_pl.get<std::string>("load_imbalance_cost_file","none");
+  if (filename=="none") {
+    return;
+  }
+
+  using gid_type = AbstractGrid::gid_type;
+
+  scorpio::register_file(filename,scorpio::Write);
+  scorpio::define_dim(filename,"ncol",phys_grid->get_num_global_dofs());
+
+  auto gids = phys_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  const auto min_gid = phys_grid->get_global_min_dof_gid();
+  std::vector<scorpio::offset_t> offsets(ncols);
+  for (int icol=0; icol<ncols; ++icol) {
+    offsets[icol] = gids(icol) - min_gid;
+  }
+  scorpio::set_dim_decomp(filename,"ncol",offsets);
+
+  // Timer names contain characters that are not valid in NetCDF var names
+  auto var_name = [](const std::string& timer) {
+    std::string name;
+    for (char c : timer) {
+      if (std::isalnum(static_cast<unsigned char>(c))) {
+        name += c;
+      } else if (name.size()>0 and name.back()!='_') {
+        name += '_';
+      }
+    }
+    return name;
+  };
+  std::vector<std::string> geo_names;
+  for (std::string gn : {"lat","lon"}) {
+    if (phys_grid->has_geometry_data(gn)) {
+      geo_names.push_back(gn);
+      scorpio::define_var(filename,gn,"degrees",{"ncol"},"double","double");
+    }
+  }
+  scorpio::define_var(filename,"rank","",{"ncol"},"int","int");
+  for (const auto& t : timers) {
+    scorpio::define_var(filename,var_name(t),"s",{"ncol"},"double","double");
+    scorpio::set_attribute(filename,var_name(t),"long_name","time per column of timer " + t);
+  }
+  scorpio::enddef(filename);
+
+  std::vector<double> data(ncols);
+  for (const auto& gn : geo_names) {
+    auto geo = phys_grid->get_geometry_data(gn);
+    geo.sync_to_host();
+    auto geo_h = geo.get_view<const Real*,Host>();
+    for (int icol=0; icol<ncols; ++icol) {
+      data[icol] = geo_h(icol);
+    }
+    scorpio::write_var(filename,gn,data.data());
+  }
+  std::vector<int> rank(ncols,m_atm_comm.rank());
+  scorpio::write_var(filename,"rank",rank.data());
+  for (size_t i=0; i<timers.size(); ++i) {
+    std::fill(data.begin(),data.end(),ncols>0 ? my_times[i]/ncols : 0);
+    scorpio::write_var(filename,var_name(timers[i]),data.data());
+  }
+  scorpio::release_file(filename);
+
+  m_atm_logger->info("[EAMxx] Per-column cost proxies written to " + filename);
+}
+
 AtmosphereDriver::field_mgr_ptr
 AtmosphereDriver::get_field_mgr (const std::string& grid_name) const {
   EKAT_REQUIRE_MSG (m_ad_status & s_grids_created,
@@ -172,9 +172,18 @@ protected:
 
   void report_res_dep_memory_footprint () const;
 
+  // Write the perf counters of all atm procs that enabled them to a csv file
+  void write_perf_reports ();
+
+  // Analyze the imbalance across ranks of selected timers (if enabled), and
+  // optionally write per-column cost proxies to a file on the physics grid
+  void write_load_imbalance_report ();
+
   void create_logger ();
   void set_initial_conditions ();
   void restart_model ();
+  // Restart from raw per-rank data written by NodeLocalCheckpoint
+  void restart_model_from_node_local_checkpoint (const std::string& manifest);
 
   // Read fields from a file when the names of the fields in
   // EAMxx do not match exactly with the .nc file. Example is
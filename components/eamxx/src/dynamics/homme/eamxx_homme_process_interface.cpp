@@ -897,15 +897,21 @@ void HommeDynamics::init_homme_views () {
   using omega_type = std::remove_reference<decltype(derived.m_omega_p)>::type;
   derived.m_omega_p = omega_type(omega_in.data(),nelem);
 
+  // The tracers views alias EAMxx fields, which are stored in Real
+  static_assert(std::is_same<Homme::StorageScalar,Homme::Scalar>::value,
+                "Error! HOMMEXX_MIXED_PRECISION is not supported in EAMxx.\n");
+
   // Tracers mixing ratio
   auto q_in = m_helper_fields.at("Q_dyn").template get_view<Homme::Scalar**[NP][NP][NVL]>();
   using q_type = std::remove_reference<decltype(tracers.Q)>::type;
   tracers.Q = q_type(q_in.data(),nelem,qsize);
 
   // Tracers mass
+  // Note: Qdp_dyn is created before the number of tracers is known, so it is sized
+  //       with QSIZE_D. Homme only loops over the first qsize tracers.
   auto qdp_in = m_helper_fields.at("Qdp_dyn").template get_view<Homme::Scalar*[QTL][QSZ][NP][NP][NVL]>();
   using qdp_type = std::remove_reference<decltype(tracers.qdp)>::type;
-  tracers.qdp = qdp_type(qdp_in.data(),nelem);
+  tracers.qdp = qdp_type(qdp_in.data(),nelem,QTL,QSZ);
 
   // Tracers forcing
   auto fq_in = m_helper_fields.at("FQ_dyn").template get_view<Homme::Scalar**[NP][NP][NVL]>();
@@ -15,6 +15,8 @@
 #include "share/grid/se_grid.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/grid/remap/inverse_remapper.hpp"
+#include "share/grid/remap/composed_remapper.hpp"
+#include "share/grid/remap/redistribution_remapper.hpp"
 
 // Get all Homme's compile-time dims and constants
 #include "homme_dimensions.hpp"
@@ -82,8 +84,26 @@ HommeGridsManager::do_create_remapper (const grid_ptr_type from_grid,
     } else {
       return std::make_shared<InverseRemapper>(pd_remapper);
     }
+  } else if (from=="Physics GLL Cost" || to=="Physics GLL Cost") {
+    // Columns are first moved to the rank that owns them in the dyn-aligned
+    // GLL decomposition, and then remapped to the dyn grid as usual.
+    using PDR = PhysicsDynamicsRemapper;
+    using RR  = RedistributionRemapper;
+
+    auto dyn_grid  = get_grid("Dynamics");
+    auto gll_grid  = get_grid("Physics GLL");
+    auto cost_grid = get_grid("Physics GLL Cost");
+
+    auto redist_remapper = std::make_shared<RR>(cost_grid,gll_grid);
+    auto pd_remapper = std::make_shared<PDR>(gll_grid,dyn_grid);
+    auto remapper = std::make_shared<ComposedRemapper>(redist_remapper,pd_remapper);
+    if (p2d) {
+      return remapper;
+    } else {
+      return std::make_shared<InverseRemapper>(remapper);
+    }
   } else {
-    ekat::error::runtime_abort("Error! P-D remapping only implemented for 'Physics GLL' phys grid.\n");
+    ekat::error::runtime_abort("Error! P-D remapping only implemented for 'Physics GLL' and 'Physics GLL Cost' phys grids.\n");
   }
   return nullptr;
 }
@@ -95,10 +115,17 @@ build_grids ()
   const ci_string pg_type      = m_params.get<std::string>("physics_grid_type");
   const ci_string pg_rebalance = m_params.get<std::string>("physics_grid_rebalance","None");
 
+  // The cost-balanced decomposition is built in C++ on top of the GLL grid,
+  // and the phys-dyn transfer goes through the GLL grid. Other pg types
+  // are remapped inside Homme, so they can only use the f90 decompositions.
+  EKAT_REQUIRE_MSG (pg_rebalance!="Cost" or pg_type=="GLL",
+      "Error! Cost-balanced physics grid only available for GLL physics grid type.\n"
+      "  - physics_grid_type: " + pg_type + "\n");
+
   // Get the physics grid code
   std::vector<int> pg_codes {
     m_pg_codes["GLL"]["None"],  // We always need this to read/write dyn grid stuff
-    m_pg_codes[pg_type][pg_rebalance]
+    m_pg_codes[pg_type][pg_rebalance=="Cost" ? ci_string("None") : pg_rebalance]
   };
   // In case the two pg codes are the same...
   auto it = std::unique(pg_codes.begin(),pg_codes.end());
@@ -203,6 +230,11 @@ build_physics_grid (const ci_string& type, const ci_string& rebalance) {
     return;
   }
 
+  if (rebalance=="Cost") {
+    build_cost_balanced_physics_grid (type);
+    return;
+  }
+
   if (type=="PG2") {
     fvphyshack = true;
   }
@@ -302,6 +334,30 @@ build_physics_grid (const ci_string& type, const ci_string& rebalance) {
   add_grid(phys_grid);
 }
 
+void HommeGridsManager::
+build_cost_balanced_physics_grid (const ci_string& type) {
+  // The cost of each column is read from file, on the non-rebalanced grid
+  const std::string src_name = "Physics " + type;
+  const auto src_grid = get_grid(src_name);
+
+  const auto& cost_file = m_params.get<std::string>("physics_grid_cost_file","none");
+  const auto& cost_var  = m_params.get<std::string>("physics_grid_cost_var","none");
+  EKAT_REQUIRE_MSG (cost_file!="none" and cost_var!="none",
+      "Error! Cost-balanced physics grid requires a cost file and variable name.\n"
+      "  Please, set 'physics_grid_cost_file' and 'physics_grid_cost_var'.\n");
+
+  using namespace ekat::units;
+  Field cost (FieldIdentifier(cost_var,src_grid->get_2d_scalar_layout(),s,src_name));
+  cost.allocate_view();
+  AtmosphereInput cost_reader (cost_file,src_grid,{cost});
+  cost_reader.read_variables();
+  cost_reader.finalize();
+
+  auto phys_grid = create_cost_balanced_grid(src_name + " Cost",src_grid,cost);
+  phys_grid->m_short_name = type;
+  add_grid(phys_grid);
+}
+
 void HommeGridsManager::
 initialize_vertical_coordinates (const nonconstgrid_ptr_type& dyn_grid) {
   using view_1d_host = AtmosphereInput::view_1d_host;
@@ -378,6 +434,8 @@ build_pg_codes () {
   //  - X denotes the column rebalance choice:
   //    - 0: no rebalance
   //    - 1: twin columns rebalance
+  // NOTE: the "Cost" rebalance is done in C++ (see build_cost_balanced_physics_grid),
+  //       on top of the non-rebalanced grid, so it has no f90 code
   //  - Y denotes the type of physics grid:
   //    - 0: GLL grid
   //    - N: FV phys grid, with NxN points
@@ -30,6 +30,7 @@ protected:
   void build_dynamics_grid ();
   void build_physics_grid  (const ci_string& type,
                             const ci_string& rebalance);
+  void build_cost_balanced_physics_grid (const ci_string& type);
 
 protected:
 
@@ -27,6 +27,8 @@ Nudging::Nudging (const ekat::Comm& comm, const ekat::ParameterList& params)
       "nudging_refine_remap_mapfile", "no-file-given");
   m_refine_remap_vert_cutoff = m_params.get<Real>(
       "nudging_refine_remap_vert_cutoff", 0.0);
+  m_refine_remap_at_data_update = m_params.get<bool>(
+      "nudging_refine_remap_at_data_update", false);
   auto src_pres_type = m_params.get<std::string>("source_pressure_type","TIME_DEPENDENT_3D_PROFILE");
   if (src_pres_type=="TIME_DEPENDENT_3D_PROFILE") {
     m_src_pres_type = TIME_DEPENDENT_3D_PROFILE;
@@ -160,6 +162,8 @@ void Nudging::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
     }
     // Set m_refine_remap to false
     m_refine_remap = false;
+    // Without horiz remap, there's nothing to save by remapping time slices
+    m_refine_remap_at_data_update = false;
   }
 }
 // =========================================================================================
@@ -236,28 +240,46 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   const auto layout_ext = grid_ext->get_3d_scalar_layout(true);
   const auto layout_tmp = grid_tmp->get_3d_scalar_layout(true);
   const auto layout_atm = m_grid->get_3d_scalar_layout(true);
+
+  // Create the copy of the field after horiz interp (alias "ext" if no remap),
+  // and register the fields with the remapper. If we remap at data update,
+  // the remapper works on the two time slices, and the time interpolation is
+  // performed after the horiz remap (which is linear, so the order is irrelevant).
+  auto setup_horiz_remap = [&](const std::string& name, const Field& field_ext,
+                               const FieldLayout& layout_tmp) {
+    const std::string name_tmp = name + "_tmp";
+    m_horiz_remap_fields.push_back(name);
+    if (not m_refine_remap) {
+      m_helper_fields[name_tmp] = field_ext.alias(name_tmp);
+      m_horiz_remapper->register_field(field_ext, m_helper_fields[name_tmp]);
+      return;
+    }
+
+    auto field_tmp = create_helper_field(name_tmp, layout_tmp, grid_tmp->name());
+    if (m_refine_remap_at_data_update) {
+      const auto& layout_ext = field_ext.get_header().get_identifier().get_layout();
+      for (std::string slice : {"0","1"}) {
+        auto ext = create_helper_field(name + "_ext" + slice, layout_ext, grid_ext->name());
+        auto tmp = create_helper_field(name_tmp + slice, layout_tmp, grid_tmp->name());
+        m_horiz_remapper->register_field(ext, tmp);
+      }
+    } else {
+      m_horiz_remapper->register_field(field_ext, field_tmp);
+    }
+  };
+
   m_horiz_remapper->registration_begins();
   for (auto name : m_fields_nudge) {
     std::string name_ext = name + "_ext";
-    std::string name_tmp = name + "_tmp";
 
     // First copy of the field: what's read from file, and time-interpolated.
     auto field_ext = create_helper_field(name_ext, layout_ext, grid_ext->name());
 
-    // Second copy of the field: after horiz interp (alias "ext" if no remap)
-    Field field_tmp;
-    if (m_refine_remap) {
-      field_tmp = create_helper_field(name_tmp, layout_tmp, grid_tmp->name());
-    } else {
-      field_tmp = field_ext.alias(name_tmp);
-      m_helper_fields[name_tmp] = field_tmp;
-    }
-
     // Add the field to the time interpolator
     m_time_interp.add_field(field_ext.alias(name), true);
 
-    // Register the fields with the remapper
-    m_horiz_remapper->register_field(field_ext, field_tmp);
+    // Second copy of the field: after horiz interp
+    setup_horiz_remap(name, field_ext, layout_tmp);
 
     if (m_timescale>0) {
       // Third copy of the field: after vert interpolation.
@@ -280,14 +302,7 @@ void Nudging::initialize_impl (const RunType /* run_type */)
     // If the pressure profile is 3d and time-dep, we need to interpolate (in time/horiz)
     auto pmid_ext = create_helper_field("p_mid_ext", layout_ext, grid_ext->name());
     m_time_interp.add_field(pmid_ext.alias("p_mid"),true);
-    Field pmid_tmp;
-    if (m_refine_remap) {
-      pmid_tmp = create_helper_field("p_mid_tmp", layout_tmp, grid_tmp->name());
-    } else {
-      pmid_tmp = pmid_ext.alias("p_mid_tmp");
-      m_helper_fields["p_mid_tmp"] = pmid_tmp;
-    }
-    m_horiz_remapper->register_field(pmid_ext,pmid_tmp);
+    setup_horiz_remap("p_mid", pmid_ext, layout_tmp);
     create_helper_field("padded_p_mid_tmp",layout_padded,"");
   } else if (m_src_pres_type == STATIC_1D_VERTICAL_PROFILE) {
     // For static 1D profile, we can read p_mid now
@@ -306,6 +321,7 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   // Close the registration
   m_time_interp.initialize_data_from_files();
   m_horiz_remapper->registration_ends();
+  m_time_slices_remapped = false;
 
   // load nudging weights from file
   // NOTE: the regional nudging use the same grid as the run, no need to
@@ -333,67 +349,32 @@ void Nudging::run_impl (const double dt)
   // end of the full step in scream.
   auto ts = timestamp()+dt;
 
-  // Perform time interpolation
-  m_time_interp.perform_time_interpolation(ts);
-
-  // If the input data contains "masked" values (sometimes also called "filled" values),
-  // the horiz remapping would smear them around. To prevent that, we need to "cure"
-  // these values. Masked values can only happen at top/bot of the model (with top
-  // being not common), and they must be a contiguous set of entries. So to cure them,
-  // we simply set all bot/top masked entries equal to the first non-masked value
-  // from the bot/top respectively. This corresponds to a constant extrapolation.
-  // NOTE: we need to do a tol check, since time interpolation may not return fillValue,
-  //       even if both f(t_beg)/f(t_end) are equal to fillValue (due to rounding).
-  // NOTE: if f(t_beg)==fillValue!=f(t_end), or viceversa, the time-interpolated value can
-  //       substantially differ from fillValue. Here, we assume it didn't happen.
-  auto correct_masked_values = [&](const Field f) {
-    const auto fl = f.get_header().get_identifier().get_layout();
-    const auto v  = f.get_view<Real**>();
-
-    Real var_fill_value = constants::DefaultFillValue<Real>().value;
-    // Query the helper field for the fill value, if not present use default
-    if (f.get_header().has_extra_data("mask_value")) {
-      var_fill_value = f.get_header().get_extra_data<Real>("mask_value");
+  if (m_refine_remap_at_data_update) {
+    // Horiz remap the two time slices only if they changed, then
+    // perform time interpolation on the fine grid
+    if (m_time_interp.update_data(ts) or not m_time_slices_remapped) {
+      remap_time_slices();
     }
+    Real weight0, weight1;
+    m_time_interp.compute_weights(ts,weight0,weight1);
+    for (const auto& name : m_horiz_remap_fields) {
+      auto f = get_helper_field(name+"_tmp");
+      f.deep_copy(get_helper_field(name+"_tmp0"));
+      f.update(get_helper_field(name+"_tmp1"),weight1,weight0);
+    }
+  } else {
+    // Perform time interpolation
+    m_time_interp.perform_time_interpolation(ts);
 
-    const int ncols = fl.dim(0);
-    const int nlevs = fl.dim(1);
-    const auto thresh = std::abs(var_fill_value)*0.0001;
-    auto lambda = KOKKOS_LAMBDA(const int icol) {
-      int first_good = nlevs;
-      int last_good = -1;
-      for (int k=0; k<nlevs; ++k) {
-        if (std::abs(v(icol,k)-var_fill_value)>thresh) {
-          // This entry is substantially different from var_fill_value, so it's good
-          first_good = ekat::impl::min(first_good,k);
-          last_good  = ekat::impl::max(last_good,k);
-        }
-      }
-      EKAT_KERNEL_REQUIRE_MSG (first_good<nlevs and last_good>=0,
-          "[Nudging] Error! Could not locate a non-masked entry in a column.\n");
-
-      // Fix near TOM
-      for (int k=0; k<first_good; ++k) {
-        v(icol,k) = v(icol,first_good);
-      }
-      // Fix near surf
-      for (int k=last_good+1; k<nlevs; ++k) {
-        v(icol,k) = v(icol,last_good);
-      }
-    };
-
-    Kokkos::parallel_for(RangePolicy(0,ncols),lambda);
-  };
+    // Correct before horiz remap
+    for (const auto& name: m_fields_nudge) {
+      correct_masked_values(get_helper_field(name+"_ext"));
+    }
 
-  // Correct before horiz remap
-  for (const auto& name: m_fields_nudge) {
-    const auto f  = get_helper_field(name+"_ext");
-    correct_masked_values(f);
+    // Perform horizontal remap (if needed)
+    m_horiz_remapper->remap(true);
   }
 
-  // Perform horizontal remap (if needed)
-  m_horiz_remapper->remap(true);
-
   // bypass copy_and_pad and vert_interp for skip_vert_interpolation:
   if (m_skip_vert_interpolation) {
     for (const auto& name : m_fields_nudge) {
@@ -538,6 +519,86 @@ void Nudging::run_impl (const double dt)
   }
 }
 
+// =========================================================================================
+void Nudging::correct_masked_values (const Field& f) const
+{
+  // If the input data contains "masked" values (sometimes also called "filled" values),
+  // the horiz remapping would smear them around. To prevent that, we need to "cure"
+  // these values. Masked values can only happen at top/bot of the model (with top
+  // being not common), and they must be a contiguous set of entries. So to cure them,
+  // we simply set all bot/top masked entries equal to the first non-masked value
+  // from the bot/top respectively. This corresponds to a constant extrapolation.
+  // NOTE: we need to do a tol check, since time interpolation may not return fillValue,
+  //       even if both f(t_beg)/f(t_end) are equal to fillValue (due to rounding).
+  // NOTE: if f(t_beg)==fillValue!=f(t_end), or viceversa, the time-interpolated value can
+  //       substantially differ from fillValue. Here, we assume it didn't happen.
+  using KT          = KokkosTypes<DefaultDevice>;
+  using RangePolicy = typename KT::RangePolicy;
+
+  const auto fl = f.get_header().get_identifier().get_layout();
+  const auto v  = f.get_view<Real**>();
+
+  Real var_fill_value = constants::DefaultFillValue<Real>().value;
+  // Query the helper field for the fill value, if not present use default
+  if (f.get_header().has_extra_data("mask_value")) {
+    var_fill_value = f.get_header().get_extra_data<Real>("mask_value");
+  }
+
+  const int ncols = fl.dim(0);
+  const int nlevs = fl.dim(1);
+  const auto thresh = std::abs(var_fill_value)*0.0001;
+  auto lambda = KOKKOS_LAMBDA(const int icol) {
+    int first_good = nlevs;
+    int last_good = -1;
+    for (int k=0; k<nlevs; ++k) {
+      if (std::abs(v(icol,k)-var_fill_value)>thresh) {
+        // This entry is substantially different from var_fill_value, so it's good
+        first_good = ekat::impl::min(first_good,k);
+        last_good  = ekat::impl::max(last_good,k);
+      }
+    }
+    EKAT_KERNEL_REQUIRE_MSG (first_good<nlevs and last_good>=0,
+        "[Nudging] Error! Could not locate a non-masked entry in a column.\n");
+
+    // Fix near TOM
+    for (int k=0; k<first_good; ++k) {
+      v(icol,k) = v(icol,first_good);
+    }
+    // Fix near surf
+    for (int k=last_good+1; k<nlevs; ++k) {
+      v(icol,k) = v(icol,last_good);
+    }
+  };
+
+  Kokkos::parallel_for(RangePolicy(0,ncols),lambda);
+}
+
+// =========================================================================================
+void Nudging::remap_time_slices ()
+{
+  // Copy the time slices of the input data in the remapper src fields.
+  // Unlike the time-interpolated data, each slice contains exactly the
+  // fill value at masked entries, so correcting them is more robust.
+  for (const auto& name : m_horiz_remap_fields) {
+    const bool correct = ekat::contains(m_fields_nudge,name);
+    for (std::string slice : {"0","1"}) {
+      const auto src = slice=="0" ? m_time_interp.get_field_time0(name)
+                                  : m_time_interp.get_field_time1(name);
+      auto ext = get_helper_field(name+"_ext"+slice);
+      ext.deep_copy(src);
+      if (src.get_header().has_extra_data("mask_value")) {
+        ext.get_header().set_extra_data("mask_value",src.get_header().get_extra_data<Real>("mask_value"),true);
+      }
+      if (correct) {
+        correct_masked_values(ext);
+      }
+    }
+  }
+
+  m_horiz_remapper->remap(true);
+  m_time_slices_remapped = true;
+}
+
 // =========================================================================================
 void Nudging::finalize_impl()
 {
@@ -49,6 +49,9 @@ protected:
   // NOTE: this method will handle weighted and cutoff cases as well
   void apply_tendency (Field &state, const Field &nudge, const Real dt) const;
 
+  // Replace masked (i.e., filled) values at top/bot of each column
+  void correct_masked_values (const Field& f) const;
+
 protected:
 
   Field get_field_out_wrap(const std::string& field_name);
@@ -66,6 +69,9 @@ protected:
   // Retrieve a helper field
   Field get_helper_field (const std::string& name) const { return m_helper_fields.at(name); }
 
+  // Correct and horiz-remap the two time slices of the input data
+  void remap_time_slices ();
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Keep track of field dimensions and the iteration count
   int m_num_cols;
@@ -94,6 +100,12 @@ protected:
   std::shared_ptr<scream::AbstractRemapper> m_horiz_remapper;
   // (refining) remapper vertical cutoff
   Real m_refine_remap_vert_cutoff;
+  // if true, remap the two time slices of data only when new data is loaded,
+  // and time-interpolate on the fine grid
+  bool m_refine_remap_at_data_update;
+  bool m_time_slices_remapped;
+  // the input fields that go through the horiz remapper
+  std::vector<std::string> m_horiz_remap_fields;
 
   util::TimeInterpolation m_time_interp;
 }; // class Nudging
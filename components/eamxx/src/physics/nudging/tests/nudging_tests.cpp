@@ -371,37 +371,42 @@ TEST_CASE("nudging_tests") {
     params.set<strvec_t>("nudging_fields",{"U"});
     params.get<std::string>("log_level","warn");
 
-    // Create fm
-    auto fm = create_fm(grid_fine_h);
-    auto U = fm->get_field("U");
-    auto p_mid = fm->get_field("p_mid");
+    // Remapping the time slices or the time-interpolated data must give the same result
+    for (bool at_data_update : {false, true}) {
+      params.set<bool>("nudging_refine_remap_at_data_update",at_data_update);
 
-    // Create and init nudging process
-    auto nudging = create_nudging(comm,params,fm,gm_fine_h,get_t0());
+      // Create fm
+      auto fm = create_fm(grid_fine_h);
+      auto U = fm->get_field("U");
+      auto p_mid = fm->get_field("p_mid");
 
-    // Compute pmid on data grid
-    auto layout_data = grid_data->get_3d_scalar_layout(true);
-    Field p_mid_data(FieldIdentifier("p_mid",layout_data,Pa,grid_data->name()));
-    p_mid_data.allocate_view();
-    compute_field(p_mid_data,get_t0(),comm,0);
+      // Create and init nudging process
+      auto nudging = create_nudging(comm,params,fm,gm_fine_h,get_t0());
 
-    manual_interp(p_mid_data,p_mid);
+      // Compute pmid on data grid
+      auto layout_data = grid_data->get_3d_scalar_layout(true);
+      Field p_mid_data(FieldIdentifier("p_mid",layout_data,Pa,grid_data->name()));
+      p_mid_data.allocate_view();
+      compute_field(p_mid_data,get_t0(),comm,0);
 
-    auto time = get_t0();
-    Field tmp_data = p_mid_data.clone("tmp data");
-    Field tmp_fine = p_mid.clone("tmp fine");
-    for (int n=0; ok and n<nsteps_data; ++n) {
-      // Run nudging
-      nudging->run(dt_data);
+      manual_interp(p_mid_data,p_mid);
 
-      // Compute data on fine grid, by manually interpolating
-      // (recall that nudging runs at t+dt)
-      compute_field(tmp_data,time+dt_data,comm,0);
-      manual_interp(tmp_data,tmp_fine);
+      auto time = get_t0();
+      Field tmp_data = p_mid_data.clone("tmp data");
+      Field tmp_fine = p_mid.clone("tmp fine");
+      for (int n=0; ok and n<nsteps_data; ++n) {
+        // Run nudging
+        nudging->run(dt_data);
 
-      CHECK (views_are_equal(tmp_fine,U));
-      ok &= catch_capture.lastAssertionPassed();
-      time += dt_data;
+        // Compute data on fine grid, by manually interpolating
+        // (recall that nudging runs at t+dt)
+        compute_field(tmp_data,time+dt_data,comm,0);
+        manual_interp(tmp_data,tmp_fine);
+
+        CHECK (views_are_equal(tmp_fine,U));
+        ok &= catch_capture.lastAssertionPassed();
+        time += dt_data;
+      }
     }
     root_print (msg + (ok ? " PASS\n" : " FAIL\n"));
   }
@@ -3,7 +3,10 @@
 
 #include "p3_functions.hpp" // for ETI only but harmless for GPU
 
+#include "share/util/eamxx_node_shared_table.hpp"
+
 #include <fstream>
+#include <vector>
 
 namespace scream {
 namespace p3 {
@@ -15,24 +18,16 @@ namespace p3 {
 
 template <typename S, typename D>
 void Functions<S,D>
-::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
-
-  using DeviceIcetable = typename view_ice_table::non_const_type;
-  using DeviceColtable = typename view_collect_table::non_const_type;
-
-  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
-  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
-
-  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
-  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
-
+::read_ice_lookup_tables(double* ice_table_data, double* collect_table_data) {
   //
-  // read in ice microphysics table into host views
+  // read in ice microphysics table into flat arrays, with the same
+  // (row-major) indexing as the ice and collect table views
   //
 
   std::string filename = std::string(P3C::p3_lookup_base) + std::string(P3C::p3_version);
 
   std::ifstream in(filename);
+  EKAT_REQUIRE_MSG(in.good(), "Could not open " << filename);
 
   // read header
   std::string version, version_val;
@@ -46,25 +41,61 @@ void Functions<S,D>
     for (int ii = 0; ii < P3C::rimsize; ++ii) {
       for (int i = 0; i < P3C::isize; ++i) {
         in >> dum_i >> dum_i;
-        int j_idx = 0;
+        [[maybe_unused]] int j_idx = 0;
         for (int j = 0; j < 15; ++j) {
           in >> dum_s;
           if (j > 1 && j != 10) {
-            ice_table_vals_h(jj, ii, i, j_idx++) = dum_s;
+            *ice_table_data++ = dum_s;
+            ++j_idx;
           }
         }
+        EKAT_ASSERT(j_idx == P3C::ice_table_size);
       }
 
       for (int i = 0; i < P3C::isize; ++i) {
         for (int j = 0; j < P3C::rcollsize; ++j) {
           in >> dum_i >> dum_i;
-          int k_idx = 0;
+          [[maybe_unused]] int k_idx = 0;
           for (int k = 0; k < 6; ++k) {
             in >> dum_s;
             if (k == 3 || k == 4) {
-              collect_table_vals_h(jj, ii, i, j, k_idx++) = std::log10(dum_s);
+              *collect_table_data++ = std::log10(dum_s);
+              ++k_idx;
             }
           }
+          EKAT_ASSERT(k_idx == P3C::collect_table_size);
+        }
+      }
+    }
+  }
+  EKAT_REQUIRE_MSG(not in.fail(), "Bad " << filename << ", file ended before all table entries were read");
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::copy_ice_lookup_tables(const double* ice_table_data, const double* collect_table_data,
+                         view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+
+  using DeviceIcetable = typename view_ice_table::non_const_type;
+  using DeviceColtable = typename view_collect_table::non_const_type;
+
+  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
+  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+
+  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+
+  // The host mirrors may not be LayoutRight, so copy entry by entry
+  for (int jj = 0; jj < P3C::densize; ++jj) {
+    for (int ii = 0; ii < P3C::rimsize; ++ii) {
+      for (int i = 0; i < P3C::isize; ++i) {
+        for (int j = 0; j < P3C::ice_table_size; ++j) {
+          ice_table_vals_h(jj, ii, i, j) = *ice_table_data++;
+        }
+        for (int j = 0; j < P3C::rcollsize; ++j) {
+          for (int k = 0; k < P3C::collect_table_size; ++k) {
+            collect_table_vals_h(jj, ii, i, j, k) = *collect_table_data++;
+          }
         }
       }
     }
@@ -77,6 +108,31 @@ void Functions<S,D>
   collect_table_vals = collect_table_vals_d;
 }
 
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals) {
+  std::vector<double> ice_table_data(ice_table_data_size);
+  std::vector<double> collect_table_data(collect_table_data_size);
+  read_ice_lookup_tables(ice_table_data.data(), collect_table_data.data());
+  copy_ice_lookup_tables(ice_table_data.data(), collect_table_data.data(),
+                         ice_table_vals, collect_table_vals);
+}
+
+template <typename S, typename D>
+void Functions<S,D>
+::init_kokkos_ice_lookup_tables(view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+                                const ekat::Comm& comm, const std::string& cache_dir) {
+  // One rank per node reads (or gets from the cache) both tables in one array
+  const auto reader = [](double* data, const long long) {
+    read_ice_lookup_tables(data, data + ice_table_data_size);
+  };
+  NodeSharedTable table(comm, "p3_ice_lookup_tables", P3C::p3_version,
+                        ice_table_data_size + collect_table_data_size,
+                        reader, cache_dir);
+  copy_ice_lookup_tables(table.data(), table.data() + ice_table_data_size,
+                         ice_table_vals, collect_table_vals);
+}
+
 template <typename S, typename D>
 KOKKOS_FUNCTION
 void Functions<S,D>
@@ -7,6 +7,7 @@
 
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
 
 namespace scream {
 namespace p3 {
@@ -271,6 +272,28 @@ struct Functions
   static void init_kokkos_ice_lookup_tables(
     view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
 
+  // Same as above, but only one rank per node reads the tables, and shares
+  // them with the other ranks on the node. If cache_dir is not empty, the
+  // tables are also stored in (and later read from) a binary cache file.
+  static void init_kokkos_ice_lookup_tables(
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals,
+    const ekat::Comm& comm, const std::string& cache_dir);
+
+  // Number of entries in the ice/collect tables
+  static constexpr int ice_table_data_size =
+    P3C::densize*P3C::rimsize*P3C::isize*P3C::ice_table_size;
+  static constexpr int collect_table_data_size =
+    P3C::densize*P3C::rimsize*P3C::isize*P3C::rcollsize*P3C::collect_table_size;
+
+  // Parse the ice lookup table file into flat (row-major) arrays
+  static void read_ice_lookup_tables(
+    double* ice_table_data, double* collect_table_data);
+
+  // Create the ice/collect table views from the flat arrays
+  static void copy_ice_lookup_tables(
+    const double* ice_table_data, const double* collect_table_data,
+    view_ice_table& ice_table_vals, view_collect_table& collect_table_vals);
+
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
   static void lookup(const Spack& mu_r, const Spack& lamr,
@@ -5,6 +5,8 @@
 #include "physics/share/scream_trcmix.hpp"
 
 #include "share/io/scream_scorpio_interface.hpp"
+#include "share/grid/remap/coarsening_remapper.hpp"
+#include "share/grid/remap/refining_remapper_p2p.hpp"
 #include "share/util/eamxx_fv_phys_rrtmgp_active_gases_workaround.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 #include "share/util/scream_common_physics_functions.hpp"
@@ -70,12 +72,25 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
     m_lon = m_grid->get_geometry_data("lon");
   }
 
+  // Optionally, compute radiation on a coarser grid. The coarsening factor
+  // is implied by the map files (e.g., one coarse column every N physics columns)
+  m_rad_ncol = m_ncol;
+  const auto rad_coarsen_map_file = m_params.get<std::string>("rad_coarsen_map_file","none");
+  const auto rad_refine_map_file  = m_params.get<std::string>("rad_refine_map_file","none");
+  EKAT_REQUIRE_MSG ((rad_coarsen_map_file=="none")==(rad_refine_map_file=="none"),
+      "Error! Running radiation on a coarse grid requires both a coarsening and a refining map file.\n"
+      "  - rad_coarsen_map_file: " + rad_coarsen_map_file + "\n"
+      "  - rad_refine_map_file : " + rad_refine_map_file + "\n");
+  if (rad_coarsen_map_file!="none") {
+    setup_coarse_rad_grid(rad_coarsen_map_file,rad_refine_map_file);
+  }
+
   // Figure out radiation column chunks stats
-  m_col_chunk_size = std::min(m_params.get("column_chunk_size", m_ncol),m_ncol);
-  m_num_col_chunks = (m_ncol+m_col_chunk_size-1) / m_col_chunk_size;
+  m_col_chunk_size = std::min(m_params.get("column_chunk_size", m_rad_ncol),m_rad_ncol);
+  m_num_col_chunks = (m_rad_ncol+m_col_chunk_size-1) / m_col_chunk_size;
   m_col_chunk_beg.resize(m_num_col_chunks+1,0);
   for (int i=0; i<m_num_col_chunks; ++i) {
-    m_col_chunk_beg[i+1] = std::min(m_ncol,m_col_chunk_beg[i] + m_col_chunk_size);
+    m_col_chunk_beg[i+1] = std::min(m_rad_ncol,m_col_chunk_beg[i] + m_col_chunk_size);
   }
   this->log(LogLevel::debug,
             "[RRTMGP::set_grids] Col chunking stats:\n"
@@ -243,6 +258,102 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
   }
 }  // RRTMGPRadiation::set_grids
 
+void RRTMGPRadiation::
+setup_coarse_rad_grid (const std::string& coarsen_map_file,
+                       const std::string& refine_map_file)
+{
+  using gid_type = AbstractGrid::gid_type;
+  using PC = scream::physics::Constants<Real>;
+
+  // NOTE: we compute lat/lon on the coarse grid ourselves (see below)
+  m_rad_coarsen_remapper = std::make_shared<CoarseningRemapper>(m_grid,coarsen_map_file,false,false);
+  m_rad_refine_remapper  = std::make_shared<RefiningRemapperP2P>(m_grid,refine_map_file);
+
+  // The two maps must produce the same coarse grid, with the same decomposition,
+  // since the coarsened inputs and the outputs to be refined live on the same columns
+  auto rad_grid = m_rad_coarsen_remapper->get_tgt_grid();
+  auto coarsen_gids = rad_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto refine_gids  = m_rad_refine_remapper->get_src_grid()->get_dofs_gids().get_view<const gid_type*,Host>();
+  bool same_gids = coarsen_gids.size()==refine_gids.size();
+  for (size_t i=0; same_gids and i<coarsen_gids.size(); ++i) {
+    same_gids = coarsen_gids(i)==refine_gids(i);
+  }
+  int all_same_gids;
+  int my_same_gids = same_gids ? 1 : 0;
+  m_comm.all_reduce(&my_same_gids,&all_same_gids,1,MPI_MIN);
+  EKAT_REQUIRE_MSG (all_same_gids==1,
+      "Error! The radiation coarsening and refining maps yield different coarse grids.\n"
+      "  - coarsening map file: " + coarsen_map_file + "\n"
+      "  - refining map file  : " + refine_map_file + "\n");
+
+  m_rad_ncol = rad_grid->get_num_local_dofs();
+
+  // Averaging lat/lon across the coarse cell would give garbage for cells that
+  // straddle the 0/360 meridian, so coarsen the cartesian coordinates instead
+  auto geo_remapper = std::make_shared<CoarseningRemapper>(m_grid,coarsen_map_file,false,false);
+  const auto nondim = ekat::units::Units::nondimensional();
+  const auto layout = m_grid->get_2d_scalar_layout();
+  m_lat.sync_to_host();
+  m_lon.sync_to_host();
+  auto lat_h = m_lat.get_view<const Real*,Host>();
+  auto lon_h = m_lon.get_view<const Real*,Host>();
+  geo_remapper->registration_begins();
+  for (int dim=0; dim<3; ++dim) {
+    Field xyz (FieldIdentifier("xyz_"+std::to_string(dim),layout,nondim,m_grid->name()));
+    xyz.allocate_view();
+    auto xyz_h = xyz.get_view<Real*,Host>();
+    for (int i=0; i<m_ncol; ++i) {
+      const Real lat = lat_h(i)*PC::Pi/180.0;
+      const Real lon = lon_h(i)*PC::Pi/180.0;
+      xyz_h(i) = dim==0 ? cos(lat)*cos(lon) : (dim==1 ? cos(lat)*sin(lon) : sin(lat));
+    }
+    xyz.sync_to_dev();
+    geo_remapper->register_field_from_src(xyz);
+  }
+  geo_remapper->registration_ends();
+  geo_remapper->remap(true);
+
+  const auto& lat_fid = m_lat.get_header().get_identifier();
+  const auto& lon_fid = m_lon.get_header().get_identifier();
+  const auto rad_layout = rad_grid->get_2d_scalar_layout();
+  m_lat = Field(FieldIdentifier(lat_fid.name(),rad_layout,lat_fid.get_units(),rad_grid->name()));
+  m_lon = Field(FieldIdentifier(lon_fid.name(),rad_layout,lon_fid.get_units(),rad_grid->name()));
+  m_lat.allocate_view();
+  m_lon.allocate_view();
+  auto rad_lat_h = m_lat.get_view<Real*,Host>();
+  auto rad_lon_h = m_lon.get_view<Real*,Host>();
+  std::vector<Field> xyz;
+  for (int dim=0; dim<3; ++dim) {
+    xyz.push_back(geo_remapper->get_tgt_field(dim));
+    xyz.back().sync_to_host();
+  }
+  auto x_h = xyz[0].get_view<const Real*,Host>();
+  auto y_h = xyz[1].get_view<const Real*,Host>();
+  auto z_h = xyz[2].get_view<const Real*,Host>();
+  for (int i=0; i<m_rad_ncol; ++i) {
+    const Real lon = atan2(y_h(i),x_h(i))*180.0/PC::Pi;
+    rad_lat_h(i) = atan2(z_h(i),sqrt(x_h(i)*x_h(i)+y_h(i)*y_h(i)))*180.0/PC::Pi;
+    rad_lon_h(i) = lon<0 ? lon+360.0 : lon;
+  }
+  m_lat.sync_to_dev();
+  m_lon.sync_to_dev();
+
+  this->log(LogLevel::info,
+            "[RRTMGP::set_grids] Radiation runs on a coarse grid:\n"
+            "  - physics grid local columns  : " + std::to_string(m_ncol) + "\n"
+            "  - radiation grid local columns: " + std::to_string(m_rad_ncol) + "\n");
+}
+
+Field& RRTMGPRadiation::get_rad_field_in (const std::string& name)
+{
+  return m_rad_coarsen_remapper ? m_rad_fields.at(name) : get_field_in(name);
+}
+
+Field& RRTMGPRadiation::get_rad_field_out (const std::string& name)
+{
+  return m_rad_coarsen_remapper ? m_rad_fields.at(name) : get_field_out(name);
+}
+
 size_t RRTMGPRadiation::requested_buffer_size_in_bytes() const
 {
   const size_t interface_request =
@@ -590,6 +701,8 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
 
   // Whether or not to do MCICA subcolumn sampling
   m_do_subcol_sampling = m_params.get<bool>("do_subcol_sampling",true);
+  // Whether to generate MCICA subcolumns on the fly, rather than storing a cloud mask
+  m_mcica_on_the_fly = m_params.get<bool>("mcica_on_the_fly",false);
 
   // Initialize yakl
   init_kls();
@@ -640,14 +753,43 @@ void RRTMGPRadiation::initialize_impl(const RunType /* run_type */) {
   // Set property checks for fields in this process
   add_invariant_check<FieldWithinIntervalCheck>(get_field_out("T_mid"),m_grid,100.0, 500.0,false);
 
-  // VMR of n2 and co is currently prescribed as a constant value, read from file
-  if (has_computed_field("n2_volume_mix_ratio",m_grid->name())) {
-    auto n2_vmr = get_field_out("n2_volume_mix_ratio").get_view<Real**>();
-    Kokkos::deep_copy(n2_vmr, m_params.get<double>("n2vmr", 0.7906));
+  // If running on a coarse grid, create copies of our fields on the radiation grid.
+  // Inputs are coarsened before each radiation call, and outputs are refined after it.
+  // Boundary fluxes for conservation checks are computed on the physics grid.
+  if (m_rad_coarsen_remapper) {
+    m_rad_coarsen_remapper->registration_begins();
+    for (const auto& f : get_fields_in()) {
+      m_rad_coarsen_remapper->register_field_from_src(f);
+    }
+    m_rad_coarsen_remapper->registration_ends();
+    for (int i=0; i<m_rad_coarsen_remapper->get_num_fields(); ++i) {
+      const auto& f = m_rad_coarsen_remapper->get_tgt_field(i);
+      m_rad_fields[f.name()] = f;
+    }
+
+    const std::vector<std::string> cons_check_fluxes = {"vapor_flux","water_flux","ice_flux","heat_flux"};
+    m_rad_refine_remapper->registration_begins();
+    for (const auto& f : get_fields_out()) {
+      if (m_rad_fields.count(f.name())==1 or ekat::contains(cons_check_fluxes,f.name())) {
+        continue;
+      }
+      m_rad_refine_remapper->register_field_from_tgt(f);
+    }
+    m_rad_refine_remapper->registration_ends();
+    for (int i=0; i<m_rad_refine_remapper->get_num_fields(); ++i) {
+      const auto& f = m_rad_refine_remapper->get_src_field(i);
+      m_rad_fields[f.name()] = f;
+    }
   }
-  if (has_computed_field("co_volume_mix_ratio",m_grid->name())) {
-    auto co_vmr = get_field_out("co_volume_mix_ratio").get_view<Real**>();
-    Kokkos::deep_copy(co_vmr, m_params.get<double>("covmr", 1.0e-7));
+
+  // VMR of n2 and co is currently prescribed as a constant value, read from file
+  for (const std::string& name : {"n2","co"}) {
+    const auto vmr_name = name + "_volume_mix_ratio";
+    if (has_computed_field(vmr_name,m_grid->name())) {
+      const auto vmr = m_params.get<double>(name + "vmr", name=="n2" ? 0.7906 : 1.0e-7);
+      get_field_out(vmr_name).deep_copy(vmr);
+      get_rad_field_out(vmr_name).deep_copy(vmr);
+    }
   }
 }
 
@@ -663,24 +805,24 @@ void RRTMGPRadiation::run_impl (const double dt) {
   auto h_lon  = m_lon.get_view<const Real*,Host>();
 
   // Get data from the FieldManager
-  auto d_pmid = get_field_in("p_mid").get_view<const Real**>();
-  auto d_pint = get_field_in("p_int").get_view<const Real**>();
-  auto d_pdel = get_field_in("pseudo_density").get_view<const Real**>();
-  auto d_sfc_alb_dir_vis = get_field_in("sfc_alb_dir_vis").get_view<const Real*>();
-  auto d_sfc_alb_dir_nir = get_field_in("sfc_alb_dir_nir").get_view<const Real*>();
-  auto d_sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
-  auto d_sfc_alb_dif_nir = get_field_in("sfc_alb_dif_nir").get_view<const Real*>();
-  auto d_qv = get_field_in("qv").get_view<const Real**>();
-  auto d_qc = get_field_in("qc").get_view<const Real**>();
-  auto d_nc = get_field_in("nc").get_view<const Real**>();
-  auto d_qi = get_field_in("qi").get_view<const Real**>();
-  auto d_cldfrac_tot = get_field_in("cldfrac_tot").get_view<const Real**>();
-  auto d_rel = get_field_in("eff_radius_qc").get_view<const Real**>();
-  auto d_rei = get_field_in("eff_radius_qi").get_view<const Real**>();
-  auto d_surf_lw_flux_up = get_field_in("surf_lw_flux_up").get_view<const Real*>();
+  auto d_pmid = get_rad_field_in("p_mid").get_view<const Real**>();
+  auto d_pint = get_rad_field_in("p_int").get_view<const Real**>();
+  auto d_pdel = get_rad_field_in("pseudo_density").get_view<const Real**>();
+  auto d_sfc_alb_dir_vis = get_rad_field_in("sfc_alb_dir_vis").get_view<const Real*>();
+  auto d_sfc_alb_dir_nir = get_rad_field_in("sfc_alb_dir_nir").get_view<const Real*>();
+  auto d_sfc_alb_dif_vis = get_rad_field_in("sfc_alb_dif_vis").get_view<const Real*>();
+  auto d_sfc_alb_dif_nir = get_rad_field_in("sfc_alb_dif_nir").get_view<const Real*>();
+  auto d_qv = get_rad_field_in("qv").get_view<const Real**>();
+  auto d_qc = get_rad_field_in("qc").get_view<const Real**>();
+  auto d_nc = get_rad_field_in("nc").get_view<const Real**>();
+  auto d_qi = get_rad_field_in("qi").get_view<const Real**>();
+  auto d_cldfrac_tot = get_rad_field_in("cldfrac_tot").get_view<const Real**>();
+  auto d_rel = get_rad_field_in("eff_radius_qc").get_view<const Real**>();
+  auto d_rei = get_rad_field_in("eff_radius_qi").get_view<const Real**>();
+  auto d_surf_lw_flux_up = get_rad_field_in("surf_lw_flux_up").get_view<const Real*>();
   // Output fields
-  auto d_tmid = get_field_out("T_mid").get_view<Real**>();
-  auto d_cldfrac_rad = get_field_out("cldfrac_rad").get_view<Real**>();
+  auto d_tmid = get_rad_field_out("T_mid").get_view<Real**>();
+  auto d_cldfrac_rad = get_rad_field_out("cldfrac_rad").get_view<Real**>();
 
   // Aerosol optics only exist if m_do_aerosol_rad is true, so declare views and copy from FM if so
   using view_3d = Field::view_dev_t<const Real***>;
@@ -689,63 +831,67 @@ void RRTMGPRadiation::run_impl (const double dt) {
   view_3d d_aero_g_sw;
   view_3d d_aero_tau_lw;
   if (m_do_aerosol_rad) {
-    d_aero_tau_sw = get_field_in("aero_tau_sw").get_view<const Real***>();
-    d_aero_ssa_sw = get_field_in("aero_ssa_sw").get_view<const Real***>();
-    d_aero_g_sw   = get_field_in("aero_g_sw"  ).get_view<const Real***>();
-    d_aero_tau_lw = get_field_in("aero_tau_lw").get_view<const Real***>();
+    d_aero_tau_sw = get_rad_field_in("aero_tau_sw").get_view<const Real***>();
+    d_aero_ssa_sw = get_rad_field_in("aero_ssa_sw").get_view<const Real***>();
+    d_aero_g_sw   = get_rad_field_in("aero_g_sw"  ).get_view<const Real***>();
+    d_aero_tau_lw = get_rad_field_in("aero_tau_lw").get_view<const Real***>();
   }
-  auto d_sw_flux_up = get_field_out("SW_flux_up").get_view<Real**>();
-  auto d_sw_flux_dn = get_field_out("SW_flux_dn").get_view<Real**>();
-  auto d_sw_flux_dn_dir = get_field_out("SW_flux_dn_dir").get_view<Real**>();
-  auto d_lw_flux_up = get_field_out("LW_flux_up").get_view<Real**>();
-  auto d_lw_flux_dn = get_field_out("LW_flux_dn").get_view<Real**>();
-  auto d_sw_clnclrsky_flux_up = get_field_out("SW_clnclrsky_flux_up").get_view<Real**>();
-  auto d_sw_clnclrsky_flux_dn = get_field_out("SW_clnclrsky_flux_dn").get_view<Real**>();
-  auto d_sw_clnclrsky_flux_dn_dir = get_field_out("SW_clnclrsky_flux_dn_dir").get_view<Real**>();
-  auto d_sw_clrsky_flux_up = get_field_out("SW_clrsky_flux_up").get_view<Real**>();
-  auto d_sw_clrsky_flux_dn = get_field_out("SW_clrsky_flux_dn").get_view<Real**>();
-  auto d_sw_clrsky_flux_dn_dir = get_field_out("SW_clrsky_flux_dn_dir").get_view<Real**>();
-  auto d_sw_clnsky_flux_up = get_field_out("SW_clnsky_flux_up").get_view<Real**>();
-  auto d_sw_clnsky_flux_dn = get_field_out("SW_clnsky_flux_dn").get_view<Real**>();
-  auto d_sw_clnsky_flux_dn_dir = get_field_out("SW_clnsky_flux_dn_dir").get_view<Real**>();
-  auto d_lw_clnclrsky_flux_up = get_field_out("LW_clnclrsky_flux_up").get_view<Real**>();
-  auto d_lw_clnclrsky_flux_dn = get_field_out("LW_clnclrsky_flux_dn").get_view<Real**>();
-  auto d_lw_clrsky_flux_up = get_field_out("LW_clrsky_flux_up").get_view<Real**>();
-  auto d_lw_clrsky_flux_dn = get_field_out("LW_clrsky_flux_dn").get_view<Real**>();
-  auto d_lw_clnsky_flux_up = get_field_out("LW_clnsky_flux_up").get_view<Real**>();
-  auto d_lw_clnsky_flux_dn = get_field_out("LW_clnsky_flux_dn").get_view<Real**>();
-  auto d_rad_heating_pdel = get_field_out("rad_heating_pdel").get_view<Real**>();
-  auto d_sfc_flux_dir_vis = get_field_out("sfc_flux_dir_vis").get_view<Real*>();
-  auto d_sfc_flux_dir_nir = get_field_out("sfc_flux_dir_nir").get_view<Real*>();
-  auto d_sfc_flux_dif_vis = get_field_out("sfc_flux_dif_vis").get_view<Real*>();
-  auto d_sfc_flux_dif_nir = get_field_out("sfc_flux_dif_nir").get_view<Real*>();
-  auto d_sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real*>();
-  auto d_sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real*>();
-  auto d_cldlow = get_field_out("cldlow").get_view<Real*>();
-  auto d_cldmed = get_field_out("cldmed").get_view<Real*>();
-  auto d_cldhgh = get_field_out("cldhgh").get_view<Real*>();
-  auto d_cldtot = get_field_out("cldtot").get_view<Real*>();
+  auto d_sw_flux_up = get_rad_field_out("SW_flux_up").get_view<Real**>();
+  auto d_sw_flux_dn = get_rad_field_out("SW_flux_dn").get_view<Real**>();
+  auto d_sw_flux_dn_dir = get_rad_field_out("SW_flux_dn_dir").get_view<Real**>();
+  auto d_lw_flux_up = get_rad_field_out("LW_flux_up").get_view<Real**>();
+  auto d_lw_flux_dn = get_rad_field_out("LW_flux_dn").get_view<Real**>();
+  auto d_sw_clnclrsky_flux_up = get_rad_field_out("SW_clnclrsky_flux_up").get_view<Real**>();
+  auto d_sw_clnclrsky_flux_dn = get_rad_field_out("SW_clnclrsky_flux_dn").get_view<Real**>();
+  auto d_sw_clnclrsky_flux_dn_dir = get_rad_field_out("SW_clnclrsky_flux_dn_dir").get_view<Real**>();
+  auto d_sw_clrsky_flux_up = get_rad_field_out("SW_clrsky_flux_up").get_view<Real**>();
+  auto d_sw_clrsky_flux_dn = get_rad_field_out("SW_clrsky_flux_dn").get_view<Real**>();
+  auto d_sw_clrsky_flux_dn_dir = get_rad_field_out("SW_clrsky_flux_dn_dir").get_view<Real**>();
+  auto d_sw_clnsky_flux_up = get_rad_field_out("SW_clnsky_flux_up").get_view<Real**>();
+  auto d_sw_clnsky_flux_dn = get_rad_field_out("SW_clnsky_flux_dn").get_view<Real**>();
+  auto d_sw_clnsky_flux_dn_dir = get_rad_field_out("SW_clnsky_flux_dn_dir").get_view<Real**>();
+  auto d_lw_clnclrsky_flux_up = get_rad_field_out("LW_clnclrsky_flux_up").get_view<Real**>();
+  auto d_lw_clnclrsky_flux_dn = get_rad_field_out("LW_clnclrsky_flux_dn").get_view<Real**>();
+  auto d_lw_clrsky_flux_up = get_rad_field_out("LW_clrsky_flux_up").get_view<Real**>();
+  auto d_lw_clrsky_flux_dn = get_rad_field_out("LW_clrsky_flux_dn").get_view<Real**>();
+  auto d_lw_clnsky_flux_up = get_rad_field_out("LW_clnsky_flux_up").get_view<Real**>();
+  auto d_lw_clnsky_flux_dn = get_rad_field_out("LW_clnsky_flux_dn").get_view<Real**>();
+  auto d_rad_heating_pdel = get_rad_field_out("rad_heating_pdel").get_view<Real**>();
+  auto d_sfc_flux_dir_vis = get_rad_field_out("sfc_flux_dir_vis").get_view<Real*>();
+  auto d_sfc_flux_dir_nir = get_rad_field_out("sfc_flux_dir_nir").get_view<Real*>();
+  auto d_sfc_flux_dif_vis = get_rad_field_out("sfc_flux_dif_vis").get_view<Real*>();
+  auto d_sfc_flux_dif_nir = get_rad_field_out("sfc_flux_dif_nir").get_view<Real*>();
+  auto d_sfc_flux_sw_net = get_rad_field_out("sfc_flux_sw_net").get_view<Real*>();
+  auto d_sfc_flux_lw_dn  = get_rad_field_out("sfc_flux_lw_dn").get_view<Real*>();
+  auto d_cldlow = get_rad_field_out("cldlow").get_view<Real*>();
+  auto d_cldmed = get_rad_field_out("cldmed").get_view<Real*>();
+  auto d_cldhgh = get_rad_field_out("cldhgh").get_view<Real*>();
+  auto d_cldtot = get_rad_field_out("cldtot").get_view<Real*>();
   // Outputs for COSP
-  auto d_dtau067 = get_field_out("dtau067").get_view<Real**>();
-  auto d_dtau105 = get_field_out("dtau105").get_view<Real**>();
-  auto d_sunlit = get_field_out("sunlit").get_view<Real*>();
+  auto d_dtau067 = get_rad_field_out("dtau067").get_view<Real**>();
+  auto d_dtau105 = get_rad_field_out("dtau105").get_view<Real**>();
+  auto d_sunlit = get_rad_field_out("sunlit").get_view<Real*>();
 
   Kokkos::deep_copy(d_dtau067,0.0);
   Kokkos::deep_copy(d_dtau105,0.0);
+  if (m_rad_coarsen_remapper) {
+    get_field_out("dtau067").deep_copy(0.0);
+    get_field_out("dtau105").deep_copy(0.0);
+  }
   // Outputs for AeroCom cloud-top diagnostics
-  auto d_T_mid_at_cldtop = get_field_out("T_mid_at_cldtop").get_view<Real *>();
-  auto d_p_mid_at_cldtop = get_field_out("p_mid_at_cldtop").get_view<Real *>();
+  auto d_T_mid_at_cldtop = get_rad_field_out("T_mid_at_cldtop").get_view<Real *>();
+  auto d_p_mid_at_cldtop = get_rad_field_out("p_mid_at_cldtop").get_view<Real *>();
   auto d_cldfrac_ice_at_cldtop =
-      get_field_out("cldfrac_ice_at_cldtop").get_view<Real *>();
+      get_rad_field_out("cldfrac_ice_at_cldtop").get_view<Real *>();
   auto d_cldfrac_liq_at_cldtop =
-      get_field_out("cldfrac_liq_at_cldtop").get_view<Real *>();
+      get_rad_field_out("cldfrac_liq_at_cldtop").get_view<Real *>();
   auto d_cldfrac_tot_at_cldtop =
-      get_field_out("cldfrac_tot_at_cldtop").get_view<Real *>();
-  auto d_cdnc_at_cldtop = get_field_out("cdnc_at_cldtop").get_view<Real *>();
+      get_rad_field_out("cldfrac_tot_at_cldtop").get_view<Real *>();
+  auto d_cdnc_at_cldtop = get_rad_field_out("cdnc_at_cldtop").get_view<Real *>();
   auto d_eff_radius_qc_at_cldtop =
-      get_field_out("eff_radius_qc_at_cldtop").get_view<Real *>();
+      get_rad_field_out("eff_radius_qc_at_cldtop").get_view<Real *>();
   auto d_eff_radius_qi_at_cldtop =
-      get_field_out("eff_radius_qi_at_cldtop").get_view<Real *>();
+      get_rad_field_out("eff_radius_qi_at_cldtop").get_view<Real *>();
 
   constexpr auto stebol = PC::stebol;
   const auto nlay = m_nlay;
@@ -796,6 +942,11 @@ void RRTMGPRadiation::run_impl (const double dt) {
     shr_orb_decl_c2f(calday, eccen, mvelpp, lambm0,
                      obliqr, &delta, &eccf);
 
+    // If needed, bring the inputs on the radiation grid
+    if (m_rad_coarsen_remapper) {
+      m_rad_coarsen_remapper->remap(true);
+    }
+
     // Precompute VMR for all gases, on all cols, before starting the chunks loop
     //
     // h2o is taken from qv
@@ -810,11 +961,11 @@ void RRTMGPRadiation::run_impl (const double dt) {
       // as a constant value, read from file during init. Skip these.
       if (name=="o3" or name == "n2" or name == "co") continue;
 
-      auto d_vmr = get_field_out(name + "_volume_mix_ratio").get_view<Real**>();
+      auto d_vmr = get_rad_field_out(name + "_volume_mix_ratio").get_view<Real**>();
       if (name == "h2o") {
         // h2o is (wet) mass mixing ratio in FM, otherwise known as "qv", which we've already read in above
         // Convert to vmr
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
+        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_rad_ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int icol = team.league_rank();
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
@@ -830,7 +981,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         );
         // Back out volume mixing ratios
         const auto air_mol_weight = PC::MWdry;
-        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_ncol, m_nlay);
+        const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(m_rad_ncol, m_nlay);
         Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
           const int i = team.league_rank();
           Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlay), [&] (const int& k) {
@@ -1213,7 +1364,7 @@ void RRTMGPRadiation::run_impl (const double dt) {
         auto full_name = name + "_volume_mix_ratio";
 
         // 'o3' is marked as 'Required' rather than 'Computed', so we need to get the proper field
-        auto f = name=="o3" ? get_field_in(full_name) : get_field_out(full_name);
+        auto f = name=="o3" ? get_rad_field_in(full_name) : get_rad_field_out(full_name);
         auto d_vmr = f.get_view<const Real**>();
 
         // Copy to YAKL
@@ -1380,7 +1531,8 @@ void RRTMGPRadiation::run_impl (const double dt) {
         lw_clnsky_flux_up, lw_clnsky_flux_dn,
         sw_bnd_flux_up   , sw_bnd_flux_dn   , sw_bnd_flux_dir      , lw_bnd_flux_up   , lw_bnd_flux_dn,
         eccf, m_atm_logger,
-        m_extra_clnclrsky_diag, m_extra_clnsky_diag
+        m_extra_clnclrsky_diag, m_extra_clnsky_diag,
+        m_mcica_on_the_fly
       );
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
@@ -1402,7 +1554,8 @@ void RRTMGPRadiation::run_impl (const double dt) {
         lw_clnsky_flux_up_k, lw_clnsky_flux_dn_k,
         sw_bnd_flux_up_k, sw_bnd_flux_dn_k, sw_bnd_flux_dir_k, lw_bnd_flux_up_k, lw_bnd_flux_dn_k,
         eccf, m_atm_logger,
-        m_extra_clnclrsky_diag, m_extra_clnsky_diag
+        m_extra_clnclrsky_diag, m_extra_clnsky_diag,
+        m_mcica_on_the_fly
       );
       COMPARE_ALL_WRAP(std::vector<real2d>({
         sw_flux_up, sw_flux_dn, sw_flux_dn_dir, lw_flux_up, lw_flux_dn,
@@ -1714,8 +1867,24 @@ void RRTMGPRadiation::run_impl (const double dt) {
     m_gas_concs_k.concs = gas_concs_k;
     m_gas_concs_k.ncol = orig_ncol_k;
 #endif
+
+    // If needed, bring the outputs back on the physics grid
+    if (m_rad_refine_remapper) {
+      m_rad_refine_remapper->remap(true);
+    }
   } // update_rad
 
+  // The rest happens on the physics grid
+  if (m_rad_coarsen_remapper) {
+    d_pdel = get_field_in("pseudo_density").get_view<const Real**>();
+    d_tmid = get_field_out("T_mid").get_view<Real**>();
+    d_rad_heating_pdel = get_field_out("rad_heating_pdel").get_view<Real**>();
+    d_sw_flux_up = get_field_out("SW_flux_up").get_view<Real**>();
+    d_sw_flux_dn = get_field_out("SW_flux_dn").get_view<Real**>();
+    d_lw_flux_up = get_field_out("LW_flux_up").get_view<Real**>();
+    d_lw_flux_dn = get_field_out("LW_flux_dn").get_view<Real**>();
+  }
+
   // Apply temperature tendency; if we updated radiation this timestep, then d_rad_heating_pdel should
   // contain actual heating rate, not pdel scaled heating rate. Otherwise, if we have NOT updated the
   // radiative heating, then we need to back out the heating from the rad_heating*pdel term that we carry
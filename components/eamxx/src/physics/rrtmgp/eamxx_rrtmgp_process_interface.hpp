@@ -4,9 +4,11 @@
 #include "cpp/rrtmgp/mo_gas_concentrations.h"
 #include "physics/rrtmgp/scream_rrtmgp_interface.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
+#include "share/grid/remap/abstract_remapper.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
 #include <string>
+#include <map>
 
 namespace scream {
 /*
@@ -56,6 +58,14 @@ public:
   Field m_lat;
   Field m_lon;
 
+  // Optionally, radiation runs on a coarser set of columns. If so, inputs are
+  // coarsened before each radiation call, and outputs are refined back.
+  // NOTE: m_lat/m_lon and the column chunks refer to the radiation columns.
+  int m_rad_ncol;
+  std::shared_ptr<AbstractRemapper> m_rad_coarsen_remapper;
+  std::shared_ptr<AbstractRemapper> m_rad_refine_remapper;
+  std::map<std::string,Field>       m_rad_fields;
+
   // Whether we use aerosol forcing in radiation
   bool m_do_aerosol_rad;
   // Whether we do extra aerosol forcing calls
@@ -110,6 +120,9 @@ public:
   // Whether or not to do subcolumn sampling of cloud state for MCICA
   bool m_do_subcol_sampling;
 
+  // Whether to generate MCICA subcolumns inside the subsampling kernel (no cloud mask array)
+  bool m_mcica_on_the_fly;
+
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
     static constexpr int num_1d_ncol        = 10;
@@ -315,6 +328,15 @@ protected:
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager &buffer_manager);
 
+  // Sets up the remappers to/from the coarse radiation grid
+  void setup_coarse_rad_grid (const std::string& coarsen_map_file,
+                              const std::string& refine_map_file);
+
+  // Fields used for the radiation calls: either the process fields,
+  // or their copies on the coarse radiation grid
+  Field& get_rad_field_in  (const std::string& name);
+  Field& get_rad_field_out (const std::string& name);
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 
   // Struct which contains local variables
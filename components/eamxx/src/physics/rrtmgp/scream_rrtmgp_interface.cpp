@@ -193,7 +193,8 @@ OpticalProps1sclK get_cloud_optics_lw(
 #ifdef RRTMGP_ENABLE_YAKL
 OpticalProps2str get_subsampled_clouds(
   const int ncol, const int nlay, const int nbnd, const int ngpt,
-  OpticalProps2str &cloud_optics, GasOpticsRRTMGP &kdist, real2d &cld, real2d &p_lay) {
+  OpticalProps2str &cloud_optics, GasOpticsRRTMGP &kdist, real2d &cld, real2d &p_lay,
+  const bool on_the_fly) {
   // Initialized subsampled optics
   OpticalProps2str subsampled_optics;
   subsampled_optics.init(kdist.get_band_lims_wavenumber(), kdist.get_band_lims_gpoint(), "subsampled_optics");
@@ -212,6 +213,31 @@ OpticalProps2str get_subsampled_clouds(
         cldfrac_rad(icol,ilay) = cld(icol,ilay);
       }
     });
+  // Generate max-random overlap subcolumns on the fly, one (gpt,col) subcolumn per thread,
+  // and assign optical properties right away; same seeds as below, but different random numbers
+  if (on_the_fly) {
+    auto gpoint_bands = kdist.get_gpoint_bands();
+    parallel_for(SimpleBounds<2>(ngpt,ncol), YAKL_LAMBDA(int igpt, int icol) {
+      const int seed = 1e9 * (p_lay(icol,nlay) - int(p_lay(icol,nlay)));
+      const auto ibnd = gpoint_bands(igpt);
+      Real cldx = 0, cldf_above = 0;
+      for (int ilay = 1; ilay <= nlay; ilay++) {
+        cldx = mcica_max_rand_cldx(seed, igpt-1, ilay-1, cldx, cldf_above);
+        cldf_above = cldfrac_rad(icol,ilay);
+        if (cldx > 1.0 - cldf_above) {
+          subsampled_optics.tau(icol,ilay,igpt) = cloud_optics.tau(icol,ilay,ibnd);
+          subsampled_optics.ssa(icol,ilay,igpt) = cloud_optics.ssa(icol,ilay,ibnd);
+          subsampled_optics.g  (icol,ilay,igpt) = cloud_optics.g  (icol,ilay,ibnd);
+        } else {
+          subsampled_optics.tau(icol,ilay,igpt) = 0;
+          subsampled_optics.ssa(icol,ilay,igpt) = 0;
+          subsampled_optics.g  (icol,ilay,igpt) = 0;
+        }
+      }
+    });
+    return subsampled_optics;
+  }
+
   // Get subcolumn cloud mask; note that get_subcolumn_mask exposes overlap assumption as an option,
   // but the only currently supported options are 0 (trivial all-or-nothing cloud) or 1 (max-rand),
   // so overlap has not been exposed as an option beyond this subcolumn. In the future, we should
@@ -246,7 +272,8 @@ OpticalProps2str get_subsampled_clouds(
 #ifdef RRTMGP_ENABLE_KOKKOS
 OpticalProps2strK get_subsampled_clouds(
   const int ncol, const int nlay, const int nbnd, const int ngpt,
-  OpticalProps2strK &cloud_optics, GasOpticsRRTMGPK &kdist, real2dk &cld, real2dk &p_lay) {
+  OpticalProps2strK &cloud_optics, GasOpticsRRTMGPK &kdist, real2dk &cld, real2dk &p_lay,
+  const bool on_the_fly) {
   // Initialized subsampled optics
   OpticalProps2strK subsampled_optics;
   subsampled_optics.init(kdist.get_band_lims_wavenumber(), kdist.get_band_lims_gpoint(), "subsampled_optics");
@@ -264,6 +291,31 @@ OpticalProps2strK get_subsampled_clouds(
       cldfrac_rad(icol,ilay) = cld(icol,ilay);
     }
   });
+  // Generate max-random overlap subcolumns on the fly, one (gpt,col) subcolumn per thread,
+  // and assign optical properties right away; same seeds as below, but different random numbers
+  if (on_the_fly) {
+    auto gpoint_bands = kdist.get_gpoint_bands();
+    Kokkos::parallel_for(conv::get_mdrp<2>({ngpt,ncol}), KOKKOS_LAMBDA(int igpt, int icol) {
+      const int seed = 1e9 * (p_lay(icol,nlay-1) - int(p_lay(icol,nlay-1)));
+      const auto ibnd = gpoint_bands(igpt);
+      Real cldx = 0, cldf_above = 0;
+      for (int ilay = 0; ilay < nlay; ilay++) {
+        cldx = mcica_max_rand_cldx(seed, igpt, ilay, cldx, cldf_above);
+        cldf_above = cldfrac_rad(icol,ilay);
+        if (cldx > 1.0 - cldf_above) {
+          subsampled_optics.tau(icol,ilay,igpt) = cloud_optics.tau(icol,ilay,ibnd);
+          subsampled_optics.ssa(icol,ilay,igpt) = cloud_optics.ssa(icol,ilay,ibnd);
+          subsampled_optics.g  (icol,ilay,igpt) = cloud_optics.g  (icol,ilay,ibnd);
+        } else {
+          subsampled_optics.tau(icol,ilay,igpt) = 0;
+          subsampled_optics.ssa(icol,ilay,igpt) = 0;
+          subsampled_optics.g  (icol,ilay,igpt) = 0;
+        }
+      }
+    });
+    return subsampled_optics;
+  }
+
   // Get subcolumn cloud mask; note that get_subcolumn_mask exposes overlap assumption as an option,
   // but the only currently supported options are 0 (trivial all-or-nothing cloud) or 1 (max-rand),
   // so overlap has not been exposed as an option beyond this subcolumn. In the future, we should
@@ -298,7 +350,8 @@ OpticalProps2strK get_subsampled_clouds(
 #ifdef RRTMGP_ENABLE_YAKL
 OpticalProps1scl get_subsampled_clouds(
   const int ncol, const int nlay, const int nbnd, const int ngpt,
-  OpticalProps1scl &cloud_optics, GasOpticsRRTMGP &kdist, real2d &cld, real2d &p_lay) {
+  OpticalProps1scl &cloud_optics, GasOpticsRRTMGP &kdist, real2d &cld, real2d &p_lay,
+  const bool on_the_fly) {
   // Initialized subsampled optics
   OpticalProps1scl subsampled_optics;
   subsampled_optics.init(kdist.get_band_lims_wavenumber(), kdist.get_band_lims_gpoint(), "subsampled_optics");
@@ -317,6 +370,27 @@ OpticalProps1scl get_subsampled_clouds(
         cldfrac_rad(icol,ilay) = cld(icol,ilay);
       }
     });
+  // Generate max-random overlap subcolumns on the fly, one (gpt,col) subcolumn per thread,
+  // and assign optical properties right away; same seeds as below, but different random numbers
+  if (on_the_fly) {
+    auto gpoint_bands = kdist.get_gpoint_bands();
+    parallel_for(SimpleBounds<2>(ngpt,ncol), YAKL_LAMBDA(int igpt, int icol) {
+      const int seed = 1e9 * (p_lay(icol,nlay-1) - int(p_lay(icol,nlay-1)));
+      const auto ibnd = gpoint_bands(igpt);
+      Real cldx = 0, cldf_above = 0;
+      for (int ilay = 1; ilay <= nlay; ilay++) {
+        cldx = mcica_max_rand_cldx(seed, igpt-1, ilay-1, cldx, cldf_above);
+        cldf_above = cldfrac_rad(icol,ilay);
+        if (cldx > 1.0 - cldf_above) {
+          subsampled_optics.tau(icol,ilay,igpt) = cloud_optics.tau(icol,ilay,ibnd);
+        } else {
+          subsampled_optics.tau(icol,ilay,igpt) = 0;
+        }
+      }
+    });
+    return subsampled_optics;
+  }
+
   // Get subcolumn cloud mask
   int overlap = 1;
   // Get unique seeds for each column that are reproducible across different MPI rank layouts;
@@ -343,7 +417,8 @@ OpticalProps1scl get_subsampled_clouds(
 #ifdef RRTMGP_ENABLE_KOKKOS
 OpticalProps1sclK get_subsampled_clouds(
   const int ncol, const int nlay, const int nbnd, const int ngpt,
-  OpticalProps1sclK &cloud_optics, GasOpticsRRTMGPK &kdist, real2dk &cld, real2dk &p_lay) {
+  OpticalProps1sclK &cloud_optics, GasOpticsRRTMGPK &kdist, real2dk &cld, real2dk &p_lay,
+  const bool on_the_fly) {
   // Initialized subsampled optics
   OpticalProps1sclK subsampled_optics;
   subsampled_optics.init(kdist.get_band_lims_wavenumber(), kdist.get_band_lims_gpoint(), "subsampled_optics");
@@ -361,6 +436,27 @@ OpticalProps1sclK get_subsampled_clouds(
       cldfrac_rad(icol,ilay) = cld(icol,ilay);
     }
   });
+  // Generate max-random overlap subcolumns on the fly, one (gpt,col) subcolumn per thread,
+  // and assign optical properties right away; same seeds as below, but different random numbers
+  if (on_the_fly) {
+    auto gpoint_bands = kdist.get_gpoint_bands();
+    Kokkos::parallel_for(conv::get_mdrp<2>({ngpt,ncol}), KOKKOS_LAMBDA(int igpt, int icol) {
+      const int seed = 1e9 * (p_lay(icol,nlay-2) - int(p_lay(icol,nlay-2)));
+      const auto ibnd = gpoint_bands(igpt);
+      Real cldx = 0, cldf_above = 0;
+      for (int ilay = 0; ilay < nlay; ilay++) {
+        cldx = mcica_max_rand_cldx(seed, igpt, ilay, cldx, cldf_above);
+        cldf_above = cldfrac_rad(icol,ilay);
+        if (cldx > 1.0 - cldf_above) {
+          subsampled_optics.tau(icol,ilay,igpt) = cloud_optics.tau(icol,ilay,ibnd);
+        } else {
+          subsampled_optics.tau(icol,ilay,igpt) = 0;
+        }
+      }
+    });
+    return subsampled_optics;
+  }
+
   // Get subcolumn cloud mask
   int overlap = 1;
   // Get unique seeds for each column that are reproducible across different MPI rank layouts;
@@ -709,7 +805,8 @@ void rrtmgp_main(
   real3d &lw_bnd_flux_up, real3d &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag) {
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const bool mcica_on_the_fly) {
 
 #ifdef SCREAM_RRTMGP_DEBUG
   // Sanity check inputs, and possibly repair
@@ -808,10 +905,10 @@ void rrtmgp_main(
   // This implements the Monte Carlo Independing Column Approximation by mapping only a single
   // subcolumn (cloud state) to each gpoint.
   auto nswgpts = k_dist_sw.get_ngpt();
-  auto clouds_sw_gpt = get_subsampled_clouds(ncol, nlay, nswbands, nswgpts, clouds_sw, k_dist_sw, cldfrac, p_lay);
+  auto clouds_sw_gpt = get_subsampled_clouds(ncol, nlay, nswbands, nswgpts, clouds_sw, k_dist_sw, cldfrac, p_lay, mcica_on_the_fly);
   // Longwave
   auto nlwgpts = k_dist_lw.get_ngpt();
-  auto clouds_lw_gpt = get_subsampled_clouds(ncol, nlay, nlwbands, nlwgpts, clouds_lw, k_dist_lw, cldfrac, p_lay);
+  auto clouds_lw_gpt = get_subsampled_clouds(ncol, nlay, nlwbands, nlwgpts, clouds_lw, k_dist_lw, cldfrac, p_lay, mcica_on_the_fly);
 
   // Copy cloud properties to outputs (is this needed, or can we just use pointers?)
   // Alternatively, just compute and output a subcolumn cloud mask
@@ -879,7 +976,8 @@ void rrtmgp_main(
   real3dk &lw_bnd_flux_up, real3dk &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag) {
+  const bool extra_clnclrsky_diag, const bool extra_clnsky_diag,
+  const bool mcica_on_the_fly) {
 
 #ifdef SCREAM_RRTMGP_DEBUG
   // Sanity check inputs, and possibly repair
@@ -978,10 +1076,10 @@ void rrtmgp_main(
   // This implements the Monte Carlo Independing Column Approximation by mapping only a single
   // subcolumn (cloud state) to each gpoint.
   auto nswgpts = k_dist_sw_k.get_ngpt();
-  auto clouds_sw_gpt = get_subsampled_clouds(ncol, nlay, nswbands, nswgpts, clouds_sw, k_dist_sw_k, cldfrac, p_lay);
+  auto clouds_sw_gpt = get_subsampled_clouds(ncol, nlay, nswbands, nswgpts, clouds_sw, k_dist_sw_k, cldfrac, p_lay, mcica_on_the_fly);
   // Longwave
   auto nlwgpts = k_dist_lw_k.get_ngpt();
-  auto clouds_lw_gpt = get_subsampled_clouds(ncol, nlay, nlwbands, nlwgpts, clouds_lw, k_dist_lw_k, cldfrac, p_lay);
+  auto clouds_lw_gpt = get_subsampled_clouds(ncol, nlay, nlwbands, nlwgpts, clouds_lw, k_dist_lw_k, cldfrac, p_lay, mcica_on_the_fly);
 
   // Copy cloud properties to outputs (is this needed, or can we just use pointers?)
   // Alternatively, just compute and output a subcolumn cloud mask
@@ -114,6 +114,8 @@ extern void compute_broadband_surface_fluxes(
  * Main driver code to run RRTMGP.
  * The input logger is in charge of outputing info to
  * screen and/or to file (or neither), depending on how it was set up.
+ * If mcica_on_the_fly=true, the MCICA subcolumns are generated inside the
+ * subsampling kernel, rather than stored in a (ncol,nlay,ngpt) cloud mask.
  */
 #ifdef RRTMGP_ENABLE_YAKL
 extern void rrtmgp_main(
@@ -137,7 +139,8 @@ extern void rrtmgp_main(
   real3d &lw_bnd_flux_up, real3d &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false);
+  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false,
+  const bool mcica_on_the_fly = false);
 #endif
 #ifdef RRTMGP_ENABLE_KOKKOS
 extern void rrtmgp_main(
@@ -161,7 +164,8 @@ extern void rrtmgp_main(
   real3dk &lw_bnd_flux_up, real3dk &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false);
+  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false,
+  const bool mcica_on_the_fly = false);
 #endif
 
 /*
@@ -233,6 +237,47 @@ int3d get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2d
 int3dk get_subcolumn_mask(const int ncol, const int nlay, const int ngpt, real2dk &cldf, const int overlap_option, int1dk &seeds);
 #endif
 
+/*
+ * Counter-based alternative to get_subcolumn_mask, used when subcolumns are generated
+ * on the fly inside the subsampling kernel (see mcica_on_the_fly in rrtmgp_main).
+ * The random number for (igpt,ilay) only depends on the column seed and on the
+ * (0-based) gpoint and layer indices, so no random number or mask arrays are needed,
+ * and the result does not depend on how columns are distributed/chunked.
+ */
+KOKKOS_INLINE_FUNCTION
+unsigned mcica_hash (unsigned h) {
+  // Finalizer of MurmurHash3 (32 bits)
+  h ^= h >> 16;
+  h *= 0x85ebca6bu;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35u;
+  h ^= h >> 16;
+  return h;
+}
+
+// Uniformly distributed random number in [0,1)
+KOKKOS_INLINE_FUNCTION
+Real mcica_random (const int seed, const int igpt, const int ilay) {
+  unsigned h = static_cast<unsigned>(seed);
+  h = mcica_hash(h ^ (0x9e3779b9u*static_cast<unsigned>(igpt+1)));
+  h = mcica_hash(h ^ (0x7f4a7c15u*static_cast<unsigned>(ilay+1)));
+  return h * (1.0/4294967296.0);
+}
+
+// Maximum-random overlap (eq. (14) in Raisanen et al. 2004, as in get_subcolumn_mask):
+// given the value in the layer above, return the value x for layer ilay; the subcolumn
+// is cloudy in layer ilay iff x > 1 - cldf(ilay). For ilay=0, cldx_above and cldf_above
+// are ignored.
+KOKKOS_INLINE_FUNCTION
+Real mcica_max_rand_cldx (const int seed, const int igpt, const int ilay,
+                          const Real cldx_above, const Real cldf_above) {
+  const Real r = mcica_random(seed,igpt,ilay);
+  if (ilay==0) {
+    return r;
+  }
+  return cldx_above > 1.0 - cldf_above ? cldx_above : r * (1.0 - cldf_above);
+}
+
 /*
  * Compute cloud area from 3d subcol cloud property
  */
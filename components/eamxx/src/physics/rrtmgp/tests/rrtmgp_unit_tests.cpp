@@ -1618,4 +1618,62 @@ TEST_CASE("rrtmgp_aerocom_cloudtop_k") {
 }
 #endif
 
+TEST_CASE("rrtmgp_test_subcol_gen_on_the_fly") {
+  using scream::rrtmgp::mcica_random;
+  using scream::rrtmgp::mcica_max_rand_cldx;
+
+  const int nlay = 4;
+  const int ngpt = 100;
+
+  // Build the cloud mask of one column, as done in the subsampling kernel
+  auto get_mask = [&](const int seed, const Real* cldf, int mask[][nlay]) {
+    for (int igpt = 0; igpt < ngpt; ++igpt) {
+      Real cldx = 0, cldf_above = 0;
+      for (int ilay = 0; ilay < nlay; ++ilay) {
+        cldx = mcica_max_rand_cldx(seed, igpt, ilay, cldx, cldf_above);
+        cldf_above = cldf[ilay];
+        mask[igpt][ilay] = cldx > 1.0 - cldf[ilay] ? 1 : 0;
+      }
+    }
+  };
+
+  int mask[ngpt][nlay];
+  for (int seed = 0; seed < 10; ++seed) {
+    // Random numbers are in [0,1), and only depend on (seed,igpt,ilay)
+    for (int igpt = 0; igpt < ngpt; ++igpt) {
+      for (int ilay = 0; ilay < nlay; ++ilay) {
+        const Real r = mcica_random(seed,igpt,ilay);
+        REQUIRE ((r>=0 and r<1));
+        REQUIRE (r==mcica_random(seed,igpt,ilay));
+      }
+    }
+    REQUIRE (mcica_random(seed,0,0)!=mcica_random(seed+1,0,0));
+    REQUIRE (mcica_random(seed,0,0)!=mcica_random(seed,1,0));
+    REQUIRE (mcica_random(seed,0,0)!=mcica_random(seed,0,1));
+
+    // Fully cloudy/clear layers are cloudy/clear in all subcolumns
+    const Real cldf1[nlay] = {1, 0.5, 0, 1};
+    get_mask(seed,cldf1,mask);
+    for (int igpt = 0; igpt < ngpt; ++igpt) {
+      REQUIRE (mask[igpt][0]==1);
+      REQUIRE (mask[igpt][2]==0);
+      REQUIRE (mask[igpt][3]==1);
+    }
+
+    // Adjacent cloudy layers are maximally overlapped, and the mean
+    // cloud fraction over the subcolumns is (roughly) preserved
+    const Real cldf2[nlay] = {0.5, 0.5, 0, 0};
+    get_mask(seed,cldf2,mask);
+    int ncld = 0;
+    for (int igpt = 0; igpt < ngpt; ++igpt) {
+      if (mask[igpt][0]==1) {
+        REQUIRE (mask[igpt][1]==1);
+      }
+      ncld += mask[igpt][1];
+    }
+    REQUIRE (ncld>ngpt/4);
+    REQUIRE (ncld<3*ngpt/4);
+  }
+}
+
 }
@@ -0,0 +1,127 @@
+#include "shoc_functions.hpp"
+
+#include "ekat/kokkos/ekat_subview_utils.hpp"
+
+namespace scream {
+namespace shoc {
+
+template<>
+void Functions<Real,DefaultDevice>
+::shoc_column_finalize_disp(
+  const Int&                   shcol,
+  const Int&                   nlev,
+  const Int&                   nlevi,
+  const Int&                   npbl,
+  const Scalar&                dtime,
+  const Int&                   nadv,
+  const view_2d<const Spack>&  zt_grid,
+  const view_2d<const Spack>&  zi_grid,
+  const view_2d<const Spack>&  pdel,
+  const view_2d<const Spack>&  pint,
+  const view_2d<const Spack>&  inv_exner,
+  const view_2d<const Spack>&  thetal,
+  const view_2d<const Spack>&  qw,
+  const view_2d<const Spack>&  shoc_ql,
+  const uview_2d<const Spack>& u_wind,
+  const uview_2d<const Spack>& v_wind,
+  const view_2d<const Spack>&  shoc_cldfrac,
+  const view_2d<const Spack>&  rho_zt,
+  const view_2d<const Spack>&  tke,
+  const view_1d<const Scalar>& phis,
+  const view_1d<const Scalar>& uw_sfc,
+  const view_1d<const Scalar>& vw_sfc,
+  const view_1d<const Scalar>& wthl_sfc,
+  const view_1d<const Scalar>& wqw_sfc,
+  const view_1d<const Scalar>& se_b,
+  const view_1d<const Scalar>& ke_b,
+  const view_1d<const Scalar>& wv_b,
+  const view_1d<const Scalar>& wl_b,
+  const WorkspaceMgr&          workspace_mgr,
+  const view_2d<Spack>&        host_dse,
+  const view_1d<Scalar>&       se_a,
+  const view_1d<Scalar>&       ke_a,
+  const view_1d<Scalar>&       wv_a,
+  const view_1d<Scalar>&       wl_a,
+  const view_2d<Spack>&        shoc_qv,
+  const view_1d<Scalar>&       ustar,
+  const view_1d<Scalar>&       kbfs,
+  const view_1d<Scalar>&       obklen,
+  const view_1d<Scalar>&       pblh)
+{
+  using ExeSpace = typename KT::ExeSpace;
+
+  const auto nlev_packs = ekat::npack<Spack>(nlev);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const Int i = team.league_rank();
+
+    auto workspace = workspace_mgr.get_workspace(team);
+
+    const auto zt_grid_s  = ekat::subview(zt_grid, i);
+    const auto zi_grid_s  = ekat::subview(zi_grid, i);
+    const auto thetal_s   = ekat::subview(thetal, i);
+    const auto qw_s       = ekat::subview(qw, i);
+    const auto shoc_ql_s  = ekat::subview(shoc_ql, i);
+    const auto shoc_qv_s  = ekat::subview(shoc_qv, i);
+    const auto u_wind_s   = ekat::subview(u_wind, i);
+    const auto v_wind_s   = ekat::subview(v_wind, i);
+    const auto host_dse_s = ekat::subview(host_dse, i);
+
+    // Use SHOC outputs to update the host model temperature
+    update_host_dse(team, nlev, thetal_s, shoc_ql_s,
+                    ekat::subview(inv_exner, i),
+                    zt_grid_s, phis(i),
+                    host_dse_s);
+
+    team.team_barrier();
+    Scalar se_a_s{0}, ke_a_s{0}, wv_a_s{0}, wl_a_s{0};
+    shoc_energy_integrals(team, nlev, host_dse_s,
+                          ekat::subview(pdel, i),
+                          qw_s, shoc_ql_s, u_wind_s, v_wind_s,
+                          se_a_s, ke_a_s, wv_a_s, wl_a_s);
+
+    shoc_energy_fixer(team, nlev, nlevi, dtime, nadv,
+                      zt_grid_s, zi_grid_s,
+                      se_b(i), ke_b(i), wv_b(i), wl_b(i),
+                      se_a_s, ke_a_s, wv_a_s, wl_a_s,
+                      wthl_sfc(i), wqw_sfc(i),
+                      ekat::subview(rho_zt, i),
+                      ekat::subview(tke, i),
+                      ekat::subview(pint, i),
+                      workspace,
+                      host_dse_s);
+
+    // Update PBLH, as other routines outside of SHOC may require it
+    compute_shoc_vapor(team, nlev, qw_s, shoc_ql_s, shoc_qv_s);
+
+    team.team_barrier();
+    Scalar ustar_s, kbfs_s, obklen_s;
+    shoc_diag_obklen(uw_sfc(i), vw_sfc(i), wthl_sfc(i), wqw_sfc(i),
+                     ekat::scalarize(thetal_s)(nlev-1),
+                     ekat::scalarize(shoc_ql_s)(nlev-1),
+                     ekat::scalarize(shoc_qv_s)(nlev-1),
+                     ustar_s, kbfs_s, obklen_s);
+
+    Scalar pblh_s;
+    pblintd(team, nlev, nlevi, npbl,
+            zt_grid_s, zi_grid_s,
+            thetal_s, shoc_ql_s, shoc_qv_s,
+            u_wind_s, v_wind_s,
+            ustar_s, obklen_s, kbfs_s,
+            ekat::subview(shoc_cldfrac, i),
+            workspace,
+            pblh_s);
+
+    se_a(i)   = se_a_s;
+    ke_a(i)   = ke_a_s;
+    wv_a(i)   = wv_a_s;
+    wl_a(i)   = wl_a_s;
+    ustar(i)  = ustar_s;
+    kbfs(i)   = kbfs_s;
+    obklen(i) = obklen_s;
+    pblh(i)   = pblh_s;
+  });
+}
+
+} // namespace shoc
+} // namespace scream
@@ -0,0 +1,100 @@
+#include "shoc_functions.hpp"
+
+#include "ekat/kokkos/ekat_subview_utils.hpp"
+
+namespace scream {
+namespace shoc {
+
+template<>
+void Functions<Real,DefaultDevice>
+::shoc_column_setup_disp(
+  const Int&                   shcol,
+  const Int&                   nlev,
+  const Int&                   nlevi,
+  const Int&                   npbl,
+  const view_2d<const Spack>&  zt_grid,
+  const view_2d<const Spack>&  zi_grid,
+  const view_2d<const Spack>&  pdel,
+  const view_2d<const Spack>&  thetal,
+  const view_2d<const Spack>&  qw,
+  const view_2d<const Spack>&  shoc_ql,
+  const view_2d<const Spack>&  inv_exner,
+  const uview_2d<const Spack>& u_wind,
+  const uview_2d<const Spack>& v_wind,
+  const view_2d<const Spack>&  shoc_cldfrac,
+  const view_1d<const Scalar>& uw_sfc,
+  const view_1d<const Scalar>& vw_sfc,
+  const view_1d<const Scalar>& wthl_sfc,
+  const view_1d<const Scalar>& wqw_sfc,
+  const WorkspaceMgr&          workspace_mgr,
+  const view_2d<Spack>&        tke,
+  const view_2d<Spack>&        dz_zt,
+  const view_2d<Spack>&        dz_zi,
+  const view_2d<Spack>&        rho_zt,
+  const view_2d<Spack>&        shoc_qv,
+  const view_2d<Spack>&        shoc_tabs,
+  const view_1d<Scalar>&       ustar,
+  const view_1d<Scalar>&       kbfs,
+  const view_1d<Scalar>&       obklen,
+  const view_1d<Scalar>&       pblh)
+{
+  using ExeSpace = typename KT::ExeSpace;
+
+  const auto nlev_packs = ekat::npack<Spack>(nlev);
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+    const Int i = team.league_rank();
+
+    auto workspace = workspace_mgr.get_workspace(team);
+
+    const auto zt_grid_s = ekat::subview(zt_grid, i);
+    const auto zi_grid_s = ekat::subview(zi_grid, i);
+    const auto thetal_s  = ekat::subview(thetal, i);
+    const auto qw_s      = ekat::subview(qw, i);
+    const auto shoc_ql_s = ekat::subview(shoc_ql, i);
+    const auto shoc_qv_s = ekat::subview(shoc_qv, i);
+
+    check_tke(team, nlev, ekat::subview(tke, i));
+
+    shoc_grid(team, nlev, nlevi,
+              zt_grid_s, zi_grid_s,
+              ekat::subview(pdel, i),
+              ekat::subview(dz_zt, i),
+              ekat::subview(dz_zi, i),
+              ekat::subview(rho_zt, i));
+
+    compute_shoc_vapor(team, nlev, qw_s, shoc_ql_s, shoc_qv_s);
+
+    compute_shoc_temperature(team, nlev, thetal_s, shoc_ql_s,
+                             ekat::subview(inv_exner, i),
+                             ekat::subview(shoc_tabs, i));
+
+    // Obukhov length needs the lowest level of shoc_qv
+    team.team_barrier();
+    Scalar ustar_s, kbfs_s, obklen_s;
+    shoc_diag_obklen(uw_sfc(i), vw_sfc(i), wthl_sfc(i), wqw_sfc(i),
+                     ekat::scalarize(thetal_s)(nlev-1),
+                     ekat::scalarize(shoc_ql_s)(nlev-1),
+                     ekat::scalarize(shoc_qv_s)(nlev-1),
+                     ustar_s, kbfs_s, obklen_s);
+
+    Scalar pblh_s;
+    pblintd(team, nlev, nlevi, npbl,
+            zt_grid_s, zi_grid_s,
+            thetal_s, shoc_ql_s, shoc_qv_s,
+            ekat::subview(u_wind, i),
+            ekat::subview(v_wind, i),
+            ustar_s, obklen_s, kbfs_s,
+            ekat::subview(shoc_cldfrac, i),
+            workspace,
+            pblh_s);
+
+    ustar(i)  = ustar_s;
+    kbfs(i)   = kbfs_s;
+    obklen(i) = obklen_s;
+    pblh(i)   = pblh_s;
+  });
+}
+
+} // namespace shoc
+} // namespace scream
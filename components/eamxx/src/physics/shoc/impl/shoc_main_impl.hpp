@@ -408,11 +408,6 @@ void Functions<S,D>::shoc_main_internal(
   const view_2d<Spack>& dz_zt,
   const view_2d<Spack>& dz_zi)
 {
-  // Scalarize some views for single entry access
-  const auto s_thetal  = ekat::scalarize(thetal);
-  const auto s_shoc_ql = ekat::scalarize(shoc_ql);
-  const auto s_shoc_qv = ekat::scalarize(shoc_qv);
-
   // Compute integrals of static energy, kinetic energy, water vapor, and liquid water
   // for the computation of total energy before SHOC is called.  This is for an
   // effort to conserve energy since liquid water potential temperature (which SHOC
@@ -422,45 +417,22 @@ void Functions<S,D>::shoc_main_internal(
 
   for (Int t=0; t<nadv; ++t) {
     // Check TKE to make sure values lie within acceptable
-    // bounds after host model performs horizontal advection
-    check_tke_disp(shcol,nlev, // Input
-                   tke);      // Input/Output
-
-    // Define vertical grid arrays needed for
-    // vertical derivatives in SHOC, also
-    // define air density (rho_zt)
-    shoc_grid_disp(shcol,nlev,nlevi,      // Input
-                   zt_grid,zi_grid,pdel, // Input
-                   dz_zt,dz_zi,rho_zt);  // Output
-
-    // Compute the planetary boundary layer height, which is an
-    // input needed for the length scale calculation.
-
-    // Update SHOC water vapor,
-    // to be used by the next two routines
-    compute_shoc_vapor_disp(shcol,nlev,qw,shoc_ql, // Input
-                            shoc_qv);             // Output
-
-    // Update SHOC temperature
-    compute_shoc_temperature_disp(shcol,nlev,thetal,  // Input
-                                  shoc_ql,inv_exner, // Input
-                                  shoc_tabs);        // Output
-
-    shoc_diag_obklen_disp(shcol, nlev,
-                          uw_sfc,vw_sfc,     // Input
-                          wthl_sfc, wqw_sfc, // Input
-                          s_thetal,  // Input
-                          s_shoc_ql, // Input
-                          s_shoc_qv, // Input
-                          ustar,kbfs,obklen); // Output
-
-    pblintd_disp(shcol,nlev,nlevi,npbl,    // Input
-                 zt_grid,zi_grid,thetal,   // Input
-                 shoc_ql,shoc_qv,u_wind,   // Input
-                 v_wind,ustar,obklen,kbfs, // Input
-                 shoc_cldfrac,             // Input
-                 workspace_mgr,            // Workspace mgr
-                 pblh);                    // Output
+    // bounds after host model performs horizontal advection.
+    // Then define vertical grid arrays needed for vertical
+    // derivatives in SHOC (and air density rho_zt), update SHOC
+    // water vapor and temperature, and compute the planetary
+    // boundary layer height, which is an input needed for the
+    // length scale calculation.
+    // These light stages are fused in a single kernel.
+    shoc_column_setup_disp(shcol,nlev,nlevi,npbl,            // Input
+                           zt_grid,zi_grid,pdel,              // Input
+                           thetal,qw,shoc_ql,inv_exner,       // Input
+                           u_wind,v_wind,shoc_cldfrac,        // Input
+                           uw_sfc,vw_sfc,wthl_sfc,wqw_sfc,    // Input
+                           workspace_mgr,                     // Workspace mgr
+                           tke,                               // Input/Output
+                           dz_zt,dz_zi,rho_zt,shoc_qv,        // Output
+                           shoc_tabs,ustar,kbfs,obklen,pblh); // Output
 
     // Update the turbulent length scale
     shoc_length_disp(shcol,nlev,nlevi,      // Input
@@ -527,20 +499,7 @@ void Functions<S,D>::shoc_main_internal(
   // End SHOC parameterization
 
   // Use SHOC outputs to update the host model
-  // temperature
-  update_host_dse_disp(shcol,nlev,thetal,shoc_ql, // Input
-                       inv_exner,zt_grid,phis,   // Input
-                       host_dse);                // Output
-
-  shoc_energy_integrals_disp(shcol,nlev,host_dse,pdel,  // Input
-                        qw,shoc_ql,u_wind,v_wind, // Input
-                        se_a,ke_a,wv_a,wl_a);     // Output
-
-  shoc_energy_fixer_disp(shcol,nlev,nlevi,dtime,nadv,zt_grid,zi_grid, // Input
-                         se_b,ke_b,wv_b,wl_b,se_a,ke_a,wv_a,wl_a,    // Input
-                         wthl_sfc,wqw_sfc,rho_zt,tke,presi,          // Input
-                         workspace_mgr,                              // Workspace
-                         host_dse);                                  // Output
+  // temperature, and apply the energy fixer.
 
   // Remaining code is to diagnose certain quantities
   // related to PBL.  No answer changing subroutines
@@ -549,23 +508,18 @@ void Functions<S,D>::shoc_main_internal(
   // Update PBLH, as other routines outside of SHOC
   // may require this variable.
 
-  // Update SHOC water vapor, to be used by the next two routines
-  compute_shoc_vapor_disp(shcol,nlev,qw,shoc_ql, // Input
-                          shoc_qv);             // Output
-
-  shoc_diag_obklen_disp(shcol, nlev, uw_sfc,vw_sfc,      // Input
-                        wthl_sfc,wqw_sfc,   // Input
-                        s_thetal,   // Input
-                        s_shoc_ql,  // Input
-                        s_shoc_qv,  // Input
-                        ustar,kbfs,obklen); // Output
-
-  pblintd_disp(shcol,nlev,nlevi,npbl,zt_grid,   // Input
-               zi_grid,thetal,shoc_ql,shoc_qv, // Input
-               u_wind,v_wind,ustar,obklen,     // Input
-               kbfs,shoc_cldfrac,              // Input
-               workspace_mgr,                  // Workspace mgr
-               pblh);                          // Output
+  // All of the above is fused in a single kernel.
+  shoc_column_finalize_disp(shcol,nlev,nlevi,npbl,dtime,nadv,  // Input
+                            zt_grid,zi_grid,pdel,presi,         // Input
+                            inv_exner,thetal,qw,shoc_ql,        // Input
+                            u_wind,v_wind,shoc_cldfrac,         // Input
+                            rho_zt,tke,phis,                    // Input
+                            uw_sfc,vw_sfc,wthl_sfc,wqw_sfc,     // Input
+                            se_b,ke_b,wv_b,wl_b,                // Input
+                            workspace_mgr,                      // Workspace mgr
+                            host_dse,                           // Input/Output
+                            se_a,ke_a,wv_a,wl_a,shoc_qv,        // Output
+                            ustar,kbfs,obklen,pblh);            // Output
 }
 #endif
 
@@ -1205,6 +1205,90 @@ struct Functions
     const view_2d<Spack>&        tkh,
     const view_2d<Spack>&        isotropy);
 #endif
+
+#ifdef SCREAM_SMALL_KERNELS
+  // Fused dispatchers: each runs a sequence of light, column-local stages of
+  // shoc_main inside a single team kernel, so that per-column scalars (and the
+  // inputs shared by the stages) do not round trip through global memory.
+  // The stages are called in the same order (and with the same team barriers)
+  // as in the monolithic kernel, so results are BFB with the unfused dispatchers.
+
+  // check_tke, shoc_grid, compute_shoc_vapor, compute_shoc_temperature,
+  // shoc_diag_obklen, and pblintd
+  static void shoc_column_setup_disp(
+    const Int&                   shcol,
+    const Int&                   nlev,
+    const Int&                   nlevi,
+    const Int&                   npbl,
+    const view_2d<const Spack>&  zt_grid,
+    const view_2d<const Spack>&  zi_grid,
+    const view_2d<const Spack>&  pdel,
+    const view_2d<const Spack>&  thetal,
+    const view_2d<const Spack>&  qw,
+    const view_2d<const Spack>&  shoc_ql,
+    const view_2d<const Spack>&  inv_exner,
+    const uview_2d<const Spack>& u_wind,
+    const uview_2d<const Spack>& v_wind,
+    const view_2d<const Spack>&  shoc_cldfrac,
+    const view_1d<const Scalar>& uw_sfc,
+    const view_1d<const Scalar>& vw_sfc,
+    const view_1d<const Scalar>& wthl_sfc,
+    const view_1d<const Scalar>& wqw_sfc,
+    const WorkspaceMgr&          workspace_mgr,
+    const view_2d<Spack>&        tke,
+    const view_2d<Spack>&        dz_zt,
+    const view_2d<Spack>&        dz_zi,
+    const view_2d<Spack>&        rho_zt,
+    const view_2d<Spack>&        shoc_qv,
+    const view_2d<Spack>&        shoc_tabs,
+    const view_1d<Scalar>&       ustar,
+    const view_1d<Scalar>&       kbfs,
+    const view_1d<Scalar>&       obklen,
+    const view_1d<Scalar>&       pblh);
+
+  // update_host_dse, shoc_energy_integrals, shoc_energy_fixer,
+  // compute_shoc_vapor, shoc_diag_obklen, and pblintd
+  static void shoc_column_finalize_disp(
+    const Int&                   shcol,
+    const Int&                   nlev,
+    const Int&                   nlevi,
+    const Int&                   npbl,
+    const Scalar&                dtime,
+    const Int&                   nadv,
+    const view_2d<const Spack>&  zt_grid,
+    const view_2d<const Spack>&  zi_grid,
+    const view_2d<const Spack>&  pdel,
+    const view_2d<const Spack>&  pint,
+    const view_2d<const Spack>&  inv_exner,
+    const view_2d<const Spack>&  thetal,
+    const view_2d<const Spack>&  qw,
+    const view_2d<const Spack>&  shoc_ql,
+    const uview_2d<const Spack>& u_wind,
+    const uview_2d<const Spack>& v_wind,
+    const view_2d<const Spack>&  shoc_cldfrac,
+    const view_2d<const Spack>&  rho_zt,
+    const view_2d<const Spack>&  tke,
+    const view_1d<const Scalar>& phis,
+    const view_1d<const Scalar>& uw_sfc,
+    const view_1d<const Scalar>& vw_sfc,
+    const view_1d<const Scalar>& wthl_sfc,
+    const view_1d<const Scalar>& wqw_sfc,
+    const view_1d<const Scalar>& se_b,
+    const view_1d<const Scalar>& ke_b,
+    const view_1d<const Scalar>& wv_b,
+    const view_1d<const Scalar>& wl_b,
+    const WorkspaceMgr&          workspace_mgr,
+    const view_2d<Spack>&        host_dse,
+    const view_1d<Scalar>&       se_a,
+    const view_1d<Scalar>&       ke_a,
+    const view_1d<Scalar>&       wv_a,
+    const view_1d<Scalar>&       wl_a,
+    const view_2d<Spack>&        shoc_qv,
+    const view_1d<Scalar>&       ustar,
+    const view_1d<Scalar>&       kbfs,
+    const view_1d<Scalar>&       obklen,
+    const view_1d<Scalar>&       pblh);
+#endif
 }; // struct Functions
 
 } // namespace shoc
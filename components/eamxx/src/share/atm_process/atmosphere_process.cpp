@@ -5,6 +5,8 @@
 
 #include "ekat/ekat_assert.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <set>
 #include <stdexcept>
 #include <string>
@@ -64,13 +66,27 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
       m_params.get<bool>("enable_column_conservation_checks", false);
 
   m_internal_diagnostics_level = m_params.get<int>("internal_diagnostics_level", 0);
+
+  m_perf_counters.enabled = m_params.get<bool>("enable_perf_counters", false);
+
+  m_fuse_property_checks = m_params.get<bool>("enable_fused_property_checks", true);
 }
 
 void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type) {
+  const auto timer_root = m_timer_prefix + this->name();
+  m_run_timers.run.set_name(timer_root + "::run");
+  m_run_timers.precondition_checks.set_name(timer_root + "::run-precondition-checks");
+  m_run_timers.postcondition_checks.set_name(timer_root + "::run-postcondition-checks");
+  m_run_timers.column_conservation_checks.set_name(timer_root + "::run-column-conservation-checks");
+  m_run_timers.compute_tendencies.set_name(timer_root + "::compute_tendencies");
+
   if (this->type()!=AtmosphereProcessType::Group) {
     start_timer (m_timer_prefix + this->name() + "::init");
   }
   set_fields_and_groups_pointers();
+  if (m_perf_counters.enabled) {
+    enable_kernel_counting();
+  }
   m_time_stamp = t0;
   initialize_impl(run_type);
 
@@ -88,7 +104,7 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 
 void AtmosphereProcess::run (const double dt) {
   m_atm_logger->debug("[EAMxx::" + this->name() + "] run...");
-  start_timer (m_timer_prefix + this->name() + "::run");
+  ScopedTimer timer(m_run_timers.run);
   if (m_params.get("enable_precondition_checks", true)) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
@@ -114,7 +130,11 @@ void AtmosphereProcess::run (const double dt) {
                               true, false, false);
 
     // Run derived class implementation
-    run_impl(dt_sub);
+    if (m_perf_counters.enabled) {
+      run_impl_and_count(dt_sub);
+    } else {
+      run_impl(dt_sub);
+    }
 
     if (m_internal_diagnostics_level > 0)
       print_global_state_hash(name() + "-pst-sc-" + std::to_string(m_subcycle_iter),
@@ -139,13 +159,98 @@ void AtmosphereProcess::run (const double dt) {
     // Update all output fields time stamps
     update_time_stamps ();
   }
-  stop_timer (m_timer_prefix + this->name() + "::run");
 }
 
 void AtmosphereProcess::finalize (/* what inputs? */) {
   finalize_impl(/* what inputs? */);
 }
 
+void AtmosphereProcess::run_impl_and_count (const double dt) {
+  using clock = std::chrono::steady_clock;
+
+  auto& pc = m_perf_counters;
+  if (pc.bytes_per_step<0) {
+    pc.bytes_per_step = compute_bytes_per_step();
+  }
+
+  // Fence, so that we don't time kernels launched before this process
+  Kokkos::fence();
+  const auto k0 = get_kernel_count();
+  const auto t0 = clock::now();
+
+  run_impl(dt);
+
+  Kokkos::fence();
+  pc.time += std::chrono::duration<double>(clock::now()-t0).count();
+  pc.kernels += get_kernel_count() - k0;
+  ++pc.nsteps;
+}
+
+double AtmosphereProcess::compute_bytes_per_step () const {
+  // Use the logical size of the fields (no padding), and count each field
+  // only once per direction (in/out), even if it appears in multiple groups.
+  auto count = [](const std::list<Field>& fields, const std::list<FieldGroup>& groups) {
+    std::set<std::pair<std::string,std::string>> counted;
+    double bytes = 0;
+    auto add = [&](const Field& f) {
+      const auto& fid = f.get_header().get_identifier();
+      if (counted.emplace(fid.name(),fid.get_grid_name()).second) {
+        bytes += static_cast<double>(fid.get_layout().size())*get_type_size(fid.data_type());
+      }
+    };
+    for (const auto& f : fields) {
+      add(f);
+    }
+    for (const auto& g : groups) {
+      if (g.m_bundle) {
+        add(*g.m_bundle);
+      } else {
+        for (const auto& it : g.m_fields) {
+          add(*it.second);
+        }
+      }
+    }
+    return bytes;
+  };
+
+  return count(m_fields_in,m_groups_in) + count(m_fields_out,m_groups_out);
+}
+
+void AtmosphereProcess::gather_perf_reports (std::vector<PerfReport>& reports) const {
+  const auto& pc = m_perf_counters;
+  if (not pc.enabled) {
+    return;
+  }
+
+  const double nsteps = std::max(pc.nsteps,1LL);
+  double my_bytes   = std::max(pc.bytes_per_step,0.0);
+  double my_kernels = pc.kernels / nsteps;
+  double my_time    = pc.time / nsteps;
+
+  PerfReport r;
+  r.name   = this->name();
+  r.nsteps = pc.nsteps;
+  m_comm.all_reduce(&my_bytes,  &r.bytes_per_step,  1,MPI_SUM);
+  m_comm.all_reduce(&my_kernels,&r.kernels_per_step,1,MPI_MAX);
+  m_comm.all_reduce(&my_time,   &r.time_per_step,   1,MPI_MAX);
+  r.bandwidth = r.time_per_step>0 ? r.bytes_per_step / r.time_per_step / 1e9 : 0;
+
+  reports.push_back(r);
+}
+
+void AtmosphereProcess::gather_run_timers (std::vector<std::string>& timers) const {
+  if (m_run_timers.run.has_name()) {
+    timers.push_back(m_run_timers.run.name());
+  }
+}
+
+void AtmosphereProcess::reset_perf_counters () {
+  auto& pc = m_perf_counters;
+  pc.nsteps  = 0;
+  pc.kernels = 0;
+  pc.time    = 0;
+}
+
 void AtmosphereProcess::setup_tendencies_requests () {
   using vos_t = std::vector<std::string>;
   auto tend_vec = m_params.get<vos_t>("compute_tendencies",{});
@@ -457,51 +562,86 @@ void AtmosphereProcess::run_property_check (const prop_check_ptr&       property
   }
 }
 
+void AtmosphereProcess::
+run_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                     std::shared_ptr<FusedPropertyChecks>& fused,
+                     const PropertyCheckCategory property_check_category) const {
+  if (not m_fuse_property_checks) {
+    for (const auto& it : checks) {
+      run_property_check(it.second, it.first, property_check_category);
+    }
+    return;
+  }
+
+  // (Re)build the fused checks if new checks were added since last call
+  if (fused==nullptr or fused->num_checks()!=static_cast<int>(checks.size())) {
+    std::vector<prop_check_ptr> pcs;
+    for (const auto& it : checks) {
+      pcs.push_back(it.second);
+    }
+    fused = std::make_shared<FusedPropertyChecks>(pcs);
+  }
+
+  // Screen all the simple checks with one kernel. While it runs, process
+  // the checks that cannot be screened. Only the screened checks that
+  // did not pass need to run the full check (which also handles repairs).
+  // NOTE: repairs only clip values towards the allowed interval, so the
+  //       screening result is still conservative if a repair happens
+  //       after the fused kernel is launched.
+  fused->launch();
+  int i = 0;
+  for (const auto& it : checks) {
+    if (not fused->is_screened(i)) {
+      run_property_check(it.second, it.first, property_check_category);
+    }
+    ++i;
+  }
+  i = 0;
+  for (const auto& it : checks) {
+    if (fused->is_screened(i) and fused->needs_full_check(i)) {
+      run_property_check(it.second, it.first, property_check_category);
+    }
+    ++i;
+  }
+}
+
 void AtmosphereProcess::run_precondition_checks () const {
   m_atm_logger->debug("[" + this->name() + "] run_precondition_checks...");
-  start_timer(m_timer_prefix + this->name() + "::run-precondition-checks");
+  ScopedTimer timer(m_run_timers.precondition_checks);
   // Run all pre-condition property checks
-  for (const auto& it : m_precondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Precondition);
-  }
-  stop_timer(m_timer_prefix + this->name() + "::run-precondition-checks");
+  run_property_checks(m_precondition_checks, m_fused_precondition_checks,
+                      PropertyCheckCategory::Precondition);
   m_atm_logger->debug("[" + this->name() + "] run_precondition_checks...done!");
 }
 
 void AtmosphereProcess::run_postcondition_checks () const {
   m_atm_logger->debug("[" + this->name() + "] run_postcondition_checks...");
-  start_timer(m_timer_prefix + this->name() + "::run-postcondition-checks");
+  ScopedTimer timer(m_run_timers.postcondition_checks);
   // Run all post-condition property checks
-  for (const auto& it : m_postcondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Postcondition);
-  }
-  stop_timer(m_timer_prefix + this->name() + "::run-postcondition-checks");
+  run_property_checks(m_postcondition_checks, m_fused_postcondition_checks,
+                      PropertyCheckCategory::Postcondition);
   m_atm_logger->debug("[" + this->name() + "] run_postcondition_checks...done!");
 }
 
 void AtmosphereProcess::run_column_conservation_check () const {
   m_atm_logger->debug("[" + this->name() + "] run_column_conservation_check...");
-  start_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
+  ScopedTimer timer(m_run_timers.column_conservation_checks);
   // Conservation check is run as a postcondition check
   run_property_check(m_column_conservation_check.second,
                      m_column_conservation_check.first,
                      PropertyCheckCategory::Postcondition);
-  stop_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
   m_atm_logger->debug("[" + this->name() + "] run_column-conservation_checks...done!");
 }
 
 void AtmosphereProcess::init_step_tendencies () {
   if (m_compute_proc_tendencies) {
-    start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    ScopedTimer timer(m_run_timers.compute_tendencies);
     for (auto& it : m_start_of_step_fields) {
       const auto& fname = it.first;
       const auto& f     = get_field_out(fname);
             auto& f_beg = it.second;
       f_beg.deep_copy(f);
     }
-    stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
   }
 }
 
@@ -509,7 +649,7 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
   using namespace ShortFieldTagsNames;
   if (m_compute_proc_tendencies) {
     m_atm_logger->debug("[" + this->name() + "] computing tendencies...");
-    start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    ScopedTimer timer(m_run_timers.compute_tendencies);
     for (auto it : m_proc_tendencies) {
       // Note: f_beg is nonconst, so we can store step tendency in it
       const auto& tname = it.first;
@@ -522,7 +662,6 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
       f_beg.update(f,1,-1);
       tend.update(f_beg,1,1);
     }
-    stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
   }
 }
 
@@ -8,10 +8,12 @@
 #include "share/field/field_identifier.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/property_checks/property_check.hpp"
+#include "share/property_checks/fused_property_checks.hpp"
 #include "share/field/field_request.hpp"
 #include "share/field/field.hpp"
 #include "share/field/field_group.hpp"
 #include "share/grid/grids_manager.hpp"
+#include "share/util/scream_timing.hpp"
 
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/ekat_parameter_list.hpp"
@@ -25,6 +27,7 @@
 #include <string>
 #include <set>
 #include <list>
+#include <vector>
 
 namespace scream
 {
@@ -287,6 +290,32 @@ public:
     return m_atm_logger;
   }
 
+  // Performance counters, enabled via the 'enable_perf_counters' parameter.
+  // Each call to run_impl is timed (with fences around it), and the number of
+  // kokkos kernels launched is recorded. The bytes moved by one run_impl call
+  // are estimated as the size of all input fields (read) plus the size of all
+  // output fields (written). Comparing the achieved bandwidth with the machine
+  // peak, and the time per kernel with the launch latency, tells whether
+  // the process is bandwidth-bound or launch-bound.
+  struct PerfReport {
+    std::string name;
+    long long   nsteps;            // Number of run_impl calls
+    double      bytes_per_step;    // Sum over ranks
+    double      kernels_per_step;  // Max over ranks
+    double      time_per_step;     // Max over ranks [s]
+    double      bandwidth;         // bytes_per_step / time_per_step [GB/s]
+  };
+
+  // Append the report of this process (if perf counters are enabled) to the input list.
+  // NOTE: this is a collective operation.
+  virtual void gather_perf_reports (std::vector<PerfReport>& reports) const;
+
+  // Zero out the perf counters (e.g., to exclude warmup steps from the reports)
+  virtual void reset_perf_counters ();
+
+  // Append the name of the timer of the run method of this process to the input list
+  virtual void gather_run_timers (std::vector<std::string>& timers) const;
+
 protected:
 
   // Sends a message to the atm log
@@ -465,6 +494,17 @@ protected:
   // A prefix to add to this atm proc timer
   std::string m_timer_prefix;
 
+  // Timers used at every step, whose names are set during initialize.
+  // Mutable, since checks are run from const methods
+  struct RunTimers {
+    TimerHandle run;
+    TimerHandle precondition_checks;
+    TimerHandle postcondition_checks;
+    TimerHandle column_conservation_checks;
+    TimerHandle compute_tendencies;
+  };
+  mutable RunTimers m_run_timers;
+
   // The logger for the whole atmosphere
   // WARNING: this is non-const, but you should *NOT* modify its
   //          log level and/or its sinks. If you just need to log
@@ -506,6 +546,12 @@ private:
   FieldGroup& get_group_out_impl(const std::string& group_name, const std::string& grid_name) const;
   FieldGroup& get_group_out_impl(const std::string& group_name) const;
 
+  // Call run_impl, updating the perf counters
+  void run_impl_and_count (const double dt);
+
+  // Estimate bytes read/written by one call to run_impl
+  double compute_bytes_per_step () const;
+
   // Compute/store data needed for this processes mass and energy conservation
   // check: dt, tolerance, current mass and energy value per column.
   void compute_column_conservation_checks_data (const int dt);
@@ -515,6 +561,11 @@ private:
                            const CheckFailHandling     check_fail_handling,
                            const PropertyCheckCategory property_check_category) const;
 
+  // Run a list of property checks, screening them with a fused kernel if enabled
+  void run_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                            std::shared_ptr<FusedPropertyChecks>& fused,
+                            const PropertyCheckCategory property_check_category) const;
+
   // NOTE: all these members are private, so that derived classes cannot
   //       bypass checks from the base class by accessing the members directly.
   //       Instead, they are forced to use access function, which include
@@ -554,6 +605,12 @@ private:
   // Column local mass and energy conservation check
   std::pair<CheckFailHandling,prop_check_ptr> m_column_conservation_check;
 
+  // Fused screening of the pre/post-condition checks. They are built at the
+  // first run of the checks, hence mutable.
+  bool m_fuse_property_checks;
+  mutable std::shared_ptr<FusedPropertyChecks> m_fused_precondition_checks;
+  mutable std::shared_ptr<FusedPropertyChecks> m_fused_postcondition_checks;
+
   // Store data related to this processes conservation check.
   struct ColumnConservationCheckData {
     // Boolean which dictates whether or not this process
@@ -587,6 +644,16 @@ private:
   // Controls global hashing output for debugging non-BFBness.
   int m_internal_diagnostics_level;
 
+  // Local (this rank) performance counters
+  struct PerfCounters {
+    bool      enabled        = false;
+    long long nsteps         = 0;
+    long long kernels        = 0;
+    double    time           = 0;
+    double    bytes_per_step = -1; // Computed at first run_impl call
+  };
+  PerfCounters m_perf_counters;
+
 protected:
 
   // IOP object
@@ -322,6 +322,27 @@ setup_column_conservation_checks (const std::shared_ptr<MassAndEnergyColumnConse
   }
 }
 
+void AtmosphereProcessGroup::gather_perf_reports (std::vector<PerfReport>& reports) const {
+  AtmosphereProcess::gather_perf_reports(reports);
+  for (const auto& atm_proc : m_atm_processes) {
+    atm_proc->gather_perf_reports(reports);
+  }
+}
+
+void AtmosphereProcessGroup::reset_perf_counters () {
+  AtmosphereProcess::reset_perf_counters();
+  for (const auto& atm_proc : m_atm_processes) {
+    atm_proc->reset_perf_counters();
+  }
+}
+
+void AtmosphereProcessGroup::gather_run_timers (std::vector<std::string>& timers) const {
+  AtmosphereProcess::gather_run_timers(timers);
+  for (const auto& atm_proc : m_atm_processes) {
+    atm_proc->gather_run_timers(timers);
+  }
+}
+
 void AtmosphereProcessGroup::add_postcondition_nan_checks () const {
   for (auto proc : m_atm_processes) {
     auto group = std::dynamic_pointer_cast<AtmosphereProcessGroup>(proc);
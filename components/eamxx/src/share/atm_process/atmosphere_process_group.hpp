@@ -105,6 +105,13 @@ public:
   // Add additional data fields to all property checks in the group
   void add_additional_data_fields_to_property_checks (const Field& data_field);
 
+  // Gather perf reports of this group (if enabled) and of all processes in the group
+  void gather_perf_reports (std::vector<PerfReport>& reports) const;
+  void reset_perf_counters ();
+
+  // Gather the run timers of this group and of all processes in the group
+  void gather_run_timers (std::vector<std::string>& timers) const;
+
   // Loop through all proceeses in group and set IOP object
   void set_iop(const iop_ptr& iop) {
     for (auto& atm_proc : m_atm_processes) {
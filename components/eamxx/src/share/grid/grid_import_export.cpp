@@ -2,6 +2,10 @@
 
 #include "share/field/field_utils.hpp"
 
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+
+#include <algorithm>
+
 namespace scream
 {
 
@@ -169,6 +173,358 @@ GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
     }
     Kokkos::deep_copy(m_num_imports_per_pid,m_num_imports_per_pid_h);
   }
+
+  setup_batched_unpack_maps ();
+}
+
+GridImportExport::~GridImportExport ()
+{
+  // We need to free MPI requests
+  for (auto plans : {&m_scatter_plans, &m_gather_plans}) {
+    for (auto& it : *plans) {
+      for (auto& req : it.second.send_req) {
+        MPI_Request_free(&req);
+      }
+      for (auto& req : it.second.recv_req) {
+        MPI_Request_free(&req);
+      }
+    }
+  }
+}
+
+void GridImportExport::
+scatter (const std::vector<Field>& src,
+         const std::vector<Field>& dst)
+{
+  batched_transfer(m_scatter_plans,src,dst,true);
+}
+
+void GridImportExport::
+gather (const std::vector<Field>& src,
+        const std::vector<Field>& dst)
+{
+  batched_transfer(m_gather_plans,src,dst,false);
+}
+
+void GridImportExport::setup_batched_unpack_maps ()
+{
+  auto create_map = [](BatchedUnpackMap& map,
+                       const std::vector<int>& lids,
+                       const std::vector<int>& ptr,
+                       const std::vector<int>& items) {
+    auto copy_to_dev = [](view_1d<int>& v, const std::vector<int>& data) {
+      v = view_1d<int>("",data.size());
+      auto v_h = Kokkos::create_mirror_view(v);
+      std::copy(data.begin(),data.end(),v_h.data());
+      Kokkos::deep_copy(v,v_h);
+    };
+    copy_to_dev(map.lids,lids);
+    copy_to_dev(map.ptr,ptr);
+    copy_to_dev(map.items,items);
+  };
+
+  // Scatter: each overlapped dof is imported exactly once
+  const int nimp = m_import_lids_h.size();
+  std::vector<int> lids(nimp), ptr(nimp+1), items(nimp);
+  for (int i=0; i<nimp; ++i) {
+    lids[i] = m_import_lids_h(i);
+    ptr[i] = items[i] = i;
+  }
+  ptr[nimp] = nimp;
+  create_map(m_scatter_unpack_map,lids,ptr,items);
+
+  // Gather: a unique dof may be exported to several pids. Since exports are
+  // sorted by pid, the contributions of each dof are listed in pid order
+  const int nexp = m_export_lids_h.size();
+  std::map<int,std::vector<int>> lid2items;
+  for (int i=0; i<nexp; ++i) {
+    lid2items[m_export_lids_h(i)].push_back(i);
+  }
+  lids.clear();
+  ptr.assign(1,0);
+  items.clear();
+  for (const auto& it : lid2items) {
+    lids.push_back(it.first);
+    items.insert(items.end(),it.second.begin(),it.second.end());
+    ptr.push_back(items.size());
+  }
+  create_map(m_gather_unpack_map,lids,ptr,items);
+}
+
+GridImportExport::BatchedPlan& GridImportExport::
+get_batched_plan (std::map<int,BatchedPlan>& plans,
+                  const int total_col_size,
+                  const view_1d<int>::HostMirror& nsend_per_pid,
+                  const view_1d<int>::HostMirror& nrecv_per_pid,
+                  const std::string& name)
+{
+  auto it = plans.find(total_col_size);
+  if (it!=plans.end()) {
+    return it->second;
+  }
+
+  auto& plan = plans[total_col_size];
+  const int nranks = m_comm.size();
+
+  // Buffers are sorted by pid, like import/export data, so the
+  // data of the i-th import/export starts at i*total_col_size
+  int nsend = 0, nrecv = 0;
+  for (int pid=0; pid<nranks; ++pid) {
+    nsend += nsend_per_pid(pid);
+    nrecv += nrecv_per_pid(pid);
+  }
+  plan.send_buffer = real_view_1d("GridImportExport::"+name+"::send_buf",nsend*total_col_size);
+  plan.recv_buffer = real_view_1d("GridImportExport::"+name+"::recv_buf",nrecv*total_col_size);
+  plan.mpi_send_buffer = Kokkos::create_mirror_view(mpi_real_view_1d::execution_space(),plan.send_buffer);
+  plan.mpi_recv_buffer = Kokkos::create_mirror_view(mpi_real_view_1d::execution_space(),plan.recv_buffer);
+
+  // Create persistent requests
+  const auto mpi_comm = m_comm.mpi_comm();
+  const auto mpi_real = ekat::get_mpi_type<Real>();
+  for (int pid=0, send_pos=0, recv_pos=0; pid<nranks; ++pid) {
+    if (nsend_per_pid(pid)>0) {
+      auto send_ptr = plan.mpi_send_buffer.data() + send_pos*total_col_size;
+      auto send_count = nsend_per_pid(pid)*total_col_size;
+      auto& req = plan.send_req.emplace_back();
+      check_mpi_call(MPI_Send_init (send_ptr, send_count, mpi_real, pid,
+                                    0, mpi_comm, &req),
+                     "GridImportExport::" + name + ", creating persistent send request.\n");
+      send_pos += nsend_per_pid(pid);
+    }
+    if (nrecv_per_pid(pid)>0) {
+      auto recv_ptr = plan.mpi_recv_buffer.data() + recv_pos*total_col_size;
+      auto recv_count = nrecv_per_pid(pid)*total_col_size;
+      auto& req = plan.recv_req.emplace_back();
+      check_mpi_call(MPI_Recv_init (recv_ptr, recv_count, mpi_real, pid,
+                                    0, mpi_comm, &req),
+                     "GridImportExport::" + name + ", creating persistent recv request.\n");
+      recv_pos += nrecv_per_pid(pid);
+    }
+  }
+
+  return plan;
+}
+
+namespace {
+
+// Store data pointer, extents, and strides of the field (strided) view.
+// Note: the pointer is non-const, since it is also used for dst fields
+template<typename DT, typename FieldInfo>
+void set_strided_info (const Field& f, FieldInfo& fi)
+{
+  const auto v = f.get_strided_view<DT>();
+  constexpr int rank = decltype(v)::rank;
+  fi.data = const_cast<Real*>(v.data());
+  fi.col_stride = v.stride(0);
+  fi.col_rank = rank-1;
+  fi.col_size = 1;
+  for (int i=1; i<rank; ++i) {
+    fi.dims[i-1] = v.extent_int(i);
+    fi.strides[i-1] = v.stride(i);
+    fi.col_size *= fi.dims[i-1];
+  }
+}
+
+} // anonymous namespace
+
+int GridImportExport::
+set_batched_fields_info (const std::vector<Field>& fields,
+                         const AbstractGrid& grid,
+                         view_1d<BatchedFieldInfo>& info,
+                         const std::string& name) const
+{
+  using namespace ShortFieldTagsNames;
+
+  const int nfields = fields.size();
+  if (info.extent_int(0)!=nfields) {
+    info = view_1d<BatchedFieldInfo>("",nfields);
+  }
+  auto info_h = Kokkos::create_mirror_view(info);
+
+  int total_col_size = 0;
+  for (int i=0; i<nfields; ++i) {
+    const auto& f  = fields[i];
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    EKAT_REQUIRE_MSG (f.is_allocated(),
+        "Error! GridImportExport::" + name + " requires allocated fields.\n"
+        "  - field name: " + f.name() + "\n");
+    EKAT_REQUIRE_MSG (f.data_type()==DataType::RealType,
+        "Error! GridImportExport::" + name + " only allows fields with RealType data.\n"
+        "  - field name: " + f.name() + "\n"
+        "  - field type: " + e2str(f.data_type()) + "\n");
+    EKAT_REQUIRE_MSG (fl.rank()>0 and fl.tag(0)==COL,
+        "Error! GridImportExport::" + name + " requires COL to be the first dimension.\n"
+        "  - field name: " + f.name() + "\n"
+        "  - field layout: " + fl.to_string() + "\n");
+    EKAT_REQUIRE_MSG (fl.dim(0)==grid.get_num_local_dofs(),
+        "Error! GridImportExport::" + name + " field COL extent does not match the grid.\n"
+        "  - field name: " + f.name() + "\n"
+        "  - field layout: " + fl.to_string() + "\n"
+        "  - grid name: " + grid.name() + "\n"
+        "  - grid num local dofs: " + std::to_string(grid.get_num_local_dofs()) + "\n");
+
+    auto& fi = info_h(i);
+    switch (fl.rank()) {
+      case 1: set_strided_info<const Real*>     (f,fi); break;
+      case 2: set_strided_info<const Real**>    (f,fi); break;
+      case 3: set_strided_info<const Real***>   (f,fi); break;
+      case 4: set_strided_info<const Real****>  (f,fi); break;
+      case 5: set_strided_info<const Real*****> (f,fi); break;
+      case 6: set_strided_info<const Real******>(f,fi); break;
+      default:
+        EKAT_ERROR_MSG ("Error! Unexpected field rank in GridImportExport::" + name + ".\n"
+            "  - field name: " + f.name() + "\n"
+            "  - field layout: " + fl.to_string() + "\n");
+    }
+    fi.buf_offset = total_col_size;
+    total_col_size += fi.col_size;
+  }
+  Kokkos::deep_copy(info,info_h);
+
+  return total_col_size;
+}
+
+void GridImportExport::
+batched_transfer (std::map<int,BatchedPlan>& plans,
+                  const std::vector<Field>& src,
+                  const std::vector<Field>& dst,
+                  const bool is_scatter)
+{
+  const std::string name = is_scatter ? "scatter" : "gather";
+  EKAT_REQUIRE_MSG (src.size()==dst.size(),
+      "Error! GridImportExport::" + name + " requires the same number of src and dst fields.\n"
+      "  - num src fields: " + std::to_string(src.size()) + "\n"
+      "  - num dst fields: " + std::to_string(dst.size()) + "\n");
+
+  const auto& src_grid = is_scatter ? *m_unique : *m_overlapped;
+  const auto& dst_grid = is_scatter ? *m_overlapped : *m_unique;
+  const int total_col_size = set_batched_fields_info(src,src_grid,m_src_fields_info,name);
+  const int dst_total_col_size = set_batched_fields_info(dst,dst_grid,m_dst_fields_info,name);
+  EKAT_REQUIRE_MSG (total_col_size==dst_total_col_size,
+      "Error! GridImportExport::" + name + " requires src/dst fields with the same column sizes.\n");
+  if (total_col_size==0) {
+    return;
+  }
+  const int nfields = src.size();
+
+  auto& plan = is_scatter
+             ? get_batched_plan(plans,total_col_size,m_num_exports_per_pid_h,m_num_imports_per_pid_h,name)
+             : get_batched_plan(plans,total_col_size,m_num_imports_per_pid_h,m_num_exports_per_pid_h,name);
+  const auto& pack_lids  = is_scatter ? m_export_lids : m_import_lids;
+  const auto& unpack_map = is_scatter ? m_scatter_unpack_map : m_gather_unpack_map;
+
+  // Fire the recv requests right away, so that if some other ranks
+  // is done packing before us, we can start receiving their data
+  if (not plan.recv_req.empty()) {
+    check_mpi_call(MPI_Startall(plan.recv_req.size(),plan.recv_req.data()),
+                   "GridImportExport::" + name + ", starting persistent recv requests.\n");
+  }
+
+  batched_pack(plan.send_buffer,m_src_fields_info,nfields,total_col_size,pack_lids);
+
+  // If MPI does not use dev pointers, we need to deep copy from dev to host
+  if (not MpiOnDev) {
+    Kokkos::deep_copy (plan.mpi_send_buffer,plan.send_buffer);
+  }
+
+  if (not plan.send_req.empty()) {
+    check_mpi_call(MPI_Startall(plan.send_req.size(),plan.send_req.data()),
+                   "GridImportExport::" + name + ", starting persistent send requests.\n");
+  }
+
+  if (not plan.recv_req.empty()) {
+    check_mpi_call(MPI_Waitall(plan.recv_req.size(),plan.recv_req.data(),MPI_STATUSES_IGNORE),
+                   "GridImportExport::" + name + ", waiting on persistent recv requests.\n");
+  }
+
+  // If MPI does not use dev pointers, we need to deep copy from host to dev
+  if (not MpiOnDev) {
+    Kokkos::deep_copy (plan.recv_buffer,plan.mpi_recv_buffer);
+  }
+
+  batched_unpack(plan.recv_buffer,m_dst_fields_info,nfields,total_col_size,unpack_map);
+
+  // Wait for all sends to be completed
+  if (not plan.send_req.empty()) {
+    check_mpi_call(MPI_Waitall(plan.send_req.size(),plan.send_req.data(),MPI_STATUSES_IGNORE),
+                   "GridImportExport::" + name + ", waiting on persistent send requests.\n");
+  }
+}
+
+void GridImportExport::
+batched_pack (const real_view_1d& buffer,
+              const view_1d<BatchedFieldInfo>& info,
+              const int num_fields, const int total_col_size,
+              const view_1d<int>& lids) const
+{
+  using TeamMember = typename KT::MemberType;
+  using ESU        = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+
+  const int nitems = lids.size();
+  if (nitems==0) {
+    return;
+  }
+
+  // One team per column, packing all fields
+  auto policy = ESU::get_default_team_policy(nitems,total_col_size);
+  auto pack = KOKKOS_LAMBDA(const TeamMember& team) {
+    const int item = team.league_rank();
+    const int icol = lids(item);
+    for (int ifield=0; ifield<num_fields; ++ifield) {
+      const auto& fi = info(ifield);
+      const Real* col = fi.data + icol*fi.col_stride;
+      Real* buf = buffer.data() + item*total_col_size + fi.buf_offset;
+      auto col_pack = [&](const int idx) {
+        buf[idx] = col[fi.col_offset(idx)];
+      };
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,fi.col_size),col_pack);
+    }
+  };
+  Kokkos::parallel_for(policy,pack);
+
+  // Wait for all threads to be done packing
+  Kokkos::fence();
+}
+
+void GridImportExport::
+batched_unpack (const real_view_1d& buffer,
+                const view_1d<BatchedFieldInfo>& info,
+                const int num_fields, const int total_col_size,
+                const BatchedUnpackMap& map) const
+{
+  using TeamMember = typename KT::MemberType;
+  using ESU        = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+
+  const int nlids = map.lids.size();
+  if (nlids==0) {
+    return;
+  }
+
+  // One team per column, unpacking all fields
+  auto lids  = map.lids;
+  auto ptr   = map.ptr;
+  auto items = map.items;
+  auto policy = ESU::get_default_team_policy(nlids,total_col_size);
+  auto unpack = KOKKOS_LAMBDA(const TeamMember& team) {
+    const int i = team.league_rank();
+    const int icol = lids(i);
+    const int beg = ptr(i);
+    const int end = ptr(i+1);
+    for (int ifield=0; ifield<num_fields; ++ifield) {
+      const auto& fi = info(ifield);
+      Real* col = fi.data + icol*fi.col_stride;
+      auto col_unpack = [&](const int idx) {
+        Real val = buffer(items(beg)*total_col_size + fi.buf_offset + idx);
+        for (int k=beg+1; k<end; ++k) {
+          val += buffer(items(k)*total_col_size + fi.buf_offset + idx);
+        }
+        col[fi.col_offset(idx)] = val;
+      };
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,fi.col_size),col_unpack);
+    }
+  };
+  Kokkos::parallel_for(policy,unpack);
+  Kokkos::fence();
 }
 
 } // namespace scream
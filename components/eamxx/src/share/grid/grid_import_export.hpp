@@ -4,6 +4,7 @@
 #include "share/grid/abstract_grid.hpp"
 #include "share/scream_types.hpp"       // For KokkosTypes
 #include "share/util/scream_utils.hpp"  // For check_mpi_call
+#include "scream_config.h"              // For SCREAM_MPI_ON_DEVICE
 
 #include <ekat/mpi/ekat_comm.hpp>
 #include <mpi.h> // We do some direct MPI calls
@@ -38,17 +39,31 @@ namespace scream
  * for ease of use in non-performance critical code.
  * On the other hand, the import/export data (pids/lids) can
  * be used both on host and device, for more efficient pack/unpack methods.
+ *
+ * For performance critical code, there are also batched versions of
+ * gather/scatter, which transfer a list of Real fields (on device) at once:
+ *   - fields can have different layouts (and can be subfields of other
+ *     fields), but COL must be their first dim;
+ *   - all fields are packed in a single buffer, with one message per remote rank;
+ *   - buffers and persistent send/recv requests are created at the first call,
+ *     and reused by all later calls with the same total column size.
+ * The batched gather stores in dst the sum of the contributions from all the
+ * ranks that have a given dof, added in rank order (so results are BFB).
  */
 
 class GridImportExport {
 public:
   using KT = KokkosTypes<DefaultDevice>;
   template<typename T>
-  using view_1d = typename KT::view_1d<int>;
+  using view_1d = typename KT::template view_1d<T>;
 
   GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
                     const std::shared_ptr<const AbstractGrid>& overlapped);
-  ~GridImportExport () = default;
+  ~GridImportExport ();
+
+  // The persistent requests of the batched gather/scatter cannot be shared
+  GridImportExport (const GridImportExport&) = delete;
+  GridImportExport& operator= (const GridImportExport&) = delete;
 
   template<typename T>
   void scatter (const MPI_Datatype mpi_data_t,
@@ -60,6 +75,14 @@ public:
                const std::map<int,std::vector<T>>& src,
                      std::map<int,std::vector<T>>& dst) const;
 
+  // Batched versions: src fields are on the unique (resp. overlapped) grid,
+  // and dst fields are on the overlapped (resp. unique) grid for scatter (resp. gather)
+  void scatter (const std::vector<Field>& src,
+                const std::vector<Field>& dst);
+
+  void gather (const std::vector<Field>& src,
+               const std::vector<Field>& dst);
+
   view_1d<int> num_exports_per_pid () const { return m_num_exports_per_pid; }
   view_1d<int> num_imports_per_pid () const { return m_num_imports_per_pid; }
 
@@ -76,6 +99,93 @@ public:
   view_1d<int>::HostMirror export_pids_h () const { return m_export_pids_h; }
   view_1d<int>::HostMirror export_lids_h () const { return m_export_lids_h; }
 
+protected:
+
+  // If MpiOnDev=true, we pass device pointers to MPI. Otherwise, we use host mirrors.
+  static constexpr bool MpiOnDev = SCREAM_MPI_ON_DEVICE;
+  using real_view_1d = KT::view_1d<Real>;
+  using mpi_real_view_1d = typename std::conditional<
+                             MpiOnDev,
+                             real_view_1d,
+                             typename real_view_1d::HostMirror
+                           >::type;
+
+  // Where to find the entries of a field column. For a field with layout
+  // (COL,d1,..,dN), the entry (i1,..,iN) of column icol is at
+  //   data[icol*col_stride + i1*strides[0] + .. + iN*strides[N-1]]
+  // The strides are those of the field strided view, so they account for
+  // padding, as well as for the parent layout in case of subfields.
+  static constexpr int MaxColRank = Field::MaxRank - 1;
+  struct BatchedFieldInfo {
+    Real* data;
+    int   col_size;
+    int   col_stride;
+    int   col_rank;
+    int   dims[MaxColRank];
+    int   strides[MaxColRank];
+    int   buf_offset;   // Offset of this field within a column of the buffers
+
+    // Offset of the idx-th entry of a column (in LayoutRight order)
+    KOKKOS_INLINE_FUNCTION
+    int col_offset (int idx) const {
+      int offset = 0;
+      for (int i=col_rank-1; i>=0; --i) {
+        offset += (idx % dims[i])*strides[i];
+        idx /= dims[i];
+      }
+      return offset;
+    }
+  };
+
+  // In the batched unpack, the dst column lids(i) is the sum of the buffer
+  // columns items(ptr(i)),...,items(ptr(i+1)-1)
+  struct BatchedUnpackMap {
+    view_1d<int>  lids;
+    view_1d<int>  ptr;
+    view_1d<int>  items;
+  };
+
+  // Buffers and persistent requests for a given total column size
+  struct BatchedPlan {
+    real_view_1d      send_buffer;
+    real_view_1d      recv_buffer;
+    mpi_real_view_1d  mpi_send_buffer;
+    mpi_real_view_1d  mpi_recv_buffer;
+
+    std::vector<MPI_Request>  send_req;
+    std::vector<MPI_Request>  recv_req;
+  };
+
+  void setup_batched_unpack_maps ();
+
+  BatchedPlan& get_batched_plan (std::map<int,BatchedPlan>& plans,
+                                 const int total_col_size,
+                                 const view_1d<int>::HostMirror& nsend_per_pid,
+                                 const view_1d<int>::HostMirror& nrecv_per_pid,
+                                 const std::string& name);
+
+  // Fill the info view for the input fields, and return the total column size
+  int set_batched_fields_info (const std::vector<Field>& fields,
+                               const AbstractGrid& grid,
+                               view_1d<BatchedFieldInfo>& info,
+                               const std::string& name) const;
+
+  void batched_transfer (std::map<int,BatchedPlan>& plans,
+                         const std::vector<Field>& src,
+                         const std::vector<Field>& dst,
+                         const bool is_scatter);
+
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  void batched_pack (const real_view_1d& buffer,
+                     const view_1d<BatchedFieldInfo>& info,
+                     const int num_fields, const int total_col_size,
+                     const view_1d<int>& lids) const;
+  void batched_unpack (const real_view_1d& buffer,
+                       const view_1d<BatchedFieldInfo>& info,
+                       const int num_fields, const int total_col_size,
+                       const BatchedUnpackMap& map) const;
 protected:
 
   std::shared_ptr<const AbstractGrid>   m_unique;
@@ -99,6 +209,16 @@ protected:
   view_1d<int>::HostMirror  m_num_imports_per_pid_h;
   view_1d<int>::HostMirror  m_num_exports_per_pid_h;
 
+  // Batched gather/scatter data
+  BatchedUnpackMap  m_scatter_unpack_map;
+  BatchedUnpackMap  m_gather_unpack_map;
+
+  std::map<int,BatchedPlan>  m_scatter_plans;
+  std::map<int,BatchedPlan>  m_gather_plans;
+
+  view_1d<BatchedFieldInfo>  m_src_fields_info;
+  view_1d<BatchedFieldInfo>  m_dst_fields_info;
+
   ekat::Comm    m_comm;
 };
 
@@ -153,11 +153,13 @@ void AbstractRemapper::remap (const bool forward) {
       EKAT_REQUIRE_MSG (m_fwd_allowed,
           "Error! Forward remap is not allowed by this remapper.\n"
           "       This means that some fields on the target grid are read-only.\n");
+      ScopedTimer timer(m_fwd_timer);
       do_remap_fwd ();
     } else {
       EKAT_REQUIRE_MSG (m_bwd_allowed,
           "Error! Backward remap is not allowed by this remapper.\n"
           "       This means that some fields on the source grid are read-only.\n");
+      ScopedTimer timer(m_bwd_timer);
       do_remap_bwd ();
     }
   }
@@ -172,6 +174,10 @@ set_grids (const grid_ptr_type& src_grid,
 
   m_src_grid = src_grid;
   m_tgt_grid = tgt_grid;
+
+  const auto timer_root = "EAMxx::remap::" + src_grid->name() + "->" + tgt_grid->name();
+  m_fwd_timer.set_name(timer_root + "::fwd");
+  m_bwd_timer.set_name(timer_root + "::bwd");
 }
 
 } // namespace scream
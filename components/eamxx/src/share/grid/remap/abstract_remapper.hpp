@@ -3,6 +3,7 @@
 
 #include "share/field/field.hpp"
 #include "share/grid/abstract_grid.hpp"
+#include "share/util/scream_timing.hpp"
 
 #include "ekat/util/ekat_factory.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
@@ -257,6 +258,10 @@ protected:
   // access its entries.
   std::vector<bool>   m_fields_are_bound;
   int                 m_num_bound_fields = 0;
+
+  // Timers for remap calls, named after src/tgt grids (set in set_grids)
+  TimerHandle         m_fwd_timer;
+  TimerHandle         m_bwd_timer;
 };
 
 // A short name for an AbstractRemapper factory
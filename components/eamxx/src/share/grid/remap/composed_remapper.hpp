@@ -0,0 +1,110 @@
+#ifndef SCREAM_COMPOSED_REMAPPER_HPP
+#define SCREAM_COMPOSED_REMAPPER_HPP
+
+#include "share/grid/remap/abstract_remapper.hpp"
+
+namespace scream
+{
+
+// Performs remap by chaining two remappers, A->B and B->C.
+// The fields on the intermediate grid B are allocated internally.
+class ComposedRemapper : public AbstractRemapper
+{
+public:
+  using base_type       = AbstractRemapper;
+
+  ComposedRemapper (std::shared_ptr<base_type> first,
+                    std::shared_ptr<base_type> second)
+   : base_type(first->get_src_grid(),second->get_tgt_grid())
+  {
+    EKAT_REQUIRE_MSG (first->get_tgt_grid()->name()==second->get_src_grid()->name(),
+        "Error! Cannot compose remappers with mismatching intermediate grids.\n"
+        "  - first remapper tgt grid : " + first->get_tgt_grid()->name() + "\n"
+        "  - second remapper src grid: " + second->get_src_grid()->name() + "\n");
+
+    m_first  = first;
+    m_second = second;
+  }
+
+  ~ComposedRemapper () = default;
+
+  FieldLayout create_src_layout (const FieldLayout& tgt_layout) const override {
+    return m_first->create_src_layout(m_second->create_src_layout(tgt_layout));
+  }
+  FieldLayout create_tgt_layout (const FieldLayout& src_layout) const override {
+    return m_second->create_tgt_layout(m_first->create_tgt_layout(src_layout));
+  }
+
+  bool compatible_layouts (const layout_type& src,
+                           const layout_type& tgt) const override {
+    const auto mid = m_first->create_tgt_layout(src);
+    return m_first->compatible_layouts(src,mid) and
+           m_second->compatible_layouts(mid,tgt);
+  }
+
+protected:
+
+  const identifier_type& do_get_src_field_id (const int ifield) const override {
+    return m_first->get_src_field_id(ifield);
+  }
+  const identifier_type& do_get_tgt_field_id (const int ifield) const override {
+    return m_second->get_tgt_field_id(ifield);
+  }
+  const field_type& do_get_src_field (const int ifield) const override {
+    return m_first->get_src_field(ifield);
+  }
+  const field_type& do_get_tgt_field (const int ifield) const override {
+    return m_second->get_tgt_field(ifield);
+  }
+
+  void do_remap_fwd () override {
+    m_first->remap(true);
+    m_second->remap(true);
+  }
+  void do_remap_bwd () override {
+    m_second->remap(false);
+    m_first->remap(false);
+  }
+
+  void do_registration_begins () override {
+    m_first->registration_begins();
+    m_second->registration_begins();
+  }
+  void do_register_field (const identifier_type& src, const identifier_type& tgt) override {
+    // Create the intermediate field id, and register both pairs
+    const auto& mid_grid = m_first->get_tgt_grid();
+    identifier_type mid (src.name(),m_first->create_tgt_layout(src.get_layout()),
+                         src.get_units(),mid_grid->name(),src.data_type());
+    m_first->register_field(src,mid);
+    m_second->register_field(mid,tgt);
+    m_mid_fields.emplace_back(mid);
+  }
+  void do_bind_field (const int ifield,
+                      const field_type& src,
+                      const field_type& tgt) override {
+    // Allocate the intermediate field, with the largest pack size of src/tgt
+    auto& mid = m_mid_fields[ifield];
+    const auto& src_ap = src.get_header().get_alloc_properties();
+    const auto& tgt_ap = tgt.get_header().get_alloc_properties();
+    auto& mid_ap = mid.get_header().get_alloc_properties();
+    mid_ap.request_allocation(std::max(src_ap.get_largest_pack_size(),
+                                       tgt_ap.get_largest_pack_size()));
+    mid.allocate_view();
+
+    m_first->bind_field(src,mid);
+    m_second->bind_field(mid,tgt);
+  }
+  void do_registration_ends () override {
+    m_first->registration_ends();
+    m_second->registration_ends();
+  }
+
+  std::shared_ptr<base_type>  m_first;
+  std::shared_ptr<base_type>  m_second;
+
+  std::vector<field_type>     m_mid_fields;
+};
+
+} // namespace scream
+
+#endif // SCREAM_COMPOSED_REMAPPER_HPP
@@ -0,0 +1,272 @@
+#include "share/grid/remap/redistribution_remapper.hpp"
+
+#include "share/grid/grid_import_export.hpp"
+#include "share/util/scream_utils.hpp"
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace scream
+{
+
+RedistributionRemapper::
+RedistributionRemapper (const grid_ptr_type& src_grid,
+                        const grid_ptr_type& tgt_grid)
+ : AbstractRemapper(src_grid,tgt_grid)
+ , m_comm (src_grid->get_comm())
+{
+  EKAT_REQUIRE_MSG (src_grid->get_num_global_dofs()==tgt_grid->get_num_global_dofs(),
+      "Error! RedistributionRemapper requires src/tgt grids with the same number of dofs.\n"
+      "  - src grid name: " + src_grid->name() + "\n"
+      "  - tgt grid name: " + tgt_grid->name() + "\n"
+      "  - src grid num global dofs: " + std::to_string(src_grid->get_num_global_dofs()) + "\n"
+      "  - tgt grid num global dofs: " + std::to_string(tgt_grid->get_num_global_dofs()) + "\n");
+  EKAT_REQUIRE_MSG (src_grid->get_num_vertical_levels()==tgt_grid->get_num_vertical_levels(),
+      "Error! RedistributionRemapper requires src/tgt grids with the same number of levels.\n"
+      "  - src grid name: " + src_grid->name() + "\n"
+      "  - tgt grid name: " + tgt_grid->name() + "\n");
+  EKAT_REQUIRE_MSG (src_grid->type()==GridType::Point and tgt_grid->type()==GridType::Point,
+      "Error! RedistributionRemapper only works with Point grids.\n"
+      "  - src grid name: " + src_grid->name() + "\n"
+      "  - tgt grid name: " + tgt_grid->name() + "\n");
+
+  // Note: GridImportExport checks that the 'from' grid is unique, and that
+  //       each gid of the 'to' grid is owned by some rank in the 'from' grid
+  m_fwd_imp_exp = std::make_shared<GridImportExport>(src_grid,tgt_grid);
+  m_bwd_imp_exp = std::make_shared<GridImportExport>(tgt_grid,src_grid);
+}
+
+FieldLayout RedistributionRemapper::
+create_src_layout (const FieldLayout& tgt_layout) const
+{
+  using namespace ShortFieldTagsNames;
+  EKAT_REQUIRE_MSG (is_valid_tgt_layout(tgt_layout),
+      "[RedistributionRemapper] Error! Input target layout is not valid for this remapper.\n"
+      " - input layout: " + tgt_layout.to_string());
+
+  return tgt_layout.clone().reset_dim(COL,m_src_grid->get_num_local_dofs(),false);
+}
+
+FieldLayout RedistributionRemapper::
+create_tgt_layout (const FieldLayout& src_layout) const
+{
+  using namespace ShortFieldTagsNames;
+  EKAT_REQUIRE_MSG (is_valid_src_layout(src_layout),
+      "[RedistributionRemapper] Error! Input source layout is not valid for this remapper.\n"
+      " - input layout: " + src_layout.to_string());
+
+  return src_layout.clone().reset_dim(COL,m_tgt_grid->get_num_local_dofs(),false);
+}
+
+bool RedistributionRemapper::
+compatible_layouts (const layout_type& src,
+                    const layout_type& tgt) const
+{
+  // Only the extent of the COL dim is allowed to differ
+  using namespace ShortFieldTagsNames;
+  return src.has_tag(COL)==tgt.has_tag(COL) and
+         src.clone().strip_dim(COL,false).congruent(tgt.clone().strip_dim(COL,false));
+}
+
+void RedistributionRemapper::
+do_register_field (const identifier_type& src, const identifier_type& tgt)
+{
+  using namespace ShortFieldTagsNames;
+  const auto& layout = src.get_layout();
+  EKAT_REQUIRE_MSG (not layout.has_tag(COL) or layout.tag(0)==COL,
+      "Error! RedistributionRemapper requires COL to be the first dimension.\n"
+      "  - field name: " + src.name() + "\n"
+      "  - field layout: " + layout.to_string() + "\n");
+
+  m_src_fields.push_back(field_type(src));
+  m_tgt_fields.push_back(field_type(tgt));
+}
+
+void RedistributionRemapper::
+do_bind_field (const int ifield, const field_type& src, const field_type& tgt)
+{
+  EKAT_REQUIRE_MSG (src.data_type()==DataType::RealType,
+      "Error! RedistributionRemapper only allows fields with RealType data.\n"
+      "  - src field name: " + src.name() + "\n"
+      "  - src field type: " + e2str(src.data_type()) + "\n");
+  EKAT_REQUIRE_MSG (tgt.data_type()==DataType::RealType,
+      "Error! RedistributionRemapper only allows fields with RealType data.\n"
+      "  - tgt field name: " + tgt.name() + "\n"
+      "  - tgt field type: " + e2str(tgt.data_type()) + "\n");
+
+  m_src_fields[ifield] = src;
+  m_tgt_fields[ifield] = tgt;
+}
+
+void RedistributionRemapper::do_registration_ends ()
+{
+  // Nothing to do: GridImportExport sets up buffers and requests at the first transfer
+}
+
+void RedistributionRemapper::do_remap_fwd ()
+{
+  transfer(*m_fwd_imp_exp,m_src_fields,m_tgt_fields);
+}
+
+void RedistributionRemapper::do_remap_bwd ()
+{
+  transfer(*m_bwd_imp_exp,m_tgt_fields,m_src_fields);
+}
+
+void RedistributionRemapper::
+transfer (GridImportExport& imp_exp,
+          const std::vector<Field>& from,
+          const std::vector<Field>& to)
+{
+  // Fields without COL tag are the same on all ranks: simply copy them.
+  // All the others are moved together, with one message per remote rank.
+  constexpr auto COL = ShortFieldTagsNames::COL;
+  std::vector<Field> from_cols, to_cols;
+  for (int i=0; i<m_num_fields; ++i) {
+    if (from[i].get_header().get_identifier().get_layout().has_tag(COL)) {
+      from_cols.push_back(from[i]);
+      to_cols.push_back(to[i]);
+    } else {
+      auto tgt = to[i];
+      tgt.deep_copy(from[i]);
+    }
+  }
+
+  imp_exp.scatter(from_cols,to_cols);
+}
+
+std::shared_ptr<PointGrid>
+create_cost_balanced_grid (const std::string& name,
+                           const std::shared_ptr<const AbstractGrid>& grid,
+                           const Field& cost)
+{
+  using gid_type = AbstractGrid::gid_type;
+  using namespace ShortFieldTagsNames;
+
+  EKAT_REQUIRE_MSG (grid!=nullptr,
+      "Error! Invalid grid pointer in create_cost_balanced_grid.\n");
+  EKAT_REQUIRE_MSG (cost.get_header().get_identifier().get_layout().congruent(grid->get_2d_scalar_layout()),
+      "Error! The cost field must be a 2d scalar field on the input grid.\n"
+      "  - grid name: " + grid->name() + "\n"
+      "  - cost field name: " + cost.name() + "\n"
+      "  - cost field layout: " + cost.get_header().get_identifier().get_layout().to_string() + "\n");
+
+  const auto& comm = grid->get_comm();
+  const int nranks = comm.size();
+  const int nlcols = grid->get_num_local_dofs();
+  const int ngcols = grid->get_num_global_dofs();
+  EKAT_REQUIRE_MSG (ngcols>=nranks,
+      "Error! Cannot balance a grid with fewer columns than MPI ranks.\n"
+      "  - grid name: " + grid->name() + "\n"
+      "  - num global cols: " + std::to_string(ngcols) + "\n"
+      "  - num MPI ranks  : " + std::to_string(nranks) + "\n");
+
+  // Gather (gid,cost) of all columns on all ranks
+  std::vector<int> counts (nranks), offsets (nranks+1,0);
+  counts[comm.rank()] = nlcols;
+  comm.all_gather(counts.data(),1);
+  for (int pid=0; pid<nranks; ++pid) {
+    offsets[pid+1] = offsets[pid] + counts[pid];
+  }
+  EKAT_REQUIRE_MSG (offsets[nranks]==ngcols,
+      "Error! Input grid is not unique, cannot create a cost-balanced grid.\n"
+      "  - grid name: " + grid->name() + "\n");
+
+  cost.sync_to_host();
+  auto cost_h = cost.get_view<const Real*,Host>();
+  auto gids_h = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  std::vector<double> my_costs (nlcols);
+  for (int icol=0; icol<nlcols; ++icol) {
+    my_costs[icol] = cost_h(icol);
+    EKAT_REQUIRE_MSG (std::isfinite(my_costs[icol]) and my_costs[icol]>=0,
+        "Error! Column costs must be finite and non-negative.\n"
+        "  - grid name: " + grid->name() + "\n"
+        "  - column gid: " + std::to_string(gids_h(icol)) + "\n"
+        "  - column cost: " + std::to_string(my_costs[icol]) + "\n");
+  }
+
+  std::vector<gid_type> all_gids (ngcols);
+  std::vector<double> all_costs (ngcols);
+  const auto mpi_gid_t = ekat::get_mpi_type<gid_type>();
+  check_mpi_call(MPI_Allgatherv (gids_h.data(),nlcols,mpi_gid_t,
+                                 all_gids.data(),counts.data(),offsets.data(),
+                                 mpi_gid_t,comm.mpi_comm()),
+                 "[create_cost_balanced_grid] gathering gids.\n");
+  check_mpi_call(MPI_Allgatherv (my_costs.data(),nlcols,MPI_DOUBLE,
+                                 all_costs.data(),counts.data(),offsets.data(),
+                                 MPI_DOUBLE,comm.mpi_comm()),
+                 "[create_cost_balanced_grid] gathering costs.\n");
+
+  // Sort columns by gid, and compute the prefix sum of the costs
+  std::vector<int> perm (ngcols);
+  std::iota(perm.begin(),perm.end(),0);
+  std::sort(perm.begin(),perm.end(),[&](const int i, const int j) {
+    return all_gids[i]<all_gids[j];
+  });
+  std::vector<double> cost_scan (ngcols+1,0);
+  for (int i=0; i<ngcols; ++i) {
+    cost_scan[i+1] = cost_scan[i] + all_costs[perm[i]];
+  }
+  // If no cost info is available, balance the number of columns
+  if (cost_scan[ngcols]<=0) {
+    std::iota(cost_scan.begin(),cost_scan.end(),0.0);
+  }
+
+  // Rank pid owns sorted columns in [bounds[pid],bounds[pid+1]). Place each bound
+  // where the prefix sum is closest to the ideal one, making sure each rank keeps
+  // at least one column.
+  const double total_cost = cost_scan[ngcols];
+  std::vector<int> bounds (nranks+1,0);
+  bounds[nranks] = ngcols;
+  for (int pid=1; pid<nranks; ++pid) {
+    const double target = total_cost*pid/nranks;
+    int b = std::lower_bound(cost_scan.begin(),cost_scan.end(),target) - cost_scan.begin();
+    if (b>0 and (target-cost_scan[b-1])<(cost_scan[b]-target)) {
+      --b;
+    }
+    bounds[pid] = std::max(bounds[pid-1]+1,std::min(b,ngcols-(nranks-pid)));
+  }
+
+  const int my_beg = bounds[comm.rank()];
+  const int my_end = bounds[comm.rank()+1];
+  auto new_grid = std::make_shared<PointGrid>(name,my_end-my_beg,ngcols,
+                                              grid->get_num_vertical_levels(),comm);
+  new_grid->setSelfPointer(new_grid);
+
+  auto dofs = new_grid->get_dofs_gids();
+  auto dofs_h = dofs.get_view<gid_type*,Host>();
+  for (int i=my_beg; i<my_end; ++i) {
+    dofs_h(i-my_beg) = all_gids[perm[i]];
+  }
+  dofs.sync_to_dev();
+
+  // Redistribute the geometry data of the input grid. Data without
+  // the COL dimension is the same on all ranks, so we simply copy it
+  RedistributionRemapper remapper(grid,new_grid);
+  remapper.registration_begins();
+  for (const auto& gname : grid->get_geometry_data_names()) {
+    const auto src = grid->get_geometry_data(gname);
+    const auto& src_fid = src.get_header().get_identifier();
+    const auto& src_layout = src_fid.get_layout();
+    auto tgt = new_grid->create_geometry_data(
+        FieldIdentifier(gname,src_layout.clone().reset_dim(COL,new_grid->get_num_local_dofs(),false),
+                        src_fid.get_units(),new_grid->name(),src_fid.data_type()));
+    if (src_layout.has_tag(COL)) {
+      remapper.register_field(src,tgt);
+    } else {
+      tgt.deep_copy(src);
+    }
+  }
+  remapper.registration_ends();
+  remapper.remap(true);
+  for (const auto& gname : new_grid->get_geometry_data_names()) {
+    new_grid->get_geometry_data(gname).sync_to_host();
+  }
+
+  return new_grid;
+}
+
+} // namespace scream
@@ -0,0 +1,97 @@
+#ifndef SCREAM_REDISTRIBUTION_REMAPPER_HPP
+#define SCREAM_REDISTRIBUTION_REMAPPER_HPP
+
+#include "share/grid/remap/abstract_remapper.hpp"
+#include "share/grid/point_grid.hpp"
+
+namespace scream
+{
+
+class GridImportExport;
+
+/*
+ * A remapper to move columns between two decompositions of the same set of dofs
+ *
+ * Src and tgt grids must be unique, and must contain the same set of gids,
+ * possibly partitioned differently across ranks. No interpolation happens:
+ * each column is simply sent from the rank that owns it on one grid to the rank
+ * that owns it on the other grid.
+ *
+ * The communication pattern is computed via GridImportExport (one for each
+ * direction), and the runtime transfer uses its batched scatter, which packs
+ * all the fields in a single buffer per remote rank, and uses persistent
+ * send/recv requests.
+ *
+ * Fields that do not have the COL tag are simply deep-copied.
+ */
+
+class RedistributionRemapper : public AbstractRemapper
+{
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+
+  RedistributionRemapper (const grid_ptr_type& src_grid,
+                          const grid_ptr_type& tgt_grid);
+
+  ~RedistributionRemapper () = default;
+
+  FieldLayout create_src_layout (const FieldLayout& tgt_layout) const override;
+  FieldLayout create_tgt_layout (const FieldLayout& src_layout) const override;
+
+  bool compatible_layouts (const layout_type& src,
+                           const layout_type& tgt) const override;
+
+protected:
+
+  const identifier_type& do_get_src_field_id (const int ifield) const override {
+    return m_src_fields[ifield].get_header().get_identifier();
+  }
+  const identifier_type& do_get_tgt_field_id (const int ifield) const override {
+    return m_tgt_fields[ifield].get_header().get_identifier();
+  }
+  const field_type& do_get_src_field (const int ifield) const override {
+    return m_src_fields[ifield];
+  }
+  const field_type& do_get_tgt_field (const int ifield) const override {
+    return m_tgt_fields[ifield];
+  }
+
+  void do_registration_begins () override {}
+  void do_register_field (const identifier_type& src, const identifier_type& tgt) override;
+  void do_bind_field (const int ifield, const field_type& src, const field_type& tgt) override;
+  void do_registration_ends () override;
+
+  void do_remap_fwd () override;
+  void do_remap_bwd () override;
+
+  void transfer (GridImportExport& imp_exp,
+                 const std::vector<Field>& from,
+                 const std::vector<Field>& to);
+
+  std::vector<Field>  m_src_fields;
+  std::vector<Field>  m_tgt_fields;
+
+  // Import/export data for src->tgt (fwd) and tgt->src (bwd)
+  std::shared_ptr<GridImportExport>  m_fwd_imp_exp;
+  std::shared_ptr<GridImportExport>  m_bwd_imp_exp;
+
+  ekat::Comm    m_comm;
+};
+
+// Create a PointGrid with the same dofs of the input grid, but where columns
+// are distributed across ranks so that each rank owns (roughly) the same
+// fraction of the total cost. The input cost field must be a 2d scalar field
+// on the input grid, with non-negative entries. Columns are assigned to ranks
+// in contiguous chunks of the gid-sorted list of all dofs, so that physics
+// columns that are close in gid space stay close in the new decomposition.
+// All the geometry data of the input grid is redistributed on the new grid.
+std::shared_ptr<PointGrid>
+create_cost_balanced_grid (const std::string& name,
+                           const std::shared_ptr<const AbstractGrid>& grid,
+                           const Field& cost);
+
+} // namespace scream
+
+#endif // SCREAM_REDISTRIBUTION_REMAPPER_HPP
@@ -0,0 +1,156 @@
+#include "share/io/scorpio_multi_input.hpp"
+
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include <ekat/ekat_assert.hpp>
+#include <ekat/std_meta/ekat_std_utils.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+
+namespace scream
+{
+
+MultiFileInput::
+MultiFileInput (const ekat::Comm& comm)
+ : m_comm (comm)
+{
+  // Nothing to do here
+}
+
+void MultiFileInput::
+add_fields (const std::string& filename,
+            const std::shared_ptr<const AbstractGrid>& grid,
+            const std::vector<Field>& fields)
+{
+  EKAT_REQUIRE_MSG (grid!=nullptr,
+      "Error! Invalid grid pointer.\n"
+      " - filename: " + filename + "\n");
+
+  if (fields.size()==0) {
+    return;
+  }
+
+  // If we already have a request for this file and grid, simply append
+  for (auto& r : m_requests) {
+    if (r.filename==filename and r.grid==grid) {
+      for (const auto& f : fields) {
+        r.fields.push_back(f);
+      }
+      return;
+    }
+  }
+
+  m_requests.push_back(Request{filename,grid,fields});
+}
+
+void MultiFileInput::read_all ()
+{
+  using clock = std::chrono::steady_clock;
+  auto elapsed = [](const clock::time_point& start) {
+    return std::chrono::duration<double>(clock::now()-start).count();
+  };
+
+  // 1. Open all the files. Holding a customer on the file ensures that
+  //    the readers below will not re-open it, nor close it when done.
+  std::vector<std::string> filenames;
+  for (const auto& r : m_requests) {
+    if (not ekat::contains(filenames,r.filename)) {
+      filenames.push_back(r.filename);
+    }
+  }
+  for (const auto& fn : filenames) {
+    auto start = clock::now();
+    scorpio::register_file(fn,scorpio::Read);
+    m_timings[fn].open = max_elapsed(elapsed(start));
+  }
+
+  // A file dimension can only be decomposed in one way while the file is open.
+  // If two grids partition the same dim of the same file differently, we must
+  // process one of them after the file has been closed.
+  auto decomp_dim_name = [](const std::shared_ptr<const AbstractGrid>& grid) {
+    const auto tag = grid->get_partitioned_dim_tag();
+    return grid->has_special_tag_name(tag) ? grid->get_special_tag_name(tag) : e2str(tag);
+  };
+  std::map<std::string,std::map<std::string,std::string>> file_dim_to_grid;
+  std::vector<const Request*> batched, deferred;
+  for (const auto& r : m_requests) {
+    auto& dim2grid = file_dim_to_grid[r.filename];
+    const auto dim = decomp_dim_name(r.grid);
+    if (dim2grid.count(dim)==0) {
+      dim2grid[dim] = r.grid->name();
+    }
+    if (dim2grid.at(dim)==r.grid->name()) {
+      batched.push_back(&r);
+    } else {
+      deferred.push_back(&r);
+    }
+  }
+
+  // 2. Set up all readers. Decompositions are built once per unique
+  //    layout, and then recycled by the scorpio interface
+  std::vector<std::unique_ptr<AtmosphereInput>> readers;
+  for (auto r : batched) {
+    auto start = clock::now();
+    readers.emplace_back(new AtmosphereInput(r->filename,r->grid,r->fields));
+    readers.back()->set_logger(m_atm_logger);
+    auto& t = m_timings[r->filename];
+    t.setup += max_elapsed(elapsed(start));
+    t.nvars += r->fields.size();
+  }
+
+  // 3. Read all variables
+  for (size_t i=0; i<batched.size(); ++i) {
+    auto start = clock::now();
+    readers[i]->read_variables();
+    m_timings[batched[i]->filename].read += max_elapsed(elapsed(start));
+  }
+
+  // 4. Release all readers and files
+  for (auto& r : readers) {
+    r->finalize();
+  }
+  for (const auto& fn : filenames) {
+    scorpio::release_file(fn);
+  }
+
+  // Now that files are closed, process any conflicting request, one at a time
+  for (auto r : deferred) {
+    auto start = clock::now();
+    AtmosphereInput reader(r->filename,r->grid,r->fields);
+    reader.set_logger(m_atm_logger);
+    auto& t = m_timings[r->filename];
+    t.setup += max_elapsed(elapsed(start));
+    t.nvars += r->fields.size();
+
+    start = clock::now();
+    reader.read_variables();
+    reader.finalize();
+    t.read += max_elapsed(elapsed(start));
+  }
+  m_requests.clear();
+
+  if (m_atm_logger) {
+    m_atm_logger->info("[EAMxx::multi_file_input] Timings (max over ranks, in seconds):");
+    for (const auto& fn : filenames) {
+      const auto& t = m_timings.at(fn);
+      std::stringstream ss;
+      ss << std::fixed << std::setprecision(3)
+         << "  open: " << t.open << ", setup: " << t.setup << ", read: " << t.read
+         << " (" << t.nvars << " vars)";
+      m_atm_logger->info("  file name: " + fn);
+      m_atm_logger->info(ss.str());
+    }
+  }
+}
+
+double MultiFileInput::
+max_elapsed (const double local) const
+{
+  double global;
+  m_comm.all_reduce(&local,&global,1,MPI_MAX);
+  return global;
+}
+
+} // namespace scream
@@ -0,0 +1,90 @@
+#ifndef SCREAM_SCORPIO_MULTI_INPUT_HPP
+#define SCREAM_SCORPIO_MULTI_INPUT_HPP
+
+#include "share/io/scorpio_input.hpp"
+#include "share/field/field.hpp"
+#include "share/grid/abstract_grid.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+#include "ekat/logging/ekat_logger.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A class to load fields from several input files at once
+ *
+ * At initialization, the atm driver may need to read fields from several
+ * files (IC file, topography file,...), possibly on different grids.
+ * Reading them one AtmosphereInput at a time means that each file is
+ * opened, set up, read, and closed before moving on to the next one.
+ * This class gathers all the requests first, and then processes them
+ * in phases:
+ *   1. open all the files (metadata reads are done once per file),
+ *   2. set up all the readers, so that the PIO decompositions are built
+ *      once per unique layout (the scorpio interface recycles them
+ *      across files and readers),
+ *   3. read all the variables,
+ *   4. release all files.
+ * PIO reads are collective and blocking, so phases are not overlapped
+ * across threads. The number of I/O tasks used by each read is the one
+ * configured for the PIO subsystem (e.g., via PIO_NUMTASKS/PIO_STRIDE).
+ *
+ * Timings (max across ranks) for each phase are collected per file,
+ * and can be logged or retrieved via get_timings().
+ */
+
+class MultiFileInput
+{
+public:
+  struct FileTimings {
+    double open  = 0;   // Open file, read metadata
+    double setup = 0;   // Check vars, set decompositions
+    double read  = 0;   // Read variables
+    int    nvars = 0;
+  };
+
+  explicit MultiFileInput (const ekat::Comm& comm);
+
+  // Request to read the given fields from a file. The fields must all be on
+  // the input grid (which is the IO grid of the file). Field names must match
+  // the var names in the file (use Field::alias if they don't).
+  // Can be called multiple times for the same file (e.g., for different grids).
+  void add_fields (const std::string& filename,
+                   const std::shared_ptr<const AbstractGrid>& grid,
+                   const std::vector<Field>& fields);
+
+  // Process all requests
+  void read_all ();
+
+  const std::map<std::string,FileTimings>& get_timings () const { return m_timings; }
+
+  void set_logger (const std::shared_ptr<ekat::logger::LoggerBase>& atm_logger) {
+    m_atm_logger = atm_logger;
+  }
+
+protected:
+
+  struct Request {
+    std::string                         filename;
+    std::shared_ptr<const AbstractGrid> grid;
+    std::vector<Field>                  fields;
+  };
+
+  double max_elapsed (const double local) const;
+
+  ekat::Comm                            m_comm;
+  std::vector<Request>                  m_requests;
+  std::map<std::string,FileTimings>     m_timings;
+
+  std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
+};
+
+} // namespace scream
+
+#endif // SCREAM_SCORPIO_MULTI_INPUT_HPP
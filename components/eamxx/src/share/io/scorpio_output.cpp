@@ -416,15 +416,13 @@ run (const std::string& filename,
 
   // If needed, remap fields from their grid to the unique grid, for I/O
   if (m_vert_remapper) {
-    start_timer("EAMxx::IO::vert_remap");
+    ScopedTimer timer(m_vert_remap_timer);
     apply_remap(m_vert_remapper);
-    stop_timer("EAMxx::IO::vert_remap");
   }
 
   if (m_horiz_remapper) {
-    start_timer("EAMxx::IO::horiz_remap");
+    ScopedTimer timer(m_horiz_remap_timer);
     apply_remap(m_horiz_remapper);
-    stop_timer("EAMxx::IO::horiz_remap");
   }
 
   // Update all of the averaging count views (if needed)
@@ -498,6 +496,7 @@ run (const std::string& filename,
 
     // If the dev_view_1d is aliasing the field device view (must be Instant output),
     // then there's no point in copying from the field's view to dev_view
+    m_accumulate_timer.start();
     if (not is_aliasing_field_view) {
       switch (rank) {
         case 1:
@@ -617,11 +616,19 @@ run (const std::string& filename,
           });
         }
       }
+    }
+    m_accumulate_timer.stop();
+
+    if (is_write_step) {
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
+      m_host_copy_timer.start();
       Kokkos::deep_copy (view_host,view_dev);
+      m_host_copy_timer.stop();
       auto func_start = std::chrono::steady_clock::now();
+      m_write_timer.start();
       scorpio::write_var(filename,name,view_host.data());
+      m_write_timer.stop();
       auto func_finish = std::chrono::steady_clock::now();
       auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
       duration_write += duration_loc.count();
@@ -633,9 +640,13 @@ run (const std::string& filename,
       auto& view_dev = m_dev_views_1d.at(name);
       // Bring data to host
       auto view_host = m_host_views_1d.at(name);
+      m_host_copy_timer.start();
       Kokkos::deep_copy (view_host,view_dev);
+      m_host_copy_timer.stop();
       auto func_start = std::chrono::steady_clock::now();
+      m_write_timer.start();
       scorpio::write_var(filename,name,view_host.data());
+      m_write_timer.stop();
       auto func_finish = std::chrono::steady_clock::now();
       auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
       duration_write += duration_loc.count();
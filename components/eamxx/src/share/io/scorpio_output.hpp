@@ -7,6 +7,7 @@
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
 #include "share/util//scream_time_stamp.hpp"
+#include "share/util/scream_timing.hpp"
 #include "share/atm_process/atmosphere_diagnostic.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
@@ -222,6 +223,14 @@ protected:
   bool m_add_time_dim;
   bool m_track_avg_cnt = false;
 
+  // Timers used at every step. Since kernels are asynchronous, on GPU part of
+  // the accumulate (and remap) time may show up in the host copy timer.
+  TimerHandle m_vert_remap_timer  {"EAMxx::IO::vert_remap"};
+  TimerHandle m_horiz_remap_timer {"EAMxx::IO::horiz_remap"};
+  TimerHandle m_accumulate_timer  {"EAMxx::IO::accumulate"};
+  TimerHandle m_host_copy_timer   {"EAMxx::IO::host_copy"};
+  TimerHandle m_write_timer       {"EAMxx::IO::write"};
+
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 };
@@ -0,0 +1,444 @@
+#include "share/io/scream_node_local_checkpoint.hpp"
+
+#include "share/util/scream_utils.hpp"
+
+#include "ekat/ekat_assert.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace scream
+{
+
+namespace {
+// Magic string and version at the beginning of each binary slice
+constexpr char nlc_magic[8] = {'E','A','M','X','X','N','L','C'};
+constexpr std::int32_t nlc_version = 1;
+
+// Fields on different grids may have the same name, so we add the grid name
+std::string field_key (const Field& f) {
+  const auto& fid = f.get_header().get_identifier();
+  return fid.get_grid_name() + "::" + fid.name();
+}
+} // anonymous namespace
+
+NodeLocalCheckpoint::
+NodeLocalCheckpoint (const ekat::Comm& comm, const ekat::ParameterList& params)
+ : m_comm (comm)
+{
+  EKAT_REQUIRE_MSG (params.isParameter("local_path"),
+      "Error! Node-local checkpointing requires the parameter 'local_path'.\n");
+
+  m_local_path = params.get<std::string>("local_path");
+  m_drain_path = params.get<std::string>("drain_path",".");
+  m_keep_local_copy = params.get("keep_local_copy",false);
+
+  EKAT_REQUIRE_MSG (m_local_path!="",
+      "Error! Invalid (empty) string for 'local_path'.\n");
+  EKAT_REQUIRE_MSG (m_drain_path!="",
+      "Error! Invalid (empty) string for 'drain_path'.\n");
+
+  // Create the dirs if needed. If the two paths point to the same location,
+  // there is no need to drain anything
+  namespace fs = std::filesystem;
+  std::error_code ec;
+  fs::create_directories(m_local_path,ec);
+  fs::create_directories(m_drain_path,ec);
+  EKAT_REQUIRE_MSG (fs::is_directory(m_local_path) and fs::is_directory(m_drain_path),
+      "Error! Could not create node-local checkpoint directories.\n"
+      " - local_path: " + m_local_path + "\n"
+      " - drain_path: " + m_drain_path + "\n");
+  m_same_path = fs::equivalent(m_local_path,m_drain_path);
+
+  m_drain_thread = std::thread(&NodeLocalCheckpoint::drain_loop,this);
+}
+
+NodeLocalCheckpoint::
+~NodeLocalCheckpoint ()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_cv.notify_all();
+  if (m_drain_thread.joinable()) {
+    m_drain_thread.join();
+  }
+}
+
+std::string NodeLocalCheckpoint::
+write (const std::string& name,
+       const std::vector<Field>& fields,
+       const globals_map_t& globals,
+       const int nsteps)
+{
+  // Do not let checkpoints pile up: if the previous one is still draining,
+  // wait for it. This also ensures the local path does not fill up.
+  wait_for_drain();
+
+  const auto manifest = m_drain_path + "/" + name;
+  const auto local_slice = slice_name(m_local_path + "/" + name,m_comm.rank());
+
+  // Write the local slice
+  std::ofstream out (local_slice,std::ios::binary);
+  EKAT_REQUIRE_MSG (out.good(),
+      "Error! Could not open node-local checkpoint file for writing.\n"
+      " - file name: " + local_slice + "\n");
+
+  const std::int32_t rank   = m_comm.rank();
+  const std::int32_t nranks = m_comm.size();
+  const std::int32_t nfields = fields.size();
+  out.write(nlc_magic,sizeof(nlc_magic));
+  out.write(reinterpret_cast<const char*>(&nlc_version),sizeof(nlc_version));
+  out.write(reinterpret_cast<const char*>(&rank),sizeof(rank));
+  out.write(reinterpret_cast<const char*>(&nranks),sizeof(nranks));
+  out.write(reinterpret_cast<const char*>(&nfields),sizeof(nfields));
+  for (const auto& f : fields) {
+    // Subfields store the parent allocation, so we need a contiguous copy
+    const auto& ap = f.get_header().get_alloc_properties();
+    const auto src = ap.is_subfield() ? f.clone() : f;
+    src.sync_to_host();
+
+    const auto fname = field_key(f);
+    const std::int32_t name_len = fname.size();
+    const std::int64_t nbytes = src.get_header().get_alloc_properties().get_alloc_size();
+    out.write(reinterpret_cast<const char*>(&name_len),sizeof(name_len));
+    out.write(fname.data(),name_len);
+    out.write(reinterpret_cast<const char*>(&nbytes),sizeof(nbytes));
+    out.write(src.get_internal_view_data_unsafe<const char,Host>(),nbytes);
+  }
+  out.close();
+  EKAT_REQUIRE_MSG (not out.fail(),
+      "Error! Something went wrong while writing node-local checkpoint file.\n"
+      " - file name: " + local_slice + "\n");
+
+  // The root rank writes the manifest directly in the drain path. It is a small
+  // text file, so it's cheap. We write to a tmp file and then rename, so that
+  // a reader never sees a partial manifest.
+  if (m_comm.am_i_root()) {
+    const auto tmp = manifest + ".tmp";
+    std::ofstream mf (tmp);
+    EKAT_REQUIRE_MSG (mf.good(),
+        "Error! Could not open node-local checkpoint manifest for writing.\n"
+        " - file name: " + manifest + "\n");
+    mf << std::setprecision(std::numeric_limits<double>::max_digits10);
+    mf << "version " << nlc_version << "\n";
+    mf << "num_ranks " << nranks << "\n";
+    mf << "nsteps " << nsteps << "\n";
+    for (const auto& it : globals) {
+      const auto& gname = it.first;
+      const auto& any = it.second;
+      if (any.isType<int>()) {
+        mf << "global:int:" << gname << " " << ekat::any_cast<int>(any) << "\n";
+      } else if (any.isType<std::int64_t>()) {
+        mf << "global:int64:" << gname << " " << ekat::any_cast<std::int64_t>(any) << "\n";
+      } else if (any.isType<float>()) {
+        mf << "global:float:" << gname << " " << ekat::any_cast<float>(any) << "\n";
+      } else if (any.isType<double>()) {
+        mf << "global:double:" << gname << " " << ekat::any_cast<double>(any) << "\n";
+      } else if (any.isType<std::string>()) {
+        mf << "global:string:" << gname << " " << ekat::any_cast<std::string>(any) << "\n";
+      } else {
+        EKAT_ERROR_MSG (
+            "Error! Invalid concrete type for node-local checkpoint global.\n"
+            " - global name: " + gname + "\n"
+            " - type id    : " + any.content().type().name() + "\n");
+      }
+    }
+    mf.close();
+    EKAT_REQUIRE_MSG (std::rename(tmp.c_str(),manifest.c_str())==0,
+        "Error! Could not rename node-local checkpoint manifest.\n"
+        " - file name: " + manifest + "\n");
+  }
+
+  // Schedule the drain
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_drain_queue.emplace_back(local_slice,slice_name(manifest,m_comm.rank()));
+    ++m_num_pending;
+  }
+  m_cv.notify_all();
+
+  return manifest;
+}
+
+void NodeLocalCheckpoint::wait_for_drain ()
+{
+  std::string drain_error;
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock,[&]{ return m_num_pending==0; });
+    drain_error = m_drain_error;
+  }
+
+  // A checkpoint is only usable if all slices were drained. Agree on the outcome,
+  // so that either all ranks move on, or all ranks throw (rather than one rank
+  // throwing, and the others hanging in the next collective call).
+  int my_ok = drain_error=="" ? 1 : 0;
+  int all_ok;
+  m_comm.all_reduce(&my_ok,&all_ok,1,MPI_MIN);
+  EKAT_REQUIRE_MSG (all_ok==1,
+      "Error! Something went wrong while draining node-local checkpoint.\n" +
+      (my_ok==1 ? std::string(" See the error message from the rank(s) where the drain failed.\n")
+                : drain_error));
+}
+
+bool NodeLocalCheckpoint::
+is_node_local_checkpoint (const std::string& filename)
+{
+  const auto ext = extension();
+  return filename.size()>ext.size() and
+         filename.compare(filename.size()-ext.size(),ext.size(),ext)==0;
+}
+
+void NodeLocalCheckpoint::
+read_fields (const std::string& manifest,
+             const ekat::Comm& comm,
+             const std::vector<Field>& fields)
+{
+  std::map<std::string,std::string> entries;
+  read_manifest(manifest,comm,entries);
+
+  EKAT_REQUIRE_MSG (std::stoi(entries.at("num_ranks"))==comm.size(),
+      "Error! Node-local checkpoints can only be read with the same number of ranks used to write them.\n"
+      " - manifest: " + manifest + "\n"
+      " - num ranks in checkpoint: " + entries.at("num_ranks") + "\n"
+      " - num ranks in this run  : " + std::to_string(comm.size()) + "\n");
+
+  const auto slice = slice_name(manifest,comm.rank());
+  std::ifstream in (slice,std::ios::binary);
+  EKAT_REQUIRE_MSG (in.good(),
+      "Error! Could not open node-local checkpoint slice.\n"
+      " - file name: " + slice + "\n"
+      " The drain of the checkpoint may not have completed before the run ended.\n");
+
+  char magic[sizeof(nlc_magic)];
+  std::int32_t version, rank, nranks, nfields;
+  in.read(magic,sizeof(magic));
+  in.read(reinterpret_cast<char*>(&version),sizeof(version));
+  in.read(reinterpret_cast<char*>(&rank),sizeof(rank));
+  in.read(reinterpret_cast<char*>(&nranks),sizeof(nranks));
+  in.read(reinterpret_cast<char*>(&nfields),sizeof(nfields));
+  EKAT_REQUIRE_MSG (std::string(magic,sizeof(magic))==std::string(nlc_magic,sizeof(nlc_magic)),
+      "Error! File is not a valid node-local checkpoint slice.\n"
+      " - file name: " + slice + "\n");
+  EKAT_REQUIRE_MSG (version==nlc_version,
+      "Error! Unsupported node-local checkpoint version.\n"
+      " - file name: " + slice + "\n"
+      " - version  : " + std::to_string(version) + "\n");
+  EKAT_REQUIRE_MSG (rank==comm.rank() and nranks==comm.size(),
+      "Error! Node-local checkpoint slice was written by a different rank.\n"
+      " - file name: " + slice + "\n");
+
+  std::map<std::string,const Field*> name2field;
+  for (const auto& f : fields) {
+    name2field[field_key(f)] = &f;
+  }
+
+  std::vector<char> name_buf;
+  int nfound = 0;
+  for (int i=0; i<nfields; ++i) {
+    std::int32_t name_len;
+    std::int64_t nbytes;
+    in.read(reinterpret_cast<char*>(&name_len),sizeof(name_len));
+    name_buf.resize(name_len);
+    in.read(name_buf.data(),name_len);
+    in.read(reinterpret_cast<char*>(&nbytes),sizeof(nbytes));
+    EKAT_REQUIRE_MSG (not in.fail(),
+        "Error! Something went wrong while reading node-local checkpoint slice.\n"
+        " - file name: " + slice + "\n");
+
+    const std::string fname (name_buf.data(),name_len);
+    auto it = name2field.find(fname);
+    if (it==name2field.end()) {
+      // Field is not needed (e.g., it was removed from the RESTART group)
+      in.seekg(nbytes,std::ios::cur);
+      continue;
+    }
+
+    const auto& f = *it->second;
+    const auto& ap = f.get_header().get_alloc_properties();
+    auto tgt = ap.is_subfield() ? f.clone() : f;
+    EKAT_REQUIRE_MSG (tgt.get_header().get_alloc_properties().get_alloc_size()==nbytes,
+        "Error! Field allocation size does not match the one in the node-local checkpoint.\n"
+        " - file name : " + slice + "\n"
+        " - field name: " + fname + "\n");
+
+    in.read(tgt.get_internal_view_data_unsafe<char,Host>(),nbytes);
+    tgt.sync_to_dev();
+    if (ap.is_subfield()) {
+      auto f_copy = f;
+      f_copy.deep_copy(tgt);
+    }
+    ++nfound;
+  }
+  EKAT_REQUIRE_MSG (nfound==static_cast<int>(fields.size()),
+      "Error! Some fields were not found in the node-local checkpoint slice.\n"
+      " - file name: " + slice + "\n"
+      " - num fields requested: " + std::to_string(fields.size()) + "\n"
+      " - num fields found    : " + std::to_string(nfound) + "\n");
+}
+
+int NodeLocalCheckpoint::
+read_nsteps (const std::string& manifest,
+             const ekat::Comm& comm)
+{
+  std::map<std::string,std::string> entries;
+  read_manifest(manifest,comm,entries);
+  return std::stoi(entries.at("nsteps"));
+}
+
+void NodeLocalCheckpoint::
+read_globals (const std::string& manifest,
+              const ekat::Comm& comm,
+              globals_map_t& globals)
+{
+  std::map<std::string,std::string> entries;
+  read_manifest(manifest,comm,entries);
+
+  for (auto& it : globals) {
+    const auto& name = it.first;
+          auto& any  = it.second;
+
+    auto get = [&](const std::string& type) -> const std::string& {
+      auto key = "global:" + type + ":" + name;
+      EKAT_REQUIRE_MSG (entries.count(key)==1,
+          "Error! Global not found in node-local checkpoint manifest.\n"
+          " - manifest   : " + manifest + "\n"
+          " - global name: " + name + "\n"
+          " - global type: " + type + "\n");
+      return entries.at(key);
+    };
+
+    if (any.isType<int>()) {
+      ekat::any_cast<int>(any) = std::stoi(get("int"));
+    } else if (any.isType<std::int64_t>()) {
+      ekat::any_cast<std::int64_t>(any) = std::stoll(get("int64"));
+    } else if (any.isType<float>()) {
+      ekat::any_cast<float>(any) = std::stof(get("float"));
+    } else if (any.isType<double>()) {
+      ekat::any_cast<double>(any) = std::stod(get("double"));
+    } else if (any.isType<std::string>()) {
+      ekat::any_cast<std::string>(any) = get("string");
+    } else {
+      EKAT_ERROR_MSG (
+          "Error! Unrecognized/unsupported concrete type for node-local checkpoint global.\n"
+          " - global name  : " + name + "\n"
+          " - global typeid: " + any.content().type().name() + "\n");
+    }
+  }
+}
+
+std::string NodeLocalCheckpoint::
+slice_name (const std::string& manifest, const int rank)
+{
+  std::stringstream ss;
+  ss << manifest << ".rank" << std::setw(6) << std::setfill('0') << rank << ".bin";
+  return ss.str();
+}
+
+void NodeLocalCheckpoint::
+read_manifest (const std::string& manifest,
+               const ekat::Comm& comm,
+               std::map<std::string,std::string>& entries)
+{
+  // Only root reads the manifest, then broadcasts its content
+  std::string content;
+  int ok = 1;
+  if (comm.am_i_root()) {
+    std::ifstream mf (manifest);
+    ok = mf.good();
+    std::stringstream ss;
+    ss << mf.rdbuf();
+    content = ss.str();
+  }
+  comm.broadcast(&ok,1,comm.root_rank());
+  EKAT_REQUIRE_MSG (ok==1,
+      "Error! Could not open node-local checkpoint manifest.\n"
+      " - file name: " + manifest + "\n");
+  broadcast_string(content,comm,comm.root_rank());
+
+  std::istringstream iss (content);
+  std::string line;
+  while (std::getline(iss,line)) {
+    auto pos = line.find(' ');
+    if (pos==std::string::npos) {
+      continue;
+    }
+    entries[line.substr(0,pos)] = line.substr(pos+1);
+  }
+
+  EKAT_REQUIRE_MSG (entries.count("version")==1 and std::stoi(entries.at("version"))==nlc_version,
+      "Error! Invalid or unsupported node-local checkpoint manifest.\n"
+      " - file name: " + manifest + "\n");
+}
+
+void NodeLocalCheckpoint::drain_loop ()
+{
+  while (true) {
+    std::pair<std::string,std::string> job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock,[&]{ return m_stop or not m_drain_queue.empty(); });
+      if (m_drain_queue.empty()) {
+        // Only way to get here is m_stop=true
+        return;
+      }
+      job = m_drain_queue.front();
+      m_drain_queue.pop_front();
+    }
+
+    // Do the actual copy outside of the lock
+    std::string err;
+    try {
+      drain(job.first,job.second);
+    } catch (std::exception& e) {
+      err = e.what();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_drain_error += err;
+      --m_num_pending;
+    }
+    m_cv.notify_all();
+  }
+}
+
+void NodeLocalCheckpoint::
+drain (const std::string& src, const std::string& dst)
+{
+  namespace fs = std::filesystem;
+  if (m_same_path) {
+    // Local and drain path are the same, nothing to do
+    return;
+  }
+
+  // Copy to a tmp file, then rename, so that a partially drained
+  // slice is never mistaken for a valid one
+  const auto tmp = dst + ".tmp";
+  std::error_code ec;
+  fs::copy_file(src,tmp,fs::copy_options::overwrite_existing,ec);
+  EKAT_REQUIRE_MSG (not ec,
+      "Error! Could not copy node-local checkpoint slice.\n"
+      " - src: " + src + "\n"
+      " - dst: " + dst + "\n"
+      " - err: " + ec.message() + "\n");
+  fs::rename(tmp,dst,ec);
+  EKAT_REQUIRE_MSG (not ec,
+      "Error! Could not rename drained node-local checkpoint slice.\n"
+      " - file name: " + dst + "\n"
+      " - err: " + ec.message() + "\n");
+
+  if (not m_keep_local_copy) {
+    fs::remove(src,ec);
+  }
+}
+
+} // namespace scream
@@ -0,0 +1,127 @@
+#ifndef SCREAM_NODE_LOCAL_CHECKPOINT_HPP
+#define SCREAM_NODE_LOCAL_CHECKPOINT_HPP
+
+#include "share/field/field.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/std_meta/ekat_std_any.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A class to write model restart data to node-local storage
+ *
+ * Writing a model restart through PIO is a collective (and synchronous)
+ * operation on the shared filesystem, which can stall the simulation for
+ * a long time at scale. This class offers a cheaper alternative: each rank
+ * dumps its own slice of the restart fields in a raw binary format to a
+ * node-local path (e.g., tmpfs or NVMe), and a background thread drains
+ * the slice to the run directory (on the shared filesystem), while the
+ * main thread resumes time stepping.
+ *
+ * A node-local checkpoint consists of
+ *  - one small text manifest (written by the root rank in the drain directory),
+ *    storing number of ranks, number of steps, and the restart globals;
+ *  - one binary slice per rank, named <manifest>.rank<N>.bin, storing the raw
+ *    (host) allocation of each restart field.
+ * The manifest is what goes in the rpointer.atm file, so that the atm driver
+ * can detect the type of restart file, and read it accordingly.
+ *
+ * Since the slices contain the local allocation of each field, they can only
+ * be read back with the same number of ranks (and same decomposition).
+ * PIO is a collective library and it is not thread safe, so the conversion
+ * to NetCDF is *not* done by the drain thread. Instead, the OutputManager
+ * writes a regular NetCDF restart every N restart steps (see the
+ * 'netcdf_frequency' option), so that a portable restart is always available.
+ *
+ * The parameter list accepted by the constructor can contain
+ *  - local_path: the node-local directory where slices are written (required)
+ *  - drain_path: the directory where slices are drained to (default: ".")
+ *  - keep_local_copy: whether to keep the slice in local_path after the drain (default: false)
+ */
+
+class NodeLocalCheckpoint
+{
+public:
+  using globals_map_t = std::map<std::string,ekat::any>;
+
+  NodeLocalCheckpoint (const ekat::Comm& comm, const ekat::ParameterList& params);
+  ~NodeLocalCheckpoint ();
+
+  // Write local slice of the input fields to node-local storage, and schedule
+  // its drain to the drain path. The input name is the name of the manifest
+  // (without any path), which is returned with the drain path prepended.
+  // NOTE: this call waits for any pending drain *before* writing, so that at
+  //       most one checkpoint is in flight at any given time.
+  std::string write (const std::string& name,
+                     const std::vector<Field>& fields,
+                     const globals_map_t& globals,
+                     const int nsteps);
+
+  // Block until all scheduled drains are completed on all ranks. Throws on
+  // all ranks if the drain failed on any rank.
+  // NOTE: this call is collective on the comm passed to the constructor.
+  void wait_for_drain ();
+
+  // Whether the given file is the manifest of a node-local checkpoint
+  static bool is_node_local_checkpoint (const std::string& filename);
+
+  // Read the local slice of the checkpoint, and store data in the input fields.
+  static void read_fields (const std::string& manifest,
+                           const ekat::Comm& comm,
+                           const std::vector<Field>& fields);
+
+  // Read the number of steps stored in the manifest
+  static int read_nsteps (const std::string& manifest,
+                          const ekat::Comm& comm);
+
+  // Read the globals stored in the manifest. The any's in the input map
+  // must already store an object of the right type.
+  static void read_globals (const std::string& manifest,
+                            const ekat::Comm& comm,
+                            globals_map_t& globals);
+
+  static std::string extension () { return ".nlc"; }
+
+protected:
+
+  static std::string slice_name (const std::string& manifest, const int rank);
+
+  static void read_manifest (const std::string& manifest,
+                             const ekat::Comm& comm,
+                             std::map<std::string,std::string>& entries);
+
+  // Drain thread main loop, and copy routine
+  void drain_loop ();
+  void drain (const std::string& src, const std::string& dst);
+
+  ekat::Comm  m_comm;
+
+  std::string m_local_path;
+  std::string m_drain_path;
+  bool        m_keep_local_copy;
+  bool        m_same_path;
+
+  // Background drain thread and queue of (src,dst) pairs.
+  std::thread                                       m_drain_thread;
+  std::deque<std::pair<std::string,std::string>>    m_drain_queue;
+  std::mutex                                        m_mutex;
+  std::condition_variable                           m_cv;
+  int                                               m_num_pending = 0;
+  bool                                              m_stop = false;
+  std::string                                       m_drain_error;
+};
+
+} // namespace scream
+
+#endif // SCREAM_NODE_LOCAL_CHECKPOINT_HPP
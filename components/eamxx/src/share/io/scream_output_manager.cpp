@@ -64,6 +64,32 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
   // Read input parameters and setup internal data
   set_params(params,field_mgrs);
 
+  const std::string timer_root = m_is_model_restart_output ? "EAMxx::IO::restart" : "EAMxx::IO::standard";
+  m_run_timers.root.set_name(timer_root);
+  m_run_timers.stream.set_name("EAMxx::IO::" + m_params.name());
+  m_run_timers.node_local_checkpoint.set_name(timer_root+"::node_local_checkpoint");
+  m_run_timers.get_new_file.set_name(timer_root+"::get_new_file");
+  m_run_timers.run_output_streams.set_name(timer_root+"::run_output_streams");
+  m_run_timers.update_snapshot_tally.set_name(timer_root+"::update_snapshot_tally");
+
+  // Model restart data can be written to node-local storage, and drained asynchronously
+  if (m_is_model_restart_output and m_params.isSublist("node_local_checkpoint")) {
+    auto& nlc_pl = m_params.sublist("node_local_checkpoint");
+    if (nlc_pl.get("enabled",false)) {
+      m_node_local_ckpt = std::make_shared<NodeLocalCheckpoint>(m_io_comm,nlc_pl);
+      m_nlc_netcdf_frequency = nlc_pl.get("netcdf_frequency",0);
+      for (const auto& it : field_mgrs) {
+        const auto& fm = it.second;
+        if (not fm->has_group("RESTART")) {
+          continue;
+        }
+        for (const auto& fn : fm->get_groups_info().at("RESTART")->m_fields_names) {
+          m_restart_fields.push_back(fm->get_field(fn));
+        }
+      }
+    }
+  }
+
   // Here, store if PG2 fields will be present in output streams.
   // Will be useful if multiple grids are defined (see below).
   bool pg2_grid_in_io_streams = false;
@@ -338,9 +364,8 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 
   using namespace scorpio;
 
-  std::string timer_root = m_is_model_restart_output ? "EAMxx::IO::restart" : "EAMxx::IO::standard";
-  start_timer(timer_root);
-  start_timer("EAMxx::IO::" + m_params.name());
+  ScopedTimer root_timer(m_run_timers.root);
+  ScopedTimer stream_timer(m_run_timers.stream);
 
   // Check if this is a write step (and what kind)
   // Note: a full checkpoint not only writes globals in the restart file, but also all the history variables.
@@ -361,8 +386,22 @@ void OutputManager::run(const util::TimeStamp& timestamp)
   const bool is_full_checkpoint_step = is_checkpoint_step && has_checkpoint_data && not is_output_step;
   const bool is_write_step           = is_output_step || is_checkpoint_step;
 
+  // Model restart data may go to node-local storage rather than to a NetCDF file
+  if (m_node_local_ckpt and is_output_step) {
+    ++m_num_restart_writes;
+    const bool netcdf_step = m_nlc_netcdf_frequency>0 and
+                             m_num_restart_writes%m_nlc_netcdf_frequency==0;
+    if (not netcdf_step) {
+      ScopedTimer timer(m_run_timers.node_local_checkpoint);
+      write_node_local_checkpoint(timestamp);
+      return;
+    }
+    // The NetCDF restart file supersedes the pending node-local checkpoint
+    m_nlc_pending_manifest.clear();
+  }
+
   // Create and setup output/checkpoint file(s), if necessary
-  start_timer(timer_root+"::get_new_file");
+  m_run_timers.get_new_file.start();
   auto setup_output_file = [&](IOControl& control, IOFileSpecs& filespecs) {
     // Check if the new snapshot fits, if not, close the file
     // NOTE: if output is average/max/min AND we save one file per month/year,
@@ -438,10 +477,10 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       update_time(m_checkpoint_file_specs.filename,timestamp.days_from(m_case_t0));
     }
   }
-  stop_timer(timer_root+"::get_new_file");
+  m_run_timers.get_new_file.stop();
 
   // Run the output streams
-  start_timer(timer_root+"::run_output_streams");
+  m_run_timers.run_output_streams.start();
   const auto& fields_write_filename = is_output_step ? m_output_file_specs.filename : m_checkpoint_file_specs.filename;
   for (auto& it : m_output_streams) {
     // Note: filename only matters if is_output_step || is_full_checkpoint_step=true. In that case, it will definitely point to a valid file name.
@@ -450,7 +489,7 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     }
     it->run(fields_write_filename,is_output_step,is_full_checkpoint_step,m_output_control.nsamples_since_last_write,is_t0_output);
   }
-  stop_timer(timer_root+"::run_output_streams");
+  m_run_timers.run_output_streams.stop();
 
   if (is_write_step) {
     if (m_time_bnds.size()>0) {
@@ -536,7 +575,7 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       }
     };
 
-    start_timer(timer_root+"::update_snapshot_tally");
+    m_run_timers.update_snapshot_tally.start();
     // Important! Process output file first, and hist restart (if any) second.
     // That's b/c write_global_data will update m_output_control.last_write_ts,
     // which is later written as global data in the hist restart file
@@ -546,18 +585,20 @@ void OutputManager::run(const util::TimeStamp& timestamp)
     if (is_checkpoint_step) {
       write_global_data(m_checkpoint_control,m_checkpoint_file_specs);
     }
-    stop_timer(timer_root+"::update_snapshot_tally");
+    m_run_timers.update_snapshot_tally.stop();
     if (is_output_step && m_time_bnds.size()>0) {
       m_time_bnds[0] = m_time_bnds[1];
     }
   }
-
-  stop_timer("EAMxx::IO::" + m_params.name());
-  stop_timer(timer_root);
 }
 /*===============================================================================================*/
 void OutputManager::finalize()
 {
+  // Ensure that the last node-local checkpoint made it to the drain path
+  if (m_node_local_ckpt) {
+    update_rpointer_with_node_local_checkpoint();
+  }
+
   // Close any output file still open
   if (m_output_file_specs.is_open) {
     scorpio::release_file (m_output_file_specs.filename);
@@ -585,6 +626,12 @@ void OutputManager::finalize()
   m_case_t0 = {};
   m_run_t0 = {};
   m_atm_logger = {};
+  m_node_local_ckpt = nullptr;
+  m_restart_fields.clear();
+  m_nlc_netcdf_frequency = 0;
+  m_num_restart_writes = 0;
+  m_nlc_pending_manifest.clear();
+  m_nlc_pending_ts.clear();
 }
 
 long long OutputManager::res_dep_memory_footprint () const {
@@ -843,6 +890,72 @@ setup_file (      IOFileSpecs& filespecs,
   m_resume_output_file = false;
 }
 /*===============================================================================================*/
+void OutputManager::
+write_node_local_checkpoint (const util::TimeStamp& timestamp)
+{
+  // The previous checkpoint must be fully drained before we write a new one,
+  // so this is a good time to make rpointer.atm point to it.
+  update_rpointer_with_node_local_checkpoint();
+
+  // Use the same name the NetCDF restart file would have, but a different extension
+  auto name = compute_filename(m_output_control,m_output_file_specs,timestamp);
+  const auto ext_pos = name.rfind('.');
+  if (ext_pos!=std::string::npos) {
+    name.erase(ext_pos);
+  }
+  name += NodeLocalCheckpoint::extension();
+
+  const auto manifest = m_node_local_ckpt->write(name,m_restart_fields,m_globals,timestamp.get_num_steps());
+
+  // Until the slices are drained, rpointer.atm keeps pointing to the previous restart
+  m_nlc_pending_manifest = manifest;
+  m_nlc_pending_ts = timestamp.to_string();
+
+  if (m_atm_logger) {
+    m_atm_logger->info("[EAMxx::output_manager] - Writing node-local checkpoint:");
+    m_atm_logger->info("[EAMxx::output_manager]      FILE: " + manifest);
+  }
+
+  m_output_control.last_write_ts = timestamp;
+  m_output_control.compute_next_write_ts();
+  m_output_control.nsamples_since_last_write = 0;
+}
+/*===============================================================================================*/
+void OutputManager::update_rpointer_with_node_local_checkpoint ()
+{
+  // Collective: returns only if the slices of all ranks were drained, and throws
+  // on all ranks otherwise, so rpointer.atm never points to an incomplete checkpoint.
+  m_node_local_ckpt->wait_for_drain();
+
+  if (m_nlc_pending_manifest=="") {
+    return;
+  }
+
+  // As for NetCDF restart files, the model restart OM is in charge of creating rpointer.atm.
+  // Since history restart files are appended to rpointer.atm as they are written, keep
+  // the entries with the same timestamp as the checkpoint, and drop the older ones.
+  if (m_io_comm.am_i_root()) {
+    std::vector<std::string> hist_entries;
+    std::ifstream old_rpointer("rpointer.atm");
+    std::string line;
+    while (old_rpointer >> line) {
+      if (line.find(m_nlc_pending_ts)!=std::string::npos) {
+        hist_entries.push_back(line);
+      }
+    }
+    old_rpointer.close();
+
+    std::ofstream rpointer("rpointer.atm");  // Open rpointer and nuke its content
+    rpointer << m_nlc_pending_manifest << std::endl;
+    for (const auto& entry : hist_entries) {
+      rpointer << entry << std::endl;
+    }
+  }
+
+  m_nlc_pending_manifest.clear();
+  m_nlc_pending_ts.clear();
+}
+/*===============================================================================================*/
 void OutputManager::set_file_header(const IOFileSpecs& file_specs)
 {
   auto& p = m_params.sublist("provenance");
@@ -912,6 +1025,9 @@ push_to_logger()
       EKAT_ERROR_MSG ("Error! Unrecognized/unsupported file storage type.\n");
   }
   m_atm_logger->info("      Includes Grid Data ?: " + bool_to_string(m_save_grid_data));
+  if (m_is_model_restart_output) {
+    m_atm_logger->info("      Node-Local Restart ?: " + bool_to_string(m_node_local_ckpt!=nullptr));
+  }
   // List each GRID - TODO
   // List all FIELDS - TODO
 }
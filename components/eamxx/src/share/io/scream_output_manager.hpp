@@ -6,10 +6,12 @@
 #include "share/io/scream_io_utils.hpp"
 #include "share/io/scream_io_file_specs.hpp"
 #include "share/io/scream_io_control.hpp"
+#include "share/io/scream_node_local_checkpoint.hpp"
 
 #include "share/field/field_manager.hpp"
 #include "share/grid/grids_manager.hpp"
 #include "share/util/scream_time_stamp.hpp"
+#include "share/util/scream_timing.hpp"
 
 #include "ekat/logging/ekat_logger.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
@@ -49,6 +51,13 @@ namespace scream
  * establish a simple grids manager and field manager.  As well as how to
  * locally create a parameter list.
  *
+ * Node-local checkpointing:
+ * For model restart output, the user can request (via the sublist 'node_local_checkpoint'
+ * in the model_restart parameter list) to write the restart data to node-local storage
+ * in raw binary format, with a background thread draining the data to the run directory.
+ * Every 'netcdf_frequency' restart writes (if positive), a regular NetCDF restart file
+ * is written instead. See share/io/scream_node_local_checkpoint.hpp for details.
+ *
  * Adding output streams mid-simulation:
  * TODO - This doesn't actually exist
  * It is possible to add an output stream after init has been called by calling
@@ -136,6 +145,12 @@ protected:
   // Manage logging of info to atm.log
   void push_to_logger();
 
+  // Write model restart data to node-local storage (see NodeLocalCheckpoint)
+  void write_node_local_checkpoint (const util::TimeStamp& timestamp);
+
+  // Once the last node-local checkpoint is drained, make rpointer.atm point to it
+  void update_rpointer_with_node_local_checkpoint ();
+
   using output_type     = AtmosphereOutput;
   using output_ptr_type = std::shared_ptr<output_type>;
 
@@ -158,6 +173,16 @@ protected:
   // Whether this OutputManager handles a model restart file, or normal model output.
   bool m_is_model_restart_output;
 
+  // Timers used in run(), whose names are set during setup
+  struct RunTimers {
+    TimerHandle root;
+    TimerHandle stream;
+    TimerHandle node_local_checkpoint;
+    TimerHandle get_new_file;
+    TimerHandle run_output_streams;
+    TimerHandle update_snapshot_tally;
+  } m_run_timers;
+
   // Frequency of output and checkpointing
   // See scream_io_utils.hpp for details.
   IOControl m_output_control;
@@ -186,6 +211,18 @@ protected:
 
   // If true, we save grid data in output file
   bool m_save_grid_data;
+
+  // Node-local checkpointing of model restart data. If enabled, write a NetCDF
+  // restart file only every m_nlc_netcdf_frequency restart writes.
+  std::shared_ptr<NodeLocalCheckpoint> m_node_local_ckpt;
+  std::vector<Field>                   m_restart_fields;
+  int                                  m_nlc_netcdf_frequency = 0;
+  int                                  m_num_restart_writes = 0;
+
+  // Manifest of the last node-local checkpoint (and its timestamp), which goes
+  // in rpointer.atm only after its slices are drained.
+  std::string                          m_nlc_pending_manifest;
+  std::string                          m_nlc_pending_ts;
 };
 
 } // namespace scream
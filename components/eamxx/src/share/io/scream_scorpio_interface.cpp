@@ -8,6 +8,7 @@
 
 #include <pio.h>
 
+#include <list>
 #include <numeric>
 
 namespace scream {
@@ -31,17 +32,19 @@ public:
   strmap_t<PIOFile>                     files;
   strmap_t<std::shared_ptr<PIODecomp>>  decomps;
 
-  // In the above map, we would like to label decomps as dtype_dim1$N1_dim2$N2...
-  // where N$i is the global length of dim$i. However, it *may* happen that we use
-  // two different decompositions for the same global layout, which would clash
-  // the names. For this reason, we append at the end an increasing counter,
-  // which disambiguate between globally-equivalent partitions.
+  // In the above map, we label decomps as dtype-dim1<N1>_dim2<N2>_...#K,
+  // where N$i is the global length of dim$i. Since we *may* use two different
+  // decompositions for the same global layout (e.g., two grids with the same
+  // global size, but different partitions), we append an increasing counter K,
+  // which disambiguates between globally-equivalent layouts.
   // When adding a new decomp, we check this map to see if another decomp
-  // already exists with the same global layout. If so, we first check to see
-  // if that decomp is equivalent to the new one *on all ranks*. If yes, we
-  // recycle it, otherwise we create a new PIO decomp.
-  // strmap_t<std::list<std::string>>    decomp_global_layout_to_decomp_name;
-  // strmap_t<int>                       decomp_global_layout_to_counter;
+  // already exists with the same global layout. If so, we check if that decomp
+  // is equivalent to the new one *on all ranks* (by comparing the global hash of
+  // the dim offsets). If yes, we recycle it, otherwise we create a new PIO decomp. Decomps are therefore shared by all input and
+  // output files, and survive file rollovers. They are only freed when the
+  // decomposed dim is reset (if no other customer is left), or at finalization.
+  strmap_t<std::list<std::string>>    decomp_global_layout_to_decomp_name;
+  strmap_t<int>                       decomp_global_layout_to_counter;
 
   int         pio_sysid        = -1;
   int         pio_type_default = -1;
@@ -110,6 +113,32 @@ std::string get_entity_name (const std::shared_ptr<const PIOEntity>& e)
   return e->name;
 }
 
+// Hash the offsets of all ranks into a single value, the same on all ranks.
+// Each rank hashes its offsets (FNV-1a, seeded with the rank, so that the
+// same offsets owned by different ranks give different partitions), and
+// the local hashes are combined with a bitwise xor.
+std::uint64_t global_offsets_hash (const std::vector<offset_t>& offsets,
+                                   const ekat::Comm& comm)
+{
+  constexpr std::uint64_t prime = 1099511628211ULL;
+  std::uint64_t h = 14695981039346656037ULL;
+  auto mix = [&](const std::uint64_t v) {
+    for (int i=0; i<8; ++i) {
+      h ^= (v >> (8*i)) & 0xff;
+      h *= prime;
+    }
+  };
+  mix(comm.rank());
+  mix(offsets.size());
+  for (auto o : offsets) {
+    mix(o);
+  }
+
+  std::uint64_t global_h;
+  MPI_Allreduce(&h,&global_h,1,MPI_UINT64_T,MPI_BXOR,comm.mpi_comm());
+  return global_h;
+}
+
 template<typename T>
 std::string print_map_keys (const std::map<std::string,T>& map) {
   std::string s;
@@ -361,6 +390,8 @@ void finalize_subsystem ()
     check_scorpio_noerr(err,"finalize_subsystem","freedecomp");
   }
   s.decomps.clear();
+  s.decomp_global_layout_to_decomp_name.clear();
+  s.decomp_global_layout_to_counter.clear();
 
 #ifndef SCREAM_CIME_BUILD
   // Don't finalize in CIME builds, since the coupler will take care of it
@@ -732,43 +763,63 @@ void set_var_decomp (PIOVar& var,
       " - varname   : " + var.name  + "\n"
       " - var decomp: " + var.decomp->name  + "\n");
 
-  // Create decomp name: dtype-dim1<len1>_dim2<len2>_..._dimk<lenN>
-  std::shared_ptr<const PIODim> decomp_dim;
-  std::string decomp_tag = var.dtype + "-";
+  // Create decomp global layout tag: dtype-dim1<len1>_dim2<len2>_..._dimk<lenN>
+  std::string layout_tag = var.dtype + "-";
   for (auto d : var.dims) {
-    decomp_tag += d->name + "<" + std::to_string(d->length) + ">_";
+    layout_tag += d->name + "<" + std::to_string(d->length) + ">_";
   }
-  decomp_tag.pop_back(); // remove trailing underscore
+  layout_tag.pop_back(); // remove trailing underscore
 
-  // Check if a decomp with this name already exists
   auto& s = ScorpioSession::instance();
-  auto& decomp = s.decomps[decomp_tag];
+  const auto& dim_offsets = var.dims[0]->offsets;
+  const auto& candidates = s.decomp_global_layout_to_decomp_name[layout_tag];
 #ifndef NDEBUG
-  // Extra check: all ranks must agree on whether they have the decomposition!
+  // Extra check: all ranks must agree on the decompositions already created for this layout!
   // If they don't agree, some rank will be stuck in a PIO call, waiting for others
-  int found = decomp==nullptr ? 0 : 1;
-  int min_found, max_found;
-  const auto& comm = ScorpioSession::instance().comm;
-  comm.all_reduce(&found,&min_found,1,MPI_MIN);
-  comm.all_reduce(&found,&max_found,1,MPI_MAX);
-  EKAT_REQUIRE_MSG(min_found==max_found,
-      "Error! Decomposition already present on some ranks but not all.\n"
-      " - filename: " + filename + "\n"
-      " - varname : " + var.name + "\n"
-      " - var dims: " + ekat::join(var.dims,get_entity_name,",") + "\n"
-      " - decopm tag: " + decomp_tag + "\n");
+  const auto& comm = s.comm;
+  int ncand = candidates.size();
+  int min_ncand, max_ncand;
+  comm.all_reduce(&ncand,&min_ncand,1,MPI_MIN);
+  comm.all_reduce(&ncand,&max_ncand,1,MPI_MAX);
+  EKAT_REQUIRE_MSG(min_ncand==max_ncand,
+      "Error! Decompositions for this layout differ across ranks.\n"
+      " - filename  : " + filename + "\n"
+      " - varname   : " + var.name + "\n"
+      " - var dims  : " + ekat::join(var.dims,get_entity_name,",") + "\n"
+      " - layout tag: " + layout_tag + "\n");
 #endif
 
+  // Check if a decomp with this global layout *and* the same partition already exists.
+  // The offsets hashes are the same on all ranks, so no communication is needed here.
+  const auto dim_offsets_hash = var.dims[0]->offsets_hash;
+  std::shared_ptr<PIODecomp> decomp;
+  for (const auto& dn : candidates) {
+    const auto& d = s.decomps.at(dn);
+    if (d->dim_offsets_hash==dim_offsets_hash) {
+      EKAT_REQUIRE_MSG (d->dim_offsets==dim_offsets or *d->dim_offsets==*dim_offsets,
+          "Error! Hash collision between dim offsets with different partitions.\n"
+          " - filename: " + filename + "\n"
+          " - varname : " + var.name + "\n"
+          " - decomp  : " + dn + "\n");
+      decomp = d;
+      break;
+    }
+  }
+
   if (decomp==nullptr) {
     // We haven't create this decomp yet. Go ahead and create one
+    auto& counter = s.decomp_global_layout_to_counter[layout_tag];
+    const auto decomp_name = layout_tag + "#" + std::to_string(counter++);
     decomp = std::make_shared<PIODecomp>();
-    decomp->name = decomp_tag;
-    decomp->dim = var.dims[0];
+    decomp->name = decomp_name;
+    decomp->global_layout = layout_tag;
+    decomp->dim_offsets = dim_offsets;
+    decomp->dim_offsets_hash = dim_offsets_hash;
 
     int ndims = var.dims.size();
 
     // Get ALL dims global lengths, and compute prod of *non-decomposed* dims
-    std::vector<int> gdimlen = {decomp->dim->length};
+    std::vector<int> gdimlen = {var.dims[0]->length};
     int non_decomp_dim_prod = 1;
     for (int idim=1; idim<ndims; ++idim) {
       auto d = var.dims[idim];
@@ -777,11 +828,10 @@ void set_var_decomp (PIOVar& var,
     }
 
     // Create offsets list
-    const auto& dim_offsets = *decomp->dim->offsets;
-    int dim_loc_len = dim_offsets.size();
+    int dim_loc_len = dim_offsets->size();
     decomp->offsets.resize (non_decomp_dim_prod*dim_loc_len);
     for (int idof=0; idof<dim_loc_len; ++idof) {
-      auto dof_offset = dim_offsets[idof];
+      auto dof_offset = (*dim_offsets)[idof];
       auto beg = decomp->offsets.begin()+ idof*non_decomp_dim_prod;
       auto end = beg + non_decomp_dim_prod;
       std::iota (beg,end,non_decomp_dim_prod*dof_offset);
@@ -794,7 +844,10 @@ void set_var_decomp (PIOVar& var,
                                maplen,compmap, &decomp->ncid,s.pio_rearranger,
                                nullptr,nullptr);
 
-    check_scorpio_noerr(err,filename,"decomp",decomp_tag,"set_var_decomp","InitDecomp");
+    check_scorpio_noerr(err,filename,"decomp",decomp_name,"set_var_decomp","InitDecomp");
+
+    s.decomps[decomp_name] = decomp;
+    s.decomp_global_layout_to_decomp_name[layout_tag].push_back(decomp_name);
   }
 
   // Set decomp data in the var
@@ -823,7 +876,7 @@ void set_dim_decomp (const std::string& filename,
       std::set<std::string> decomps_to_remove;
       for (auto it : f.vars) {
         auto v = it.second;
-        if (v->decomp!=nullptr and v->decomp->dim->name==dimname) {
+        if (v->decomp!=nullptr and v->dims[0]->name==dimname) {
           decomps_to_remove.insert(v->decomp->name);
           v->decomp = nullptr;
         }
@@ -834,6 +887,7 @@ void set_dim_decomp (const std::string& filename,
           // There is no other customer of this decomposition, so we can safely free it
           int err = PIOc_freedecomp(s.pio_sysid,decomp->ncid);
           check_scorpio_noerr(err,filename,"decomp",dn,"set_dim_decomp","freedecomp");
+          s.decomp_global_layout_to_decomp_name.at(decomp->global_layout).remove(dn);
           s.decomps.erase(dn);
         }
       }
@@ -864,6 +918,7 @@ void set_dim_decomp (const std::string& filename,
   }
 
   dim.offsets = std::make_shared<std::vector<offset_t>>(my_offsets);
+  dim.offsets_hash = global_offsets_hash(my_offsets,s.comm);
 
   // If vars were already defined, we need to process them,
   // and create the proper PIODecomp objects.
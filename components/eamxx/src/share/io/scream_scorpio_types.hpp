@@ -1,6 +1,7 @@
 #ifndef SCREAM_SCORPIO_TYPES_HPP
 #define SCREAM_SCORPIO_TYPES_HPP
 
+#include <cstdint>
 #include <string>
 #include <map>
 #include <vector>
@@ -69,6 +70,10 @@ struct PIODim : public PIOFileEntity {
   // NOTE: use a pointer, so we can detect if a decomposition already
   //       existed or not when we set one.
   std::shared_ptr<std::vector<offset_t>> offsets;
+
+  // Hash of the offsets across all ranks (hence, the same on all ranks).
+  // Allows to match decompositions without communication.
+  std::uint64_t offsets_hash = 0;
 };
 
 // A decomposition
@@ -77,10 +82,14 @@ struct PIODim : public PIOFileEntity {
 //       A PIODecomp is associated with a Nd layout, which includes decomp_dim
 //       among its dimensions. PIODecomp::offsets are the offsets of the full
 //       array layout owned by this rank. Hence, there can be many PIODecomp
-//       all storing the same dim
+//       all storing the same dim offsets
+// NOTE: decomps are not tied to a file: they are shared by all files (input or output)
+//       that use the same global layout with the same partition of the decomposed dim.
 struct PIODecomp : public PIOEntity {
-  std::vector<offset_t>           offsets;  // Owned offsets
-  std::shared_ptr<const PIODim>   dim; 
+  std::vector<offset_t>                         offsets;        // Owned offsets
+  std::shared_ptr<const std::vector<offset_t>>  dim_offsets;    // Owned offsets along decomposed dim
+  std::string                                   global_layout;  // dtype-dim1<len1>_..._dimk<lenk>
+  std::uint64_t                                 dim_offsets_hash = 0; // See PIODim::offsets_hash
 };
 
 // A variable
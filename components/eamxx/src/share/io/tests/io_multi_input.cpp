@@ -0,0 +1,125 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scorpio_multi_input.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+
+namespace scream {
+
+// Value of var number ivar at (gid,ilev)
+Real get_value (const int ivar, const int gid, const int ilev) {
+  return 1000*ivar + 10*gid + ilev;
+}
+
+// Write a file with vars v0,...,vN-1, all with dims (ncol,lev)
+void write_file (const std::string& filename, const int nvars,
+                 const std::shared_ptr<const AbstractGrid>& grid)
+{
+  using namespace scorpio;
+
+  const int ncols = grid->get_num_local_dofs();
+  const int nlevs = grid->get_num_vertical_levels();
+  auto gids = grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+  auto min_gid = grid->get_global_min_dof_gid();
+
+  register_file(filename,Write);
+  define_dim(filename,"ncol",grid->get_num_global_dofs());
+  define_dim(filename,"lev",nlevs);
+  std::vector<offset_t> offsets(ncols);
+  for (int icol=0; icol<ncols; ++icol) {
+    offsets[icol] = gids(icol) - min_gid;
+  }
+  set_dim_decomp(filename,"ncol",offsets);
+  for (int ivar=0; ivar<nvars; ++ivar) {
+    define_var(filename,"v"+std::to_string(ivar),{"ncol","lev"},"real");
+  }
+  enddef(filename);
+
+  std::vector<Real> data(ncols*nlevs);
+  for (int ivar=0; ivar<nvars; ++ivar) {
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int ilev=0; ilev<nlevs; ++ilev) {
+        data[icol*nlevs+ilev] = get_value(ivar,gids(icol),ilev);
+      }
+    }
+    write_var(filename,"v"+std::to_string(ivar),data.data());
+  }
+  release_file(filename);
+}
+
+TEST_CASE ("multi_file_input") {
+  using namespace ShortFieldTagsNames;
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  const int ngcols = 2*comm.size()+1;
+  const int nlevs  = 4;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  const auto np = std::to_string(comm.size());
+  const std::string file1 = "multi_input_1_np" + np + ".nc";
+  const std::string file2 = "multi_input_2_np" + np + ".nc";
+  write_file(file1,2,grid);
+  write_file(file2,3,grid);
+
+  // Create fields to read: two from file1, and two from file2 (one with different name)
+  const int ncols = grid->get_num_local_dofs();
+  const auto units = ekat::units::Units::nondimensional();
+  FL layout ({COL,LEV},{ncols,nlevs});
+  auto create_field = [&](const std::string& name) {
+    Field f (FID(name,layout,units,grid->name()));
+    f.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+    f.allocate_view();
+    return f;
+  };
+  auto f1_0 = create_field("v0");
+  auto f1_1 = create_field("v1");
+  auto f2_1 = create_field("v1");
+  auto f2_2 = create_field("my_v2");
+
+  MultiFileInput loader(comm);
+  loader.add_fields(file1,grid,{f1_0});
+  loader.add_fields(file2,grid,{f2_1,f2_2.alias("v2")});
+  loader.add_fields(file1,grid,{f1_1});
+  loader.read_all();
+
+  // Check timings were recorded for both files
+  const auto& timings = loader.get_timings();
+  REQUIRE (timings.size()==2);
+  REQUIRE (timings.at(file1).nvars==2);
+  REQUIRE (timings.at(file2).nvars==2);
+
+  // Check values
+  auto gids = grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+  auto check = [&](const Field& f, const int ivar) {
+    f.sync_to_host();
+    auto v = f.get_view<const Real**,Host>();
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int ilev=0; ilev<nlevs; ++ilev) {
+        REQUIRE (v(icol,ilev)==get_value(ivar,gids(icol),ilev));
+      }
+    }
+  };
+  check(f1_0,0);
+  check(f1_1,1);
+  check(f2_1,1);
+  check(f2_2,2);
+
+  // All files must have been released
+  REQUIRE (not scorpio::is_file_open(file1));
+  REQUIRE (not scorpio::is_file_open(file2));
+
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
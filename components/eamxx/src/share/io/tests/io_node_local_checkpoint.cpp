@@ -0,0 +1,137 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_node_local_checkpoint.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <iomanip>
+#include <sstream>
+
+namespace scream {
+
+std::vector<Field>
+create_fields (const std::shared_ptr<const AbstractGrid>& grid)
+{
+  using FL  = FieldLayout;
+  using FID = FieldIdentifier;
+  using namespace ShortFieldTagsNames;
+
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+  const auto units = ekat::units::Units::nondimensional();
+
+  std::vector<Field> fields;
+
+  // A 2d field, a padded 3d field, and a subfield of a vector field
+  Field f0 (FID("f0",FL({COL},{nlcols}),units,grid->name()));
+  Field f1 (FID("f1",FL({COL,LEV},{nlcols,nlevs}),units,grid->name()));
+  Field f2 (FID("f2",FL({COL,CMP,LEV},{nlcols,2,nlevs}),units,grid->name()));
+  f1.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+  f0.allocate_view();
+  f1.allocate_view();
+  f2.allocate_view();
+
+  fields.push_back(f0);
+  fields.push_back(f1);
+  fields.push_back(f2.get_component(1));
+  return fields;
+}
+
+TEST_CASE ("node_local_checkpoint") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  auto engine = setup_random_test(&comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  RPDF pdf(0,1);
+
+  const int ngcols = 2*comm.size()+1;
+  const int nlevs  = 7;
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  auto src = create_fields(grid);
+  auto tgt = create_fields(grid);
+  for (const auto& f : src) {
+    randomize(f,engine,pdf);
+  }
+
+  ekat::ParameterList params;
+  params.set<std::string>("local_path","nlc_local_np" + std::to_string(comm.size()));
+  params.set<std::string>("drain_path","nlc_drain_np" + std::to_string(comm.size()));
+
+  NodeLocalCheckpoint::globals_map_t globals;
+  globals["my_int"] = 3;
+  globals["my_int64"] = std::int64_t(1) << 40;
+  globals["my_double"] = 1.0/3.0;
+  globals["my_string"] = std::string("hello world");
+
+  std::string manifest;
+  {
+    NodeLocalCheckpoint nlc(comm,params);
+    manifest = nlc.write("test"+NodeLocalCheckpoint::extension(),src,globals,42);
+    nlc.wait_for_drain();
+  }
+  comm.barrier();
+
+  REQUIRE (NodeLocalCheckpoint::is_node_local_checkpoint(manifest));
+  REQUIRE (not NodeLocalCheckpoint::is_node_local_checkpoint("foo.r.nc"));
+
+  // Read fields, and check they match what we wrote
+  NodeLocalCheckpoint::read_fields(manifest,comm,tgt);
+  for (size_t i=0; i<src.size(); ++i) {
+    REQUIRE (views_are_equal(src[i],tgt[i]));
+  }
+
+  // Missing fields must trigger an error
+  auto extra = tgt;
+  extra.push_back(Field(FieldIdentifier("extra",src[0].get_header().get_identifier().get_layout(),
+                                        ekat::units::Units::nondimensional(),grid->name())));
+  extra.back().allocate_view();
+  REQUIRE_THROWS (NodeLocalCheckpoint::read_fields(manifest,comm,extra));
+
+  // Check globals and nsteps
+  REQUIRE (NodeLocalCheckpoint::read_nsteps(manifest,comm)==42);
+
+  NodeLocalCheckpoint::globals_map_t read_globals;
+  read_globals["my_int"] = 0;
+  read_globals["my_int64"] = std::int64_t(0);
+  read_globals["my_double"] = 0.0;
+  read_globals["my_string"] = std::string("");
+  NodeLocalCheckpoint::read_globals(manifest,comm,read_globals);
+  REQUIRE (ekat::any_cast<int>(read_globals["my_int"])==3);
+  REQUIRE (ekat::any_cast<std::int64_t>(read_globals["my_int64"])==(std::int64_t(1) << 40));
+  REQUIRE (ekat::any_cast<double>(read_globals["my_double"])==1.0/3.0);
+  REQUIRE (ekat::any_cast<std::string>(read_globals["my_string"])=="hello world");
+
+  // If the drain fails on one rank, all ranks must throw (and none must hang).
+  // Make the drain fail on the last rank, by placing a non-empty directory
+  // where the drained slice tmp file should go.
+  {
+    namespace fs = std::filesystem;
+    const auto drain_path = params.get<std::string>("drain_path");
+    if (comm.rank()==comm.size()-1) {
+      std::stringstream ss;
+      ss << drain_path << "/bad" << NodeLocalCheckpoint::extension()
+         << ".rank" << std::setw(6) << std::setfill('0') << comm.rank() << ".bin.tmp";
+      fs::create_directories(ss.str() + "/blocker");
+    }
+    comm.barrier();
+
+    NodeLocalCheckpoint nlc(comm,params);
+    nlc.write("bad"+NodeLocalCheckpoint::extension(),src,globals,42);
+    REQUIRE_THROWS (nlc.wait_for_drain());
+  }
+}
+
+} // namespace scream
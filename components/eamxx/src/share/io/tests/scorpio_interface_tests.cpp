@@ -210,4 +210,70 @@ TEST_CASE ("write_and_read") {
   finalize_subsystem ();
 }
 
+TEST_CASE ("decomp_sharing") {
+  ekat::Comm comm (MPI_COMM_WORLD);
+
+  init_subsystem (comm);
+
+  const auto np = std::to_string(comm.size());
+  const std::string f1 = "scorpio_interface_decomp_1_np" + np + ".nc";
+  const std::string f2 = "scorpio_interface_decomp_2_np" + np + ".nc";
+
+  const int ldim = 3;
+  const int gdim = ldim*comm.size();
+
+  // Two partitions of the same dim: contiguous and strided
+  std::vector<offset_t> contig, strided;
+  for (int i=0; i<ldim; ++i) {
+    contig.push_back(ldim*comm.rank() + i);
+    strided.push_back(comm.rank() + i*comm.size());
+  }
+
+  auto setup_file = [&](const std::string& filename, const std::vector<offset_t>& offsets) {
+    register_file (filename,Write);
+    define_dim (filename,"dim",gdim);
+    define_dim (filename,"lev",2);
+    set_dim_decomp (filename,"dim",offsets);
+    define_var (filename,"var1",{"dim","lev"},"double",false);
+    define_var (filename,"var2",{"dim","lev"},"double",false);
+    define_var (filename,"var3",{"dim"},"double",false);
+  };
+
+  setup_file (f1,contig);
+  setup_file (f2,contig);
+
+  // Same layout and partition: all vars and files share the decomp
+  auto decomp_name = [](const std::string& filename, const std::string& varname) {
+    const auto& d = get_var(filename,varname).decomp;
+    REQUIRE (d!=nullptr);
+    return d->name;
+  };
+  const auto d11 = decomp_name(f1,"var1");
+  REQUIRE (decomp_name(f1,"var2")==d11);
+  REQUIRE (decomp_name(f2,"var1")==d11);
+  REQUIRE (decomp_name(f1,"var3")!=d11); // Different layout
+
+  if (comm.size()>1) {
+    // Resetting the partition must produce a different decomp, without affecting f1
+    set_dim_decomp (f2,"dim",strided,true);
+    REQUIRE (decomp_name(f2,"var1")!=d11);
+    REQUIRE (decomp_name(f2,"var2")==decomp_name(f2,"var1"));
+    REQUIRE (*get_var(f1,"var1").decomp->dim_offsets==contig);
+    REQUIRE (*get_var(f2,"var1").decomp->dim_offsets==strided);
+  }
+
+  enddef (f1);
+  enddef (f2);
+  release_file (f1);
+  release_file (f2);
+
+  // Decomps survive file release: a new file with same layout/partition recycles them
+  setup_file (f1,contig);
+  REQUIRE (decomp_name(f1,"var1")==d11);
+  enddef (f1);
+  release_file (f1);
+
+  finalize_subsystem ();
+}
+
 } // namespace scream
@@ -23,6 +23,11 @@ public:
 
   ResultAndMsg check() const override;
 
+  bool get_screening_bounds (ScreeningBounds& bounds) const override {
+    bounds.check_nan = true;
+    return true;
+  }
+
 // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
 #ifndef EAMXX_ENABLE_GPU
 protected:
@@ -41,6 +41,13 @@ public:
 
   ResultAndMsg check() const override;
 
+  // NOTE: like check(), the screening does not flag NaN values
+  bool get_screening_bounds (ScreeningBounds& bounds) const override {
+    bounds.lb = m_lb;
+    bounds.ub = m_ub;
+    return true;
+  }
+
 // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
 #ifndef EAMXX_ENABLE_GPU
 protected:
@@ -0,0 +1,152 @@
+#include "share/property_checks/fused_property_checks.hpp"
+
+#include "ekat/util/ekat_math_utils.hpp"
+
+namespace scream
+{
+
+FusedPropertyChecks::
+FusedPropertyChecks (const std::vector<check_ptr>& checks)
+ : m_checks (checks)
+{
+  std::vector<Screen> screens;
+  std::vector<int> block_screen, block_begin;
+  for (const auto& pc : m_checks) {
+    EKAT_REQUIRE_MSG (pc!=nullptr,
+        "Error! Invalid property check pointer.\n");
+
+    m_screened_idx.push_back(-1);
+
+    PropertyCheck::ScreeningBounds bounds;
+    if (pc->fields().size()!=1 or not pc->get_screening_bounds(bounds)) {
+      continue;
+    }
+
+    // We can only screen Real fields whose allocation is not a slice of
+    // another field (padding along the last dim is ok)
+    const auto& f  = pc->fields().front();
+    const auto& fh = f.get_header();
+    const auto& ap = fh.get_alloc_properties();
+    const auto& layout = fh.get_identifier().get_layout();
+    if (fh.get_identifier().data_type()!=get_data_type<Real>() or
+        ap.is_subfield() or not ap.contiguous() or layout.size()==0) {
+      continue;
+    }
+
+    Screen s;
+    s.data       = f.get_internal_view_data<const Real>();
+    s.size       = layout.size();
+    s.last_dim   = layout.rank()>0 ? layout.dims().back() : 1;
+    s.last_alloc = layout.rank()>0 ? ap.get_last_extent() : 1;
+    s.check_nan  = bounds.check_nan;
+    s.lb         = bounds.lb;
+    s.ub         = bounds.ub;
+
+    m_screened_idx.back() = screens.size();
+    for (int beg=0; beg<s.size; beg+=block_size) {
+      block_screen.push_back(screens.size());
+      block_begin.push_back(beg);
+    }
+    screens.push_back(s);
+  }
+  m_num_screened = screens.size();
+
+  // Copy screens and blocks info to device
+  auto to_dev = [](const auto& v, const std::string& name) {
+    using value_type = typename std::decay<decltype(v)>::type::value_type;
+    KT::view_1d<value_type> d(name,v.size());
+    auto h = Kokkos::create_mirror_view(d);
+    for (size_t i=0; i<v.size(); ++i) {
+      h(i) = v[i];
+    }
+    Kokkos::deep_copy(d,h);
+    return d;
+  };
+  m_screens      = to_dev(screens,"screens");
+  m_block_screen = to_dev(block_screen,"block_screen");
+  m_block_begin  = to_dev(block_begin,"block_begin");
+
+  m_status   = KT::view_1d<int>("status",m_num_screened);
+  m_status_h = Kokkos::create_mirror_view(m_status);
+}
+
+void FusedPropertyChecks::launch ()
+{
+  if (m_pending) {
+    // The status of the previous launch was never inspected
+    m_exec_space.fence();
+    m_pending = false;
+  }
+
+  if (m_num_screened==0) {
+    return;
+  }
+
+  run_kernel();
+
+  // Start the copy of the status to host. We only wait for it once
+  // the host actually needs the result (see needs_full_check).
+  Kokkos::deep_copy(m_exec_space,m_status_h,m_status);
+  m_pending = true;
+}
+
+void FusedPropertyChecks::run_kernel ()
+{
+  const auto screens      = m_screens;
+  const auto block_screen = m_block_screen;
+  const auto block_begin  = m_block_begin;
+  const auto status       = m_status;
+  const int  bs           = block_size;
+
+  Kokkos::deep_copy(m_exec_space,status,0);
+
+  const int nblocks = block_screen.extent(0);
+  const auto policy = ExeSpaceUtils::get_default_team_policy(nblocks,bs);
+  Kokkos::parallel_for("FusedPropertyChecks",policy,
+                       KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int ib = team.league_rank();
+    const int is = block_screen(ib);
+    const auto& s = screens(is);
+    const int beg = block_begin(ib);
+    const int end = beg+bs<s.size ? beg+bs : s.size;
+
+    int fail = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,beg,end),
+                            [&](const int idx, int& lfail) {
+      // Account for (possible) padding along the last dim
+      const long long i = idx / s.last_dim;
+      const long long j = idx % s.last_dim;
+      const Real v = s.data[i*s.last_alloc + j];
+      if ((s.check_nan and ekat::is_invalid(v)) or v<s.lb or v>s.ub) {
+        lfail = 1;
+      }
+    },Kokkos::Max<int>(fail));
+
+    if (fail) {
+      Kokkos::single(Kokkos::PerTeam(team),[&]{
+        Kokkos::atomic_max(&status(is),1);
+      });
+    }
+  });
+}
+
+bool FusedPropertyChecks::needs_full_check (const int i)
+{
+  EKAT_REQUIRE_MSG (i>=0 and i<num_checks(),
+      "Error! Property check index out of bounds.\n"
+      "  - index: " + std::to_string(i) + "\n"
+      "  - num checks: " + std::to_string(num_checks()) + "\n");
+
+  const int is = m_screened_idx[i];
+  if (is<0) {
+    return true;
+  }
+
+  if (m_pending) {
+    m_exec_space.fence();
+    m_pending = false;
+  }
+  return m_status_h(is)!=0;
+}
+
+} // namespace scream
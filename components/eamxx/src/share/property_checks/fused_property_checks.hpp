@@ -0,0 +1,107 @@
+#ifndef SCREAM_FUSED_PROPERTY_CHECKS_HPP
+#define SCREAM_FUSED_PROPERTY_CHECKS_HPP
+
+#include "share/property_checks/property_check.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A class to screen several property checks with a single kernel
+ *
+ * Each PropertyCheck runs its own reduction, and returns the result to host,
+ * which means one blocking device->host copy per check. When many checks are
+ * attached to a process, this adds up. However, most checks are simple
+ * pointwise checks (no NaN's, within bounds), which, in the vast majority of
+ * cases, pass.
+ *
+ * This class collects all the checks that support screening (see
+ * PropertyCheck::get_screening_bounds), and verifies all of them at once, in a
+ * single kernel, which writes a pass/fail status for each check in a small
+ * device array. The status is then copied to host, so that only the checks
+ * that did not pass the screening need to run their full check() method
+ * (which computes location/min/max of the failure, and possibly repairs).
+ *
+ * Usage:
+ *   - launch() starts the fused kernel and the copy of the status to host,
+ *     without waiting for them to complete;
+ *   - needs_full_check(i) waits for the status (if needed), and returns true
+ *     if the i-th check was not screened or did not pass the screening.
+ * The host can do other work (e.g., running non-screenable checks) between
+ * the two calls.
+ */
+
+class FusedPropertyChecks
+{
+public:
+  using check_ptr = std::shared_ptr<PropertyCheck>;
+
+  using KT = KokkosTypes<DefaultDevice>;
+  using ExeSpaceUtils = ekat::ExeSpaceUtils<KT::ExeSpace>;
+
+  // The fields of the screened checks must not be reallocated after this call
+  explicit FusedPropertyChecks (const std::vector<check_ptr>& checks);
+
+  int num_checks () const { return m_checks.size(); }
+  int num_screened_checks () const { return m_num_screened; }
+
+  // Whether check i is handled by the fused kernel
+  bool is_screened (const int i) const { return m_screened_idx[i]>=0; }
+
+  // Launch the fused kernel and the (async) copy of the status to host
+  void launch ();
+
+  // Whether check i must run its full check. Waits for the status, if needed.
+  bool needs_full_check (const int i);
+
+// CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+#ifndef EAMXX_ENABLE_GPU
+protected:
+#endif
+
+  // Description of the data of a screened check
+  struct Screen {
+    const Real* data;
+    int         size;       // Number of (logical) entries
+    int         last_dim;   // Logical extent of the last dimension
+    int         last_alloc; // Allocated extent of last dimension (can be padded)
+    int         check_nan;
+    double      lb, ub;
+  };
+
+  void run_kernel ();
+
+protected:
+
+  // The number of entries processed by each team of the fused kernel
+  static constexpr int block_size = 4096;
+
+  std::vector<check_ptr>  m_checks;
+
+  // For each check, index in the screens array (or -1 if not screened)
+  std::vector<int>        m_screened_idx;
+  int                     m_num_screened = 0;
+
+  KT::view_1d<Screen>     m_screens;
+
+  // Screen index and begin entry of each block of the fused kernel
+  KT::view_1d<int>        m_block_screen;
+  KT::view_1d<int>        m_block_begin;
+
+  // 0 if screen passes, 1 otherwise
+  KT::view_1d<int>                m_status;
+  KT::view_1d<int>::HostMirror    m_status_h;
+
+  KT::ExeSpace  m_exec_space;
+  bool          m_pending = false;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FUSED_PROPERTY_CHECKS_HPP
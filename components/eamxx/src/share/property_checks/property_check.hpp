@@ -7,6 +7,7 @@
 
 #include <string>
 #include <list>
+#include <limits>
 
 namespace scream
 {
@@ -118,6 +119,18 @@ public:
   // Whether the input check is the same as this class
   virtual bool same_as (const PropertyCheck& pc) const;
 
+  // Some pointwise checks on a single field can be expressed as "all entries
+  // are valid numbers and/or within [lb,ub]". Such checks can be screened
+  // together with other checks by a single kernel (see FusedPropertyChecks),
+  // so that check() only needs to run if the screening fails.
+  // Checks that support this must return true, and set the bounds.
+  struct ScreeningBounds {
+    bool   check_nan = false;
+    double lb = -std::numeric_limits<double>::max();
+    double ub =  std::numeric_limits<double>::max();
+  };
+  virtual bool get_screening_bounds (ScreeningBounds& /* bounds */) const { return false; }
+
 protected:
   virtual void repair_impl () const {
     EKAT_ERROR_MSG ("Error! The method 'repair_impl' has not been overridden.\n"
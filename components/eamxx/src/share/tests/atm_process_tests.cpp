@@ -582,6 +582,62 @@ TEST_CASE ("subcycling") {
   }
 }
 
+TEST_CASE ("perf_counters") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  ekat::ParameterList params;
+  params.set<std::string>("Grid Name", "Point Grid");
+  params.set("enable_perf_counters", true);
+
+  auto ap = std::make_shared<AddOne>(comm,params);
+  ap->set_grids(gm);
+
+  int ncols = 0;
+  for(const auto& req : ap->get_required_field_requests()) {
+    Field f(req.fid);
+    f.allocate_view();
+    f.deep_copy(0);
+    f.get_header().get_tracking().update_time_stamp(t0);
+    ap->set_required_field(f.get_const());
+    ap->set_computed_field(f);
+    ncols = req.fid.get_layout().size();
+  }
+
+  ap->initialize(t0,RunType::Initial);
+
+  const int nsteps = 3;
+  for (int i=0; i<nsteps; ++i) {
+    ap->run(1);
+  }
+
+  std::vector<AtmosphereProcess::PerfReport> reports;
+  ap->gather_perf_reports(reports);
+  REQUIRE (reports.size()==1);
+
+  // Field A is both read and written
+  const auto& r = reports.front();
+  REQUIRE (r.name==ap->name());
+  REQUIRE (r.nsteps==nsteps);
+  REQUIRE (r.bytes_per_step==2.0*sizeof(Real)*ncols*comm.size());
+  REQUIRE (r.time_per_step>=0);
+
+  // With perf counters disabled, no report is produced
+  params.set("enable_perf_counters", false);
+  auto ap_off = std::make_shared<AddOne>(comm,params);
+  reports.clear();
+  ap_off->gather_perf_reports(reports);
+  REQUIRE (reports.size()==0);
+}
+
 TEST_CASE ("diagnostics") {
 
   //TODO: This test needs a field manager so that changes in Field A are seen everywhere.
@@ -14,6 +14,96 @@ namespace {
 using namespace scream;
 using namespace scream::ShortFieldTagsNames;
 
+// Create fields of mixed layouts on the given grid (with padding on the last dim)
+std::vector<Field> create_fields (const AbstractGrid& grid, const std::string& suffix)
+{
+  constexpr int nlevs = 5;
+  constexpr int ncmps = 2;
+  const int ncols = grid.get_num_local_dofs();
+  const auto nondim = ekat::units::Units::nondimensional();
+  std::vector<FieldLayout> layouts = {
+    FieldLayout({COL},{ncols}),
+    FieldLayout({COL,LEV},{ncols,nlevs}),
+    FieldLayout({COL,CMP,LEV},{ncols,ncmps,nlevs})
+  };
+  std::vector<Field> fields;
+  for (size_t i=0; i<layouts.size(); ++i) {
+    Field f (FieldIdentifier("f"+std::to_string(i)+suffix,layouts[i],nondim,grid.name()));
+    f.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+    f.allocate_view();
+    fields.push_back(f);
+  }
+  return fields;
+}
+
+// Read/write a column of a field as a flat vector (on host)
+std::vector<Real> get_column (const Field& f, const int icol) {
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  std::vector<Real> col;
+  switch (fl.rank()) {
+    case 1:
+      col.push_back(f.get_view<const Real*,Host>()(icol));
+      break;
+    case 2:
+    {
+      auto v = f.get_view<const Real**,Host>();
+      for (int k=0; k<fl.dim(1); ++k) col.push_back(v(icol,k));
+      break;
+    }
+    case 3:
+    {
+      auto v = f.get_view<const Real***,Host>();
+      for (int j=0; j<fl.dim(1); ++j)
+        for (int k=0; k<fl.dim(2); ++k) col.push_back(v(icol,j,k));
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Unexpected rank in test.\n");
+  }
+  return col;
+}
+
+void set_column (const Field& f, const int icol, const std::vector<Real>& col) {
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  switch (fl.rank()) {
+    case 1:
+      f.get_view<Real*,Host>()(icol) = col[0];
+      break;
+    case 2:
+    {
+      auto v = f.get_view<Real**,Host>();
+      for (int k=0; k<fl.dim(1); ++k) v(icol,k) = col[k];
+      break;
+    }
+    case 3:
+    {
+      auto v = f.get_view<Real***,Host>();
+      for (int j=0,idx=0; j<fl.dim(1); ++j)
+        for (int k=0; k<fl.dim(2); ++k,++idx) v(icol,j,k) = col[idx];
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Unexpected rank in test.\n");
+  }
+}
+
+// Fill fields with values depending on gid, field index, and entry within the column
+void fill_fields (const std::vector<Field>& fields, const AbstractGrid& grid) {
+  using gid_type = AbstractGrid::gid_type;
+  auto gids = grid.get_dofs_gids().get_view<const gid_type*,Host>();
+  for (size_t ifield=0; ifield<fields.size(); ++ifield) {
+    const auto& f = fields[ifield];
+    for (int icol=0; icol<grid.get_num_local_dofs(); ++icol) {
+      auto col = get_column(f,icol);
+      for (size_t idx=0; idx<col.size(); ++idx) {
+        col[idx] = 1000*gids(icol) + 100*ifield + idx;
+      }
+      set_column(f,icol,col);
+    }
+    f.sync_to_dev();
+  }
+}
+
 TEST_CASE ("grid_import_export") {
   using gid_type = AbstractGrid::gid_type;
 
@@ -196,6 +286,84 @@ TEST_CASE ("grid_import_export") {
   if (comm.am_i_root()) {
     printf(" -> Testing scatter routine ... %s\n",ok ? "PASS" : "FAIL");
   }
+
+  // Test batched scatter against single-field scatter. Run it twice,
+  // to check that buffers and persistent requests can be reused.
+  if (comm.am_i_root()) {
+    printf(" -> Testing batched scatter ...\n");
+  }
+  ok = true;
+  auto scatter_src = create_fields(*src_grid,"_src");
+  auto scatter_dst = create_fields(*dst_grid,"_dst");
+  for (int irep=0; irep<2; ++irep) {
+    fill_fields(scatter_src,*src_grid);
+    for (auto& f : scatter_dst) {
+      f.deep_copy(Real(-1));
+    }
+    imp_exp.scatter(scatter_src,scatter_dst);
+
+    for (size_t ifield=0; ifield<scatter_src.size(); ++ifield) {
+      src_data.clear();
+      for (int i=0; i<src_grid->get_num_local_dofs(); ++i) {
+        src_data[i] = get_column(scatter_src[ifield],i);
+      }
+      dst_data.clear();
+      imp_exp.scatter(ekat::get_mpi_type<Real>(),src_data,dst_data);
+
+      scatter_dst[ifield].sync_to_host();
+      for (int i=0; i<dst_grid->get_num_local_dofs(); ++i) {
+        CHECK (get_column(scatter_dst[ifield],i)==dst_data.at(i));
+        ok &= catch_capture.lastAssertionPassed();
+      }
+    }
+  }
+  if (comm.am_i_root()) {
+    printf(" -> Testing batched scatter ... %s\n",ok ? "PASS" : "FAIL");
+  }
+
+  // Test batched gather against single-field gather. The batched version
+  // sums the contributions, while the single-field one appends them.
+  if (comm.am_i_root()) {
+    printf(" -> Testing batched gather ....\n");
+  }
+  ok = true;
+  auto gather_src = create_fields(*dst_grid,"_src");
+  auto gather_dst = create_fields(*src_grid,"_dst");
+  constexpr Real untouched = -1;
+  for (int irep=0; irep<2; ++irep) {
+    fill_fields(gather_src,*dst_grid);
+    for (auto& f : gather_dst) {
+      f.deep_copy(untouched);
+    }
+    imp_exp.gather(gather_src,gather_dst);
+
+    for (size_t ifield=0; ifield<gather_src.size(); ++ifield) {
+      src_data.clear();
+      for (int i=0; i<dst_grid->get_num_local_dofs(); ++i) {
+        src_data[i] = get_column(gather_src[ifield],i);
+      }
+      dst_data.clear();
+      imp_exp.gather(ekat::get_mpi_type<Real>(),src_data,dst_data);
+
+      gather_dst[ifield].sync_to_host();
+      for (int i=0; i<src_grid->get_num_local_dofs(); ++i) {
+        const auto col = get_column(gather_dst[ifield],i);
+        std::vector<Real> expected(col.size(),untouched);
+        if (dst_data.count(i)==1) {
+          const auto& v = dst_data.at(i);
+          std::fill(expected.begin(),expected.end(),0);
+          for (size_t j=0; j<v.size(); ++j) {
+            expected[j % col.size()] += v[j];
+          }
+        }
+        CHECK (col==expected);
+        ok &= catch_capture.lastAssertionPassed();
+      }
+    }
+  }
+  if (comm.am_i_root()) {
+    printf(" -> Testing batched gather .... %s\n",ok ? "PASS" : "FAIL");
+  }
 }
 
 } // anonymous namespace
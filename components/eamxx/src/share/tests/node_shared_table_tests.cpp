@@ -0,0 +1,103 @@
+#include <catch2/catch.hpp>
+
+#include "share/util/eamxx_node_shared_table.hpp"
+
+#include <filesystem>
+
+namespace {
+
+TEST_CASE ("node_shared_table") {
+  using namespace scream;
+  namespace fs = std::filesystem;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  const long long size = 1000;
+  int num_reads = 0;
+  auto reader = [&](double* data, const long long n) {
+    ++num_reads;
+    for (long long i=0; i<n; ++i) {
+      data[i] = i + 0.5;
+    }
+  };
+  auto bad_reader = [](double*, const long long) {
+    EKAT_ERROR_MSG ("Error! This reader should not be called.\n");
+  };
+
+  auto check_data = [&](const NodeSharedTable& table) {
+    REQUIRE (table.size()==size);
+    for (long long i=0; i<size; ++i) {
+      REQUIRE (table.data()[i]==i+0.5);
+    }
+  };
+
+  // Only one rank per node calls the reader
+  auto check_reads = [&](const int expected_max) {
+    int tot_reads;
+    comm.all_reduce(&num_reads,&tot_reads,1,MPI_SUM);
+    REQUIRE (num_reads<=1);
+    REQUIRE (tot_reads>=(expected_max>0 ? 1 : 0));
+    REQUIRE (tot_reads<=expected_max);
+    num_reads = 0;
+  };
+
+  SECTION ("no_cache") {
+    NodeSharedTable table(comm,"table","v1",size,reader);
+    check_data(table);
+    REQUIRE (not table.loaded_from_cache());
+    check_reads(comm.size());
+  }
+
+  SECTION ("cache") {
+    const std::string cache_dir = "node_shared_table_cache_np" + std::to_string(comm.size());
+    if (comm.am_i_root()) {
+      fs::remove_all(cache_dir);
+      fs::create_directories(cache_dir);
+    }
+    comm.barrier();
+
+    // Cache miss: the reader is called, and the cache file is created
+    {
+      NodeSharedTable table(comm,"table","v1",size,reader,cache_dir);
+      check_data(table);
+      REQUIRE (not table.loaded_from_cache());
+      check_reads(comm.size());
+    }
+    comm.barrier();
+    REQUIRE (fs::exists(NodeSharedTable::cache_file_name(cache_dir,"table","v1")));
+
+    // Cache hit: the reader is never called
+    {
+      NodeSharedTable table(comm,"table","v1",size,bad_reader,cache_dir);
+      check_data(table);
+      REQUIRE (table.loaded_from_cache());
+    }
+
+    // Different version or size: cache miss
+    {
+      NodeSharedTable table(comm,"table","v2",size,reader,cache_dir);
+      check_data(table);
+      REQUIRE (not table.loaded_from_cache());
+      check_reads(comm.size());
+    }
+    comm.barrier();
+    {
+      NodeSharedTable table(comm,"table","v1",size-1,reader,cache_dir);
+      REQUIRE (not table.loaded_from_cache());
+      check_reads(comm.size());
+    }
+  }
+
+  SECTION ("errors") {
+    // All ranks throw if the reader fails
+    REQUIRE_THROWS (NodeSharedTable(comm,"table","v1",size,bad_reader));
+    REQUIRE_THROWS (NodeSharedTable(comm,"table","v1",0,reader));
+
+    // A failed construction releases its window and comm, and does not
+    // leave the node ranks out of sync for the next table
+    NodeSharedTable table(comm,"table","v1",size,reader);
+    check_data(table);
+  }
+}
+
+} // anonymous namespace
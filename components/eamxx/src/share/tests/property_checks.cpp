@@ -5,6 +5,7 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_upper_bound_check.hpp"
 #include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/fused_property_checks.hpp"
 #include "share/util/scream_setup_random_test.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/field/field_utils.hpp"
@@ -311,6 +312,60 @@ TEST_CASE("property_checks", "") {
       REQUIRE(f_data[i] == 1.0);
     }
   }
+  // Check that the fused screening agrees with the individual checks
+  SECTION ("fused_checks") {
+    // A padded field, with NaN's in the padding, which must be ignored
+    const int nlevs_pad = ekat::PackInfo<SCREAM_PACK_SIZE>::num_packs(nlevs)*SCREAM_PACK_SIZE;
+    FieldIdentifier gid ("field_2", {{COL,LEV},{num_lcols,nlevs}}, m/s,"some_grid");
+    Field g(gid);
+    g.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+    g.allocate_view();
+    auto g_data = g.get_internal_view_data<Real,Host>();
+    for (int i=0; i<num_lcols; ++i) {
+      for (int k=0; k<nlevs_pad; ++k) {
+        g_data[i*nlevs_pad+k] = k<nlevs ? 0.5 : std::numeric_limits<Real>::quiet_NaN();
+      }
+    }
+    g.sync_to_dev();
+    f.deep_copy(0.5);
+
+    std::vector<FusedPropertyChecks::check_ptr> checks = {
+      std::make_shared<FieldNaNCheck>(f,grid),
+      std::make_shared<FieldWithinIntervalCheck>(f,grid,0,1),
+      std::make_shared<FieldNaNCheck>(g,grid),
+      std::make_shared<FieldLowerBoundCheck>(g,grid,0),
+      std::make_shared<FieldNaNCheck>(f.get_component(1),grid)
+    };
+    FusedPropertyChecks fused(checks);
+    REQUIRE (fused.num_checks()==5);
+    REQUIRE (fused.num_screened_checks()==4);
+    REQUIRE (not fused.is_screened(4));
+
+    // All pass
+    fused.launch();
+    for (int i=0; i<4; ++i) {
+      REQUIRE (not fused.needs_full_check(i));
+    }
+    REQUIRE (fused.needs_full_check(4));
+
+    // Break the interval check on f, and the NaN check on g
+    auto f_view = f.get_strided_view<Real***,Host>();
+    f_view(1,2,3) = 2.0;
+    f.sync_to_dev();
+    g_data[nlevs_pad+1] = std::numeric_limits<Real>::quiet_NaN();
+    g.sync_to_dev();
+    fused.launch();
+    REQUIRE (not fused.needs_full_check(0));
+    REQUIRE (fused.needs_full_check(1));
+    REQUIRE (fused.needs_full_check(2));
+    REQUIRE (not fused.needs_full_check(3));
+
+    // Screening and full check must agree
+    for (int i=0; i<4; ++i) {
+      const bool pass = checks[i]->check().result==CheckResult::Pass;
+      REQUIRE (pass!=fused.needs_full_check(i));
+    }
+  }
 }
 
 } // anonymous namespace
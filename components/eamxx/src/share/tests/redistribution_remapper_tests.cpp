@@ -0,0 +1,199 @@
+#include <catch2/catch.hpp>
+
+#include "share/grid/remap/redistribution_remapper.hpp"
+#include "share/grid/point_grid.hpp"
+#include "share/field/field_utils.hpp"
+
+#include <numeric>
+
+namespace {
+
+using namespace scream;
+using namespace scream::ShortFieldTagsNames;
+using gid_type = AbstractGrid::gid_type;
+
+Real get_value (const gid_type gid, const int j, const int k) {
+  return 1000*gid + 10*j + k;
+}
+
+Field create_field (const std::string& name, const FieldLayout& layout,
+                    const std::string& grid_name)
+{
+  Field f (FieldIdentifier(name,layout,ekat::units::Units::nondimensional(),grid_name));
+  f.get_header().get_alloc_properties().request_allocation(SCREAM_PACK_SIZE);
+  f.allocate_view();
+  return f;
+}
+
+void fill (const Field& f, const std::shared_ptr<const AbstractGrid>& grid) {
+  auto gids = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  switch (fl.rank()) {
+    case 1:
+    {
+      auto v = f.get_view<Real*,Host>();
+      for (int i=0; i<fl.dim(0); ++i) {
+        v(i) = fl.has_tag(COL) ? get_value(gids(i),0,0) : get_value(0,0,i);
+      }
+      break;
+    }
+    case 2:
+    {
+      auto v = f.get_view<Real**,Host>();
+      for (int i=0; i<fl.dim(0); ++i) {
+        for (int k=0; k<fl.dim(1); ++k) {
+          v(i,k) = get_value(gids(i),0,k);
+        }
+      }
+      break;
+    }
+    case 3:
+    {
+      auto v = f.get_view<Real***,Host>();
+      for (int i=0; i<fl.dim(0); ++i) {
+        for (int j=0; j<fl.dim(1); ++j) {
+          for (int k=0; k<fl.dim(2); ++k) {
+            v(i,j,k) = get_value(gids(i),j,k);
+          }
+        }
+      }
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Unexpected rank in test.\n");
+  }
+  f.sync_to_dev();
+}
+
+TEST_CASE ("redistribution_remapper") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  const int nranks = comm.size();
+  const int ngcols = 7*nranks + 1;
+  const int nlevs  = 5;
+  const int ncmps  = 2;
+
+  // Create a grid, with a geometry field depending on the gid
+  auto src_grid = create_point_grid("src",ngcols,nlevs,comm);
+  const auto layout2d = src_grid->get_2d_scalar_layout();
+  auto lat = src_grid->create_geometry_data("lat",layout2d,ekat::units::Units::nondimensional());
+  fill(lat,src_grid);
+
+  // The cost of each column grows with the gid
+  auto src_gids = src_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto cost = create_field("cost",layout2d,src_grid->name());
+  auto cost_h = cost.get_view<Real*,Host>();
+  for (int i=0; i<src_grid->get_num_local_dofs(); ++i) {
+    cost_h(i) = 1 + src_gids(i);
+  }
+  cost.sync_to_dev();
+
+  auto tgt_grid = create_cost_balanced_grid("tgt",src_grid,cost);
+
+  SECTION ("balanced_grid") {
+    const int nlcols = tgt_grid->get_num_local_dofs();
+    REQUIRE (tgt_grid->get_num_global_dofs()==ngcols);
+    REQUIRE (tgt_grid->is_unique());
+    REQUIRE (nlcols>0);
+
+    int ncols_sum = 0;
+    comm.all_reduce(&nlcols,&ncols_sum,1,MPI_SUM);
+    REQUIRE (ncols_sum==ngcols);
+
+    // The cost of each rank is within one column cost of the ideal one
+    auto tgt_gids = tgt_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+    double my_cost = 0;
+    for (int i=0; i<nlcols; ++i) {
+      my_cost += 1 + tgt_gids(i);
+    }
+    const double ideal_cost = 0.5*ngcols*(ngcols+1) / nranks;
+    REQUIRE (std::abs(my_cost-ideal_cost)<=ngcols);
+
+    // Geometry data was redistributed
+    REQUIRE (tgt_grid->has_geometry_data("lat"));
+    auto tgt_lat = tgt_grid->get_geometry_data("lat").get_view<const Real*,Host>();
+    for (int i=0; i<nlcols; ++i) {
+      REQUIRE (tgt_lat(i)==get_value(tgt_gids(i),0,0));
+    }
+  }
+
+  SECTION ("remap") {
+    auto src_s2d = create_field("s2d",src_grid->get_2d_scalar_layout(),"src");
+    auto src_s3d = create_field("s3d",src_grid->get_3d_scalar_layout(true),"src");
+    auto src_v3d = create_field("v3d",src_grid->get_3d_vector_layout(false,ncmps),"src");
+    auto src_lev = create_field("lev",src_grid->get_vertical_layout(true),"src");
+
+    auto tgt_s2d = create_field("s2d",tgt_grid->get_2d_scalar_layout(),"tgt");
+    auto tgt_s3d = create_field("s3d",tgt_grid->get_3d_scalar_layout(true),"tgt");
+    auto tgt_v3d = create_field("v3d",tgt_grid->get_3d_vector_layout(false,ncmps),"tgt");
+    auto tgt_lev = create_field("lev",tgt_grid->get_vertical_layout(true),"tgt");
+
+    std::vector<Field> src_f = {src_s2d, src_s3d, src_v3d, src_lev};
+    std::vector<Field> tgt_f = {tgt_s2d, tgt_s3d, tgt_v3d, tgt_lev};
+
+    RedistributionRemapper remapper(src_grid,tgt_grid);
+    remapper.registration_begins();
+    for (size_t i=0; i<src_f.size(); ++i) {
+      remapper.register_field(src_f[i],tgt_f[i]);
+    }
+    remapper.registration_ends();
+
+    auto check = [&](const std::vector<Field>& fields,
+                     const std::shared_ptr<const AbstractGrid>& grid) {
+      for (const auto& f : fields) {
+        auto expected = f.clone();
+        fill(expected,grid);
+        f.sync_to_host();
+        REQUIRE (views_are_equal(f,expected));
+      }
+    };
+
+    // Fwd remap
+    for (auto& f : src_f) {
+      fill(f,src_grid);
+    }
+    remapper.remap(true);
+    check(tgt_f,tgt_grid);
+
+    // Bwd remap
+    for (auto& f : src_f) {
+      f.deep_copy(0);
+    }
+    remapper.remap(false);
+    check(src_f,src_grid);
+  }
+
+  SECTION ("remap_subfields") {
+    // Like HommeDynamics does with FM, remap only some components of a vector field
+    auto src_v3d = create_field("v3d",src_grid->get_3d_vector_layout(true,ncmps),"src");
+    auto tgt_v3d = create_field("v3d",tgt_grid->get_3d_vector_layout(true,ncmps),"tgt");
+    auto src_s2d = create_field("s2d",src_grid->get_2d_scalar_layout(),"src");
+    auto tgt_s2d = create_field("s2d",tgt_grid->get_2d_scalar_layout(),"tgt");
+    fill(src_v3d,src_grid);
+    fill(src_s2d,src_grid);
+    tgt_v3d.deep_copy(0);
+
+    RedistributionRemapper remapper(src_grid,tgt_grid);
+    remapper.registration_begins();
+    remapper.register_field(src_v3d.get_component(1),tgt_v3d.get_component(1));
+    remapper.register_field(src_s2d,tgt_s2d);
+    remapper.registration_ends();
+    remapper.remap(true);
+
+    auto tgt_gids = tgt_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+    tgt_v3d.sync_to_host();
+    tgt_s2d.sync_to_host();
+    auto v = tgt_v3d.get_view<const Real***,Host>();
+    auto s = tgt_s2d.get_view<const Real*,Host>();
+    for (int i=0; i<tgt_grid->get_num_local_dofs(); ++i) {
+      REQUIRE (s(i)==get_value(tgt_gids(i),0,0));
+      for (int k=0; k<nlevs; ++k) {
+        // Component 0 was not remapped
+        REQUIRE (v(i,0,k)==0);
+        REQUIRE (v(i,1,k)==get_value(tgt_gids(i),1,k));
+      }
+    }
+  }
+}
+
+} // anonymous namespace
@@ -5,8 +5,18 @@
 #include "share/util/scream_utils.hpp"
 #include "share/util/scream_time_stamp.hpp"
 #include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_timing.hpp"
+#include "share/util/eamxx_load_imbalance.hpp"
 #include "share/scream_config.hpp"
 
+#include <gptl.h>
+
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
 TEST_CASE("contiguous_superset") {
   using namespace scream;
 
@@ -250,3 +260,155 @@ TEST_CASE ("array_utils") {
     }
   }
 }
+
+TEST_CASE ("timeline_trace") {
+  using namespace scream;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  bool gptl_was_inited;
+  init_gptl(gptl_was_inited);
+
+  // A buffer of 4 events only keeps the last outer/inner pair
+  enable_timeline_tracing(comm,4);
+  REQUIRE (is_timeline_tracing_enabled());
+  for (int i=0; i<3; ++i) {
+    start_timer("outer");
+    start_timer("inner");
+    stop_timer("inner");
+    stop_timer("outer");
+  }
+
+  const std::string prefix = "timeline_trace_np" + std::to_string(comm.size());
+  write_timeline_trace(comm,prefix);
+
+  std::ifstream ifile(prefix + ".rank" + std::to_string(comm.rank()) + ".json");
+  REQUIRE (ifile.good());
+  std::stringstream ss;
+  ss << ifile.rdbuf();
+  const auto trace = ss.str();
+
+  auto count = [&](const std::string& s) {
+    int n = 0;
+    for (auto pos=trace.find(s); pos!=std::string::npos; pos=trace.find(s,pos+1)) {
+      ++n;
+    }
+    return n;
+  };
+  REQUIRE (count("\"name\":\"outer\"")==2);
+  REQUIRE (count("\"name\":\"inner\"")==2);
+  REQUIRE (count("\"ph\":\"B\"")==2);
+  REQUIRE (count("\"ph\":\"E\"")==2);
+  REQUIRE (count("\"dropped_events\":8")==1);
+
+  // Do not leave the tracer on for the other tests
+  disable_timeline_tracing();
+  REQUIRE (not is_timeline_tracing_enabled());
+
+  if (not gptl_was_inited) {
+    finalize_gptl();
+  }
+}
+
+TEST_CASE ("timer_handle") {
+  using namespace scream;
+
+  bool gptl_was_inited;
+  init_gptl(gptl_was_inited);
+
+  // Handle-based and name-based calls must update the same timer
+  TimerHandle timer("timer_handle");
+  for (int i=0; i<5; ++i) {
+    ScopedTimer st(timer);
+  }
+  start_timer("timer_handle");
+  stop_timer("timer_handle");
+
+  // Renaming resets the cached entry
+  timer.set_name("timer_handle_renamed");
+  timer.start();
+  timer.stop();
+
+  int count, onflg;
+  double wall, usr, sys;
+  REQUIRE (GPTLquery("timer_handle",-1,&count,&onflg,&wall,&usr,&sys,nullptr,0)==0);
+  REQUIRE (count==6);
+  REQUIRE (onflg==0);
+  REQUIRE (GPTLquery("timer_handle_renamed",-1,&count,&onflg,&wall,&usr,&sys,nullptr,0)==0);
+  REQUIRE (count==1);
+
+  if (not gptl_was_inited) {
+    finalize_gptl();
+  }
+}
+
+TEST_CASE ("timer_wallclock_with_gptl_prefix") {
+  using namespace scream;
+
+  bool gptl_was_inited;
+  init_gptl(gptl_was_inited);
+
+  // CIME sets a GPTL prefix (e.g., "a:" in the run phase), which GPTL
+  // prepends to the timer names. The tracked wall time must not be affected.
+  enable_timer_wallclock_tracking();
+  REQUIRE (is_timer_wallclock_tracking_enabled());
+  GPTLprefix_set("a:");
+
+  TimerHandle timer("wallclock_handle");
+  for (int i=0; i<3; ++i) {
+    ScopedTimer st(timer);
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  start_timer("wallclock_name");
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  stop_timer("wallclock_name");
+
+  GPTLprefix_unset();
+
+  // GPTL only knows the prefixed names
+  int count, onflg;
+  double wall, usr, sys;
+  REQUIRE (GPTLquery("a:wallclock_handle",-1,&count,&onflg,&wall,&usr,&sys,nullptr,0)==0);
+  REQUIRE (count==3);
+
+  REQUIRE (get_timer_wallclock("wallclock_handle")>=0.03);
+  REQUIRE (get_timer_wallclock("wallclock_handle")<=wall*1.5);
+  REQUIRE (get_timer_wallclock("wallclock_name")>=0.01);
+  REQUIRE (get_timer_wallclock("not_a_timer")==0);
+
+  if (not gptl_was_inited) {
+    finalize_gptl();
+  }
+}
+
+TEST_CASE ("load_imbalance") {
+  using namespace scream;
+
+  // Cost proportional to work: perfect correlation
+  std::vector<double> costs = {2, 4, 1, 4, 1};
+  std::vector<double> work  = {20, 40, 10, 40, 10};
+  auto stats = compute_load_imbalance(costs,work,3);
+  REQUIRE (stats.min==1);
+  REQUIRE (stats.max==4);
+  REQUIRE (stats.mean==2.4);
+  REQUIRE (stats.imbalance==4/2.4);
+  REQUIRE (stats.slowest_ranks==std::vector<int>{1,3,0});
+  REQUIRE (stats.slowest_costs==std::vector<double>{4,4,2});
+  REQUIRE (std::abs(stats.work_correlation-1)<1e-12);
+
+  // Same work on all ranks: correlation is undefined, and set to 0
+  work.assign(work.size(),10);
+  stats = compute_load_imbalance(costs,work,10);
+  REQUIRE (stats.work_correlation==0);
+  REQUIRE (stats.slowest_ranks.size()==costs.size());
+
+  // Parallel version: cost is the rank id, and work decreases with rank
+  ekat::Comm comm(MPI_COMM_WORLD);
+  const int n = comm.size();
+  stats = compute_load_imbalance(comm,comm.rank(),n-comm.rank(),1);
+  REQUIRE (stats.max==n-1);
+  REQUIRE (stats.slowest_ranks==std::vector<int>{n-1});
+  if (n>1) {
+    REQUIRE (std::abs(stats.work_correlation+1)<1e-12);
+  }
+}
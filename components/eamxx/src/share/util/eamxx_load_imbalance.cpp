@@ -0,0 +1,77 @@
+#include "share/util/eamxx_load_imbalance.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace scream {
+
+LoadImbalanceStats
+compute_load_imbalance (const std::vector<double>& costs,
+                        const std::vector<double>& work,
+                        const int num_slowest)
+{
+  EKAT_REQUIRE_MSG (costs.size()>0,
+      "Error! Cannot compute load imbalance of an empty set of ranks.\n");
+  EKAT_REQUIRE_MSG (work.size()==costs.size(),
+      "Error! Costs and work must have the same size.\n"
+      "  - costs size: " + std::to_string(costs.size()) + "\n"
+      "  - work size : " + std::to_string(work.size()) + "\n");
+  EKAT_REQUIRE_MSG (num_slowest>=0,
+      "Error! Invalid number of slowest ranks.\n"
+      "  - num slowest: " + std::to_string(num_slowest) + "\n");
+
+  const int n = costs.size();
+
+  LoadImbalanceStats stats;
+  stats.min  = *std::min_element(costs.begin(),costs.end());
+  stats.max  = *std::max_element(costs.begin(),costs.end());
+  stats.mean = std::accumulate(costs.begin(),costs.end(),0.0) / n;
+  stats.imbalance = stats.mean>0 ? stats.max/stats.mean : 1;
+
+  // Sort ranks by decreasing cost (ties broken by rank, for reproducibility)
+  std::vector<int> ranks(n);
+  std::iota(ranks.begin(),ranks.end(),0);
+  const int ns = std::min(num_slowest,n);
+  std::partial_sort(ranks.begin(),ranks.begin()+ns,ranks.end(),
+                    [&](const int i, const int j) {
+    return costs[i]>costs[j] or (costs[i]==costs[j] and i<j);
+  });
+  for (int i=0; i<ns; ++i) {
+    stats.slowest_ranks.push_back(ranks[i]);
+    stats.slowest_costs.push_back(costs[ranks[i]]);
+  }
+
+  const double work_mean = std::accumulate(work.begin(),work.end(),0.0) / n;
+  double cov = 0, var_c = 0, var_w = 0;
+  for (int i=0; i<n; ++i) {
+    const double dc = costs[i] - stats.mean;
+    const double dw = work[i] - work_mean;
+    cov   += dc*dw;
+    var_c += dc*dc;
+    var_w += dw*dw;
+  }
+  if (var_c>0 and var_w>0) {
+    stats.work_correlation = cov / std::sqrt(var_c*var_w);
+  }
+
+  return stats;
+}
+
+LoadImbalanceStats
+compute_load_imbalance (const ekat::Comm& comm,
+                        const double my_cost,
+                        const double my_work,
+                        const int num_slowest)
+{
+  const int n = comm.size();
+  std::vector<double> costs(n), work(n);
+  MPI_Allgather (&my_cost,1,MPI_DOUBLE,costs.data(),1,MPI_DOUBLE,comm.mpi_comm());
+  MPI_Allgather (&my_work,1,MPI_DOUBLE,work.data(),1,MPI_DOUBLE,comm.mpi_comm());
+
+  return compute_load_imbalance(costs,work,num_slowest);
+}
+
+} // namespace scream
@@ -0,0 +1,54 @@
+#ifndef EAMXX_LOAD_IMBALANCE_HPP
+#define EAMXX_LOAD_IMBALANCE_HPP
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <vector>
+
+namespace scream {
+
+/*
+ * Statistics of the distribution across ranks of a per-rank cost
+ * (typically, the time spent in a timer), used to tell which ranks
+ * are slow in which phase of the run.
+ *
+ * The work correlation is the Pearson correlation coefficient between the
+ * cost and the work assigned to each rank (e.g., number of local columns).
+ * A value close to 1 means the imbalance comes from the decomposition,
+ * while a value close to 0 means it comes from something else, such as
+ * state-dependent costs (e.g., clouds, CRM activity) or a slow node.
+ * If either cost or work is the same on all ranks, it is set to 0.
+ */
+
+struct LoadImbalanceStats {
+  double min  = 0;
+  double max  = 0;
+  double mean = 0;
+
+  // max/mean. With perfect balance, this is 1.
+  double imbalance = 1;
+
+  // Ranks with the largest costs, sorted by decreasing cost
+  std::vector<int>    slowest_ranks;
+  std::vector<double> slowest_costs;
+
+  double work_correlation = 0;
+};
+
+// Compute stats given cost and work of all ranks
+LoadImbalanceStats
+compute_load_imbalance (const std::vector<double>& costs,
+                        const std::vector<double>& work,
+                        const int num_slowest);
+
+// Gather cost and work from all ranks, and compute stats.
+// NOTE: this is a collective operation, and the result is the same on all ranks.
+LoadImbalanceStats
+compute_load_imbalance (const ekat::Comm& comm,
+                        const double my_cost,
+                        const double my_work,
+                        const int num_slowest);
+
+} // namespace scream
+
+#endif // EAMXX_LOAD_IMBALANCE_HPP
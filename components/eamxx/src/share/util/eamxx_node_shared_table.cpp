@@ -0,0 +1,222 @@
+#include "share/util/eamxx_node_shared_table.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <unistd.h>
+
+namespace scream {
+
+namespace {
+
+// Bump this if the layout of the cache file changes
+constexpr int cache_format_version = 1;
+constexpr char cache_magic[8] = {'E','A','M','X','X','T','B','L'};
+
+void check_mpi_call (int err, const std::string& context) {
+  EKAT_REQUIRE_MSG (err==MPI_SUCCESS,
+      "Error! MPI operation encountered an error.\n"
+      "  - err code: " + std::to_string(err) + "\n"
+      "  - context: " + context + "\n");
+}
+
+} // anonymous namespace
+
+NodeSharedTable::
+NodeSharedTable (const ekat::Comm& comm,
+                 const std::string& name,
+                 const std::string& version,
+                 const long long size,
+                 const reader_type& reader,
+                 const std::string& cache_dir)
+ : m_name (name)
+ , m_version (version)
+ , m_size (size)
+{
+  EKAT_REQUIRE_MSG (size>0,
+      "Error! Invalid size for node-shared table.\n"
+      "  - table name: " + name + "\n"
+      "  - table size: " + std::to_string(size) + "\n");
+  EKAT_REQUIRE_MSG (reader,
+      "Error! Invalid reader for node-shared table.\n"
+      "  - table name: " + name + "\n");
+
+  // Group the ranks that can share memory
+  int err = MPI_Comm_split_type(comm.mpi_comm(),MPI_COMM_TYPE_SHARED,comm.rank(),MPI_INFO_NULL,&m_node_comm);
+  check_mpi_call(err,"MPI_Comm_split_type");
+
+  // The destructor does not run if the constructor throws, so release the
+  // window and the node comm here before propagating the exception.
+  try {
+    setup(name,version,size,reader,cache_dir);
+  } catch (...) {
+    free_mpi_objects();
+    throw;
+  }
+}
+
+void NodeSharedTable::
+setup (const std::string& name,
+       const std::string& version,
+       const long long size,
+       const reader_type& reader,
+       const std::string& cache_dir)
+{
+  int node_rank;
+  MPI_Comm_rank(m_node_comm,&node_rank);
+
+  // Only the node root allocates memory; the other ranks query its address
+  const MPI_Aint my_bytes = node_rank==0 ? size*sizeof(double) : 0;
+  double* my_base = nullptr;
+  int err = MPI_Win_allocate_shared(my_bytes,sizeof(double),MPI_INFO_NULL,m_node_comm,&my_base,&m_win);
+  check_mpi_call(err,"MPI_Win_allocate_shared");
+  if (node_rank==0) {
+    m_data = my_base;
+  } else {
+    MPI_Aint root_bytes;
+    int disp_unit;
+    err = MPI_Win_shared_query(m_win,0,&root_bytes,&disp_unit,&m_data);
+    check_mpi_call(err,"MPI_Win_shared_query");
+  }
+
+  // Load the table on the node root. If something goes wrong, we cannot throw
+  // right away, or the other ranks on the node would hang in the collectives below.
+  err = MPI_Win_fence(0,m_win);
+  check_mpi_call(err,"MPI_Win_fence");
+  int status[2] = {0,0}; // {error, loaded_from_cache}
+  std::string err_msg;
+  if (node_rank==0) {
+    try {
+      const auto cache_file = cache_dir=="" ? "" : cache_file_name(cache_dir,name,version);
+      if (cache_file!="" and read_cache(cache_file,m_data)) {
+        status[1] = 1;
+      } else {
+        reader(m_data,size);
+        if (cache_file!="") {
+          write_cache(cache_file,m_data);
+        }
+      }
+    } catch (std::exception& e) {
+      status[0] = 1;
+      err_msg = e.what();
+    }
+  }
+
+  // Agree on the outcome before the closing fence, so that all ranks
+  // of the node either complete the epoch, or throw together.
+  err = MPI_Allreduce(MPI_IN_PLACE,status,2,MPI_INT,MPI_MAX,m_node_comm);
+  check_mpi_call(err,"MPI_Allreduce");
+  EKAT_REQUIRE_MSG (status[0]==0,
+      "Error! Could not load node-shared table.\n"
+      "  - table name: " + name + "\n"
+      "  - table version: " + version + "\n" +
+      (node_rank==0 ? "  - error: " + err_msg + "\n"
+                    : "  - see the error message from the node root.\n"));
+
+  err = MPI_Win_fence(0,m_win);
+  check_mpi_call(err,"MPI_Win_fence");
+  m_loaded_from_cache = status[1]==1;
+}
+
+void NodeSharedTable::free_mpi_objects ()
+{
+  if (m_win!=MPI_WIN_NULL) {
+    MPI_Win_free(&m_win);
+  }
+  if (m_node_comm!=MPI_COMM_NULL) {
+    MPI_Comm_free(&m_node_comm);
+  }
+  m_data = nullptr;
+}
+
+NodeSharedTable::~NodeSharedTable ()
+{
+  free_mpi_objects();
+}
+
+std::string NodeSharedTable::
+cache_file_name (const std::string& cache_dir,
+                 const std::string& name,
+                 const std::string& version)
+{
+  return cache_dir + "/" + name + "." + version + ".bin";
+}
+
+bool NodeSharedTable::
+read_cache (const std::string& filename, double* data) const
+{
+  std::ifstream in (filename,std::ios::binary);
+  if (not in.good()) {
+    return false;
+  }
+
+  // Anything that does not match (including a truncated file) is a cache miss
+  auto read_string = [&](std::string& s) {
+    int len = 0;
+    in.read(reinterpret_cast<char*>(&len),sizeof(int));
+    if (not in.good() or len<0 or len>1024) {
+      return false;
+    }
+    s.resize(len);
+    in.read(&s[0],len);
+    return in.good();
+  };
+
+  char magic[8];
+  int format;
+  std::string name, version;
+  long long size;
+  in.read(magic,8);
+  in.read(reinterpret_cast<char*>(&format),sizeof(int));
+  if (not in.good() or std::memcmp(magic,cache_magic,8)!=0 or format!=cache_format_version) {
+    return false;
+  }
+  if (not read_string(name) or not read_string(version) or name!=m_name or version!=m_version) {
+    return false;
+  }
+  in.read(reinterpret_cast<char*>(&size),sizeof(long long));
+  if (not in.good() or size!=m_size) {
+    return false;
+  }
+  in.read(reinterpret_cast<char*>(data),m_size*sizeof(double));
+  return static_cast<long long>(in.gcount())==static_cast<long long>(m_size*sizeof(double));
+}
+
+void NodeSharedTable::
+write_cache (const std::string& filename, const double* data) const
+{
+  // Write to a file with a unique name, then rename it atomically
+  char host[256] = "";
+  gethostname(host,sizeof(host)-1);
+  const auto tmp_file = filename + ".tmp." + host + "." + std::to_string(getpid());
+  {
+    std::ofstream out (tmp_file,std::ios::binary);
+    if (not out.good()) {
+      // The cache is just an optimization: if we can't write it, move on.
+      return;
+    }
+    auto write_string = [&](const std::string& s) {
+      const int len = s.size();
+      out.write(reinterpret_cast<const char*>(&len),sizeof(int));
+      out.write(s.data(),len);
+    };
+    out.write(cache_magic,8);
+    out.write(reinterpret_cast<const char*>(&cache_format_version),sizeof(int));
+    write_string(m_name);
+    write_string(m_version);
+    out.write(reinterpret_cast<const char*>(&m_size),sizeof(long long));
+    out.write(reinterpret_cast<const char*>(data),m_size*sizeof(double));
+    if (not out.good()) {
+      out.close();
+      std::remove(tmp_file.c_str());
+      return;
+    }
+  }
+  if (std::rename(tmp_file.c_str(),filename.c_str())!=0) {
+    std::remove(tmp_file.c_str());
+  }
+}
+
+} // namespace scream
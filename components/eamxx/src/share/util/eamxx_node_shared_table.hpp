@@ -0,0 +1,97 @@
+#ifndef EAMXX_NODE_SHARED_TABLE_HPP
+#define EAMXX_NODE_SHARED_TABLE_HPP
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <mpi.h>
+
+#include <functional>
+#include <string>
+
+namespace scream {
+
+/*
+ * A read-only table of doubles, loaded once per node
+ *
+ * Lookup tables (e.g., the P3 ice table) are typically read by every rank,
+ * which at scale causes a storm of metadata requests on the parallel
+ * filesystem, and repeats the same (possibly expensive) parsing on every rank.
+ * This class makes one rank per node load the table, and share it with
+ * the other ranks on the node via an MPI-3 shared memory window.
+ *
+ * The node root loads the table as follows:
+ *  - if a cache directory is given, and it contains a valid binary cache file
+ *    for this table (same name, version, and size), read the table from it;
+ *  - otherwise, call the input reader, and, if a cache directory is given,
+ *    store the table in a binary cache file, so that later runs can skip
+ *    the reader altogether.
+ * The cache file is <cache_dir>/<name>.<version>.bin. It is written to a
+ * temporary file first, and then renamed, so that concurrent writers on
+ * different nodes cannot leave a partially written cache behind.
+ *
+ * The table is only meant to be used to initialize the actual data structures
+ * (e.g., to be deep copied to device views). Its memory is released when
+ * the object is destroyed, so users should not keep pointers to it around.
+ *
+ * NOTE: the constructor is collective on the input comm.
+ */
+
+class NodeSharedTable
+{
+public:
+  // Fill the input array (of the given size) with the table data
+  using reader_type = std::function<void(double* data, const long long size)>;
+
+  NodeSharedTable (const ekat::Comm& comm,
+                   const std::string& name,
+                   const std::string& version,
+                   const long long size,
+                   const reader_type& reader,
+                   const std::string& cache_dir = "");
+
+  ~NodeSharedTable ();
+
+  // Disallow copies, since we own the MPI window
+  NodeSharedTable (const NodeSharedTable&) = delete;
+  NodeSharedTable& operator= (const NodeSharedTable&) = delete;
+
+  const double* data () const { return m_data; }
+  long long size () const { return m_size; }
+
+  // Whether the node root got the table from the cache file (same on all ranks of the node)
+  bool loaded_from_cache () const { return m_loaded_from_cache; }
+
+  // The name of the cache file for the given table
+  static std::string cache_file_name (const std::string& cache_dir,
+                                      const std::string& name,
+                                      const std::string& version);
+
+protected:
+
+  // Everything in the constructor that comes after the node comm is created
+  void setup (const std::string& name,
+              const std::string& version,
+              const long long size,
+              const reader_type& reader,
+              const std::string& cache_dir);
+
+  // Safe to call on partially constructed objects, and more than once
+  void free_mpi_objects ();
+
+  bool read_cache (const std::string& filename, double* data) const;
+  void write_cache (const std::string& filename, const double* data) const;
+
+  std::string   m_name;
+  std::string   m_version;
+  long long     m_size;
+
+  MPI_Comm      m_node_comm = MPI_COMM_NULL;
+  MPI_Win       m_win       = MPI_WIN_NULL;
+  double*       m_data      = nullptr;
+
+  bool          m_loaded_from_cache = false;
+};
+
+} // namespace scream
+
+#endif // EAMXX_NODE_SHARED_TABLE_HPP
@@ -57,12 +57,9 @@ void TimeInterpolation::perform_time_interpolation(const TimeStamp& time_in)
     check_and_update_data(time_in);
   }
 
-  // Gather weights for interpolation.  Note, timestamp differences are integers and we need a
-  // real defined weight.
-  const Real w_num = m_time1 - time_in;
-  const Real w_den = m_time1 - m_time0;
-  const Real weight0 = w_num/w_den;
-  const Real weight1 = 1.0-weight0;
+  // Gather weights for interpolation.
+  Real weight0, weight1;
+  compute_weights(time_in,weight0,weight1);
 
   // Cycle through all stored fields and conduct the time interpolation
   for (auto name : m_field_names)
@@ -75,6 +72,35 @@ void TimeInterpolation::perform_time_interpolation(const TimeStamp& time_in)
   }
 }
 /*-----------------------------------------------------------------------------------------------*/
+/* Function to compute the time interpolation weights, such that
+ *        y* = weight0*y0 + weight1*y1
+ * Input:
+ *   time_in - A timestamp to interpolate onto.
+ */
+void TimeInterpolation::compute_weights(const TimeStamp& time_in, Real& weight0, Real& weight1) const
+{
+  // Note, timestamp differences are integers and we need a real defined weight.
+  const Real w_num = m_time1 - time_in;
+  const Real w_den = m_time1 - m_time0;
+  weight0 = w_num/w_den;
+  weight1 = 1.0-weight0;
+}
+/*-----------------------------------------------------------------------------------------------*/
+/* Function to load the data from file needed to interpolate at a given time, without actually
+ * performing the time interpolation. Useful for users that need to process the data at time0
+ * and time1 (e.g., remap it), and only want to do so when the data changes.
+ * Input:
+ *   time_in - A timestamp that we intend to interpolate onto.
+ * Output:
+ *   true if new data was loaded, false otherwise.
+ */
+bool TimeInterpolation::update_data(const TimeStamp& time_in)
+{
+  EKAT_REQUIRE_MSG (m_file_data_triplets.size()>0,
+      "Error! TimeInterpolation::update_data requires data from files.\n");
+  return check_and_update_data(time_in);
+}
+/*-----------------------------------------------------------------------------------------------*/
 /* Function which registers a field in the local field managers.
  * Input:
  *   field_in - Is a field with the appropriate dimensions and metadata to match the interpolation
@@ -387,8 +413,10 @@ void TimeInterpolation::read_data()
  * the interpolation data.
  * Input:
  *   ts_in - A timestamp that we intend to interpolate onto.
+ * Output:
+ *   true if new data was loaded, false otherwise.
  */
-void TimeInterpolation::check_and_update_data(const TimeStamp& ts_in)
+bool TimeInterpolation::check_and_update_data(const TimeStamp& ts_in)
 {
   // First check if the passed timestamp is within the bounds of time0 and time1.
   EKAT_REQUIRE_MSG(ts_in.seconds_from(m_time0) >= 0, "ERROR!!! TimeInterpolation::check_and_update_data - "
@@ -430,7 +458,9 @@ void TimeInterpolation::check_and_update_data(const TimeStamp& ts_in)
 		   <<  "      TimeStamp time0: " << m_time0.to_string() << "\n"
 		   <<  "      TimeStamp time1: " << m_time1.to_string() << "\n");
 
+    return true;
   }
+  return false;
 }
 /*-----------------------------------------------------------------------------------------------*/
 
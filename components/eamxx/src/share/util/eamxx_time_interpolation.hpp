@@ -34,6 +34,13 @@ public:
   void perform_time_interpolation(const TimeStamp& time_in);
   void finalize();
 
+  // Load data from file (if needed) so that time_in is within [time0,time1],
+  // without interpolating. Returns true if new data was loaded.
+  bool update_data(const TimeStamp& time_in);
+
+  // Weights w0,w1 such that the interpolated value at time_in is w0*y0 + w1*y1
+  void compute_weights(const TimeStamp& time_in, Real& weight0, Real& weight1) const;
+
   // Build interpolator
   void add_field(const Field& field_in, const bool store_shallow_copy=false);
 
@@ -42,6 +49,17 @@ public:
     return m_interp_fields.at(name);
   };
 
+  // The data at time0/time1. Note: the fields for time0/time1 may be swapped
+  // when new data is loaded, so do not store them across calls to update_data.
+  Field get_field_time0(const std::string& name) const {
+    return m_fm_time0->get_field(name);
+  }
+  Field get_field_time1(const std::string& name) const {
+    return m_fm_time1->get_field(name);
+  }
+  const TimeStamp& get_time0() const { return m_time0; }
+  const TimeStamp& get_time1() const { return m_time1; }
+
   // Informational
   void print();
 
@@ -74,7 +92,7 @@ protected:
   // For the case where forcing data comes from files
   void set_file_data_triplets(const vos_type& list_of_files);
   void read_data();
-  void check_and_update_data(const TimeStamp& ts_in);
+  bool check_and_update_data(const TimeStamp& ts_in);
 
   // Local field managers used to store two time snaps of data for interpolation
   fm_type  m_fm_time0;
@@ -1,9 +1,186 @@
 #include "share/util/scream_timing.hpp"
 
+#include <Kokkos_Core.hpp>
+
 #include <gptl.h>
 
+#include <ekat/ekat_assert.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace scream {
 
+namespace {
+bool kernel_callbacks_set = false;
+bool kernel_counting_enabled = false;
+std::int64_t kernel_count = 0;
+
+using clock_type = std::chrono::steady_clock;
+
+// ------------------- Wallclock tracking ------------------- //
+
+struct WallclockEntry {
+  double wall = 0;               // Accumulated time (in seconds)
+  clock_type::time_point start;  // Time of the last start
+};
+
+bool wallclock_tracking_enabled = false;
+
+// Entries are never erased, so pointers to them stay valid
+std::mutex wallclock_mutex;
+std::unordered_map<std::string,WallclockEntry> wallclock_entries;
+
+WallclockEntry& get_wallclock_entry (const std::string& name) {
+  std::lock_guard<std::mutex> lock(wallclock_mutex);
+  return wallclock_entries[name];
+}
+
+void wallclock_start (WallclockEntry& entry) {
+  entry.start = clock_type::now();
+}
+
+void wallclock_stop (WallclockEntry& entry) {
+  entry.wall += std::chrono::duration<double>(clock_type::now()-entry.start).count();
+}
+
+// ------------------- Timeline tracing ------------------- //
+
+struct TraceEvent {
+  std::int64_t t_ns;    // Time since tracing start (in ns)
+  int          name_id; // Index in the names of the thread buffer
+  char         phase;   // 'B' (begin) or 'E' (end)
+  bool         kernel;  // Whether this is a kokkos kernel or a timer
+};
+
+// Each thread only writes in its own buffer, so recording
+// events requires no locking nor atomics
+struct ThreadTrace {
+  int tid;
+  std::vector<TraceEvent> events;
+  std::uint64_t num_events = 0; // Total number of events recorded
+
+  std::unordered_map<std::string,int> name_ids;
+  std::vector<std::string>            names;
+
+  int get_name_id (const std::string& name) {
+    auto it = name_ids.find(name);
+    if (it!=name_ids.end()) {
+      return it->second;
+    }
+    names.push_back(name);
+    return name_ids[names.back()] = names.size()-1;
+  }
+};
+
+struct Tracer {
+  bool inited  = false;
+  bool enabled = false; // Can be false on inited tracers, if this rank is not traced
+  bool trace_kernels = false;
+  int  buffer_size = 0;
+  clock_type::time_point t0;
+
+  // Only used when a thread registers its buffer (the first time it records an event)
+  std::mutex mutex;
+  std::vector<std::unique_ptr<ThreadTrace>> threads;
+} tracer;
+
+ThreadTrace& get_thread_trace () {
+  thread_local ThreadTrace* tt = nullptr;
+  if (tt==nullptr) {
+    std::lock_guard<std::mutex> lock(tracer.mutex);
+    tracer.threads.emplace_back(new ThreadTrace());
+    tt = tracer.threads.back().get();
+    tt->tid = tracer.threads.size()-1;
+    tt->events.resize(tracer.buffer_size);
+  }
+  return *tt;
+}
+
+void record_event (ThreadTrace& tt, const int name_id, const char phase, const bool kernel) {
+  auto& e = tt.events[tt.num_events % tt.events.size()];
+  e.t_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now()-tracer.t0).count();
+  e.name_id = name_id;
+  e.phase = phase;
+  e.kernel = kernel;
+  ++tt.num_events;
+}
+
+void trace_timer (const std::string& name, const char phase) {
+  auto& tt = get_thread_trace();
+  record_event(tt,tt.get_name_id(name),phase,false);
+}
+
+// Same as above, but the name id is looked up only if not cached for this thread
+void trace_timer (const std::string& name, const void*& owner, int& name_id, const char phase) {
+  auto& tt = get_thread_trace();
+  if (owner!=&tt) {
+    name_id = tt.get_name_id(name);
+    owner = &tt;
+  }
+  record_event(tt,name_id,phase,false);
+}
+
+std::string json_escape (const std::string& s) {
+  std::string out;
+  for (char c : s) {
+    if (c=='"' or c=='\\') {
+      out += '\\';
+      out += c;
+    } else if (static_cast<unsigned char>(c)<0x20) {
+      out += ' ';
+    } else {
+      out += c;
+    }
+  }
+  return out;
+}
+
+// ------------------- Kokkos tools callbacks ------------------- //
+
+// Kernels are launched by the host thread, so no need for atomics
+void begin_kernel (const char* name, const uint32_t /* dev_id */, uint64_t* kernel_id) {
+  if (kernel_counting_enabled) {
+    ++kernel_count;
+  }
+  if (tracer.enabled and tracer.trace_kernels) {
+    auto& tt = get_thread_trace();
+    *kernel_id = tt.get_name_id(name);
+    record_event(tt,*kernel_id,'B',true);
+  }
+}
+
+void end_kernel (const uint64_t kernel_id) {
+  if (tracer.enabled and tracer.trace_kernels) {
+    record_event(get_thread_trace(),kernel_id,'E',true);
+  }
+}
+
+// Returns false if another tool already owns the callbacks
+bool set_kernel_callbacks () {
+  if (kernel_callbacks_set) {
+    return true;
+  }
+  if (Kokkos::Tools::profileLibraryLoaded()) {
+    return false;
+  }
+  using namespace Kokkos::Tools::Experimental;
+  set_begin_parallel_for_callback(begin_kernel);
+  set_begin_parallel_reduce_callback(begin_kernel);
+  set_begin_parallel_scan_callback(begin_kernel);
+  set_end_parallel_for_callback(end_kernel);
+  set_end_parallel_reduce_callback(end_kernel);
+  set_end_parallel_scan_callback(end_kernel);
+  kernel_callbacks_set = true;
+  return true;
+}
+} // anonymous namespace
+
 void init_gptl (bool& was_already_inited) {
 #ifdef SCREAM_CIME_BUILD
   was_already_inited = true;
@@ -18,14 +195,169 @@ void finalize_gptl () {
 
 void start_timer (const std::string& name) {
   GPTLstart(name.c_str());
+  if (tracer.enabled) {
+    trace_timer(name,'B');
+  }
+  if (wallclock_tracking_enabled) {
+    wallclock_start(get_wallclock_entry(name));
+  }
 }
 
 void stop_timer (const std::string& name) {
+  if (wallclock_tracking_enabled) {
+    wallclock_stop(get_wallclock_entry(name));
+  }
+  if (tracer.enabled) {
+    trace_timer(name,'E');
+  }
   GPTLstop(name.c_str());
 }
 
+void TimerHandle::set_name (const std::string& name) {
+  m_name = name;
+  m_gptl_handle = nullptr;
+  m_wall_entry  = nullptr;
+  m_trace_owner = nullptr;
+  m_trace_id    = -1;
+}
+
+void TimerHandle::start () {
+  GPTLstart_handle(m_name.c_str(),&m_gptl_handle);
+  if (tracer.enabled) {
+    trace_timer(m_name,m_trace_owner,m_trace_id,'B');
+  }
+  if (wallclock_tracking_enabled) {
+    // Tracking may be enabled after the handle is named, so resolve the entry lazily
+    if (m_wall_entry==nullptr) {
+      m_wall_entry = &get_wallclock_entry(m_name);
+    }
+    wallclock_start(*static_cast<WallclockEntry*>(m_wall_entry));
+  }
+}
+
+void TimerHandle::stop () {
+  if (wallclock_tracking_enabled and m_wall_entry!=nullptr) {
+    wallclock_stop(*static_cast<WallclockEntry*>(m_wall_entry));
+  }
+  if (tracer.enabled) {
+    trace_timer(m_name,m_trace_owner,m_trace_id,'E');
+  }
+  GPTLstop_handle(m_name.c_str(),&m_gptl_handle);
+}
+
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname) {
   GPTLpr_summary_file (comm.mpi_comm(),fname.c_str());
 }
 
+void enable_timer_wallclock_tracking () {
+  wallclock_tracking_enabled = true;
+}
+
+bool is_timer_wallclock_tracking_enabled () {
+  return wallclock_tracking_enabled;
+}
+
+double get_timer_wallclock (const std::string& name) {
+  if (wallclock_tracking_enabled) {
+    std::lock_guard<std::mutex> lock(wallclock_mutex);
+    auto it = wallclock_entries.find(name);
+    return it==wallclock_entries.end() ? 0 : it->second.wall;
+  }
+
+  double value;
+  if (GPTLget_wallclock(name.c_str(),-1,&value)!=0) {
+    return 0;
+  }
+  return value;
+}
+
+void enable_kernel_counting () {
+  if (kernel_counting_enabled) {
+    return;
+  }
+  kernel_counting_enabled = set_kernel_callbacks();
+}
+
+std::int64_t get_kernel_count () {
+  return kernel_count;
+}
+
+void enable_timeline_tracing (const ekat::Comm& comm,
+                              const int buffer_size,
+                              const int rank_stride,
+                              const bool trace_kernels)
+{
+  EKAT_REQUIRE_MSG (buffer_size>0,
+      "Error! Invalid timeline trace buffer size.\n"
+      "  - buffer size: " + std::to_string(buffer_size) + "\n");
+  EKAT_REQUIRE_MSG (rank_stride>0,
+      "Error! Invalid timeline trace rank stride.\n"
+      "  - rank stride: " + std::to_string(rank_stride) + "\n");
+  if (tracer.inited) {
+    return;
+  }
+
+  // Align the time origin of all ranks
+  comm.barrier();
+  tracer.inited = true;
+  tracer.t0 = clock_type::now();
+  tracer.buffer_size = buffer_size;
+  tracer.enabled = comm.rank() % rank_stride == 0;
+  tracer.trace_kernels = trace_kernels and set_kernel_callbacks();
+
+  // If tracing was enabled before, threads already have a buffer. We cannot
+  // free them (threads keep a pointer to their own), so just reset them.
+  std::lock_guard<std::mutex> lock(tracer.mutex);
+  for (auto& tt : tracer.threads) {
+    tt->events.assign(buffer_size,TraceEvent());
+    tt->num_events = 0;
+  }
+}
+
+void disable_timeline_tracing () {
+  tracer.inited = false;
+  tracer.enabled = false;
+  tracer.trace_kernels = false;
+}
+
+bool is_timeline_tracing_enabled () {
+  return tracer.enabled;
+}
+
+void write_timeline_trace (const ekat::Comm& comm, const std::string& fname_prefix) {
+  if (not tracer.enabled) {
+    return;
+  }
+
+  const int pid = comm.rank();
+  std::ofstream ofile (fname_prefix + ".rank" + std::to_string(pid) + ".json");
+  EKAT_REQUIRE_MSG (ofile.good(),
+      "Error! Could not open timeline trace file.\n"
+      "  - file name prefix: " + fname_prefix + "\n");
+
+  std::uint64_t num_dropped = 0;
+  ofile << "{\"traceEvents\":[\n";
+  ofile << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+        << ",\"args\":{\"name\":\"rank " << pid << "\"}}";
+
+  std::lock_guard<std::mutex> lock(tracer.mutex);
+  for (const auto& tt : tracer.threads) {
+    // If the ring buffer wrapped around, the oldest event is at num_events % size
+    const std::uint64_t size = tt->events.size();
+    const std::uint64_t n = std::min(tt->num_events,size);
+    const std::uint64_t first = tt->num_events - n;
+    num_dropped += first;
+    for (std::uint64_t i=first; i<tt->num_events; ++i) {
+      const auto& e = tt->events[i % size];
+      ofile << ",\n{\"name\":\"" << json_escape(tt->names[e.name_id]) << "\""
+            << ",\"cat\":\"" << (e.kernel ? "kernel" : "timer") << "\""
+            << ",\"ph\":\"" << e.phase << "\""
+            << ",\"ts\":" << e.t_ns / 1000 << "." << (e.t_ns % 1000) / 100
+            << ",\"pid\":" << pid << ",\"tid\":" << tt->tid << "}";
+    }
+  }
+  ofile << "\n],\n\"displayTimeUnit\":\"ms\",\n"
+        << "\"otherData\":{\"dropped_events\":" << num_dropped << "}}\n";
+}
+
 } // namespace scream
@@ -3,6 +3,7 @@
 
 #include <ekat/mpi/ekat_comm.hpp>
 
+#include <cstdint>
 #include <string>
 
 namespace scream {
@@ -17,6 +18,96 @@ void stop_timer (const std::string& name);
 
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname);
 
+// Accumulate the wall time of timers in EAMxx, next to GPTL. GPTL prepends its
+// current prefix (e.g., "a:" during the CIME run phase) to the names of the timers,
+// and there is no way to query the prefix, so querying GPTL by the name used
+// in the code gives nothing. Once tracking is enabled, get_timer_wallclock
+// returns the time accumulated since then, regardless of any GPTL prefix.
+void enable_timer_wallclock_tracking ();
+bool is_timer_wallclock_tracking_enabled ();
+
+// Accumulated wall time (in seconds) of a timer on this rank (and thread).
+// If tracking is enabled, returns the time tracked by EAMxx, and otherwise
+// queries GPTL. Returns 0 if the timer does not exist (or GPTL is not initialized).
+double get_timer_wallclock (const std::string& name);
+
+// A timer that resolves its name only once. start_timer/stop_timer look up
+// the timer by name (hashing the string) at every call, which is noticeable
+// for timers called many times per step. A TimerHandle caches the GPTL timer
+// entry (and the timeline trace name id) on its first use, so later calls
+// do no lookup at all. Typical use is to store handles as class members,
+// and use ScopedTimer in the hot path.
+// NOTE: like GPTL handles, a TimerHandle must always be used by the same
+//       thread. If a GPTL prefix is set (as in CIME runs), GPTL caches the
+//       entry of the prefixed name, and looks it up again if the prefix changes.
+class TimerHandle {
+public:
+  TimerHandle () = default;
+  explicit TimerHandle (const std::string& name) { set_name(name); }
+
+  // Also resets the cached entries
+  void set_name (const std::string& name);
+  const std::string& name () const { return m_name; }
+  bool has_name () const { return not m_name.empty(); }
+
+  void start ();
+  void stop ();
+
+private:
+  std::string m_name;
+
+  void*       m_gptl_handle = nullptr;
+  void*       m_wall_entry  = nullptr; // The wallclock tracking entry
+  const void* m_trace_owner = nullptr; // The thread trace the id refers to
+  int         m_trace_id    = -1;
+};
+
+// Starts the timer on construction and stops it on destruction
+class ScopedTimer {
+public:
+  explicit ScopedTimer (TimerHandle& timer) : m_timer(timer) { m_timer.start(); }
+  ~ScopedTimer () { m_timer.stop(); }
+
+  ScopedTimer (const ScopedTimer&) = delete;
+  ScopedTimer& operator= (const ScopedTimer&) = delete;
+
+private:
+  TimerHandle& m_timer;
+};
+
+// Count kokkos kernels (parallel_for/reduce/scan) launched by this process,
+// by registering Kokkos Tools callbacks. If a Kokkos tool library is already
+// loaded (e.g., via KOKKOS_TOOLS_LIBS), we do not override its callbacks,
+// and the kernel count will stay at 0.
+// NOTE: must be called after Kokkos is initialized.
+void enable_kernel_counting ();
+std::int64_t get_kernel_count ();
+
+// Timeline tracing: records begin/end events of start_timer/stop_timer calls
+// (and, optionally, of kokkos kernels) in a per-thread ring buffer, which is
+// then written in the Chrome trace JSON format (viewable in chrome://tracing
+// or https://ui.perfetto.dev). Unlike GPTL summaries, this shows when things
+// happen, so one can spot overlaps, stalls, and imbalance across ranks.
+//  - buffer_size: max number of events kept per thread (oldest are overwritten)
+//  - rank_stride: only ranks that are multiple of rank_stride record events
+//  - trace_kernels: record kokkos kernels too (same caveat as kernel counting).
+//    NOTE: on GPU, kernel end events mark the end of the (async) launch,
+//          unless CUDA_LAUNCH_BLOCKING=1 (or similar) is set.
+// The begin time is synchronized across ranks with a barrier, so all ranks
+// must call this function (calls after the first one are no-ops, until
+// disable_timeline_tracing is called). write_timeline_trace writes one file
+// per traced rank, named <fname_prefix>.rank<N>.json, which can be combined
+// with the merge-chrome-traces script.
+void enable_timeline_tracing (const ekat::Comm& comm,
+                              const int buffer_size,
+                              const int rank_stride = 1,
+                              const bool trace_kernels = false);
+// Stops recording events. Events recorded so far are discarded
+// at the next call to enable_timeline_tracing.
+void disable_timeline_tracing ();
+bool is_timeline_tracing_enabled ();
+void write_timeline_trace (const ekat::Comm& comm, const std::string& fname_prefix);
+
 } // namespace scream
 
 #endif // SCREAM_TIMING_HPP
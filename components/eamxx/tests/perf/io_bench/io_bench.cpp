@@ -0,0 +1,497 @@
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/util/scream_timing.hpp"
+#include "share/scream_session.hpp"
+
+// EKAT headers
+#include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+/*
+ * A throughput benchmark for the output stack.
+ *
+ * For each combination of number of columns, number of levels, number of
+ * fields, averaging type, precision, and remap, we create a point grid and a
+ * field manager with synthetic (COL,LEV) fields, and we run an OutputManager
+ * stream writing all the fields for a few steps. We then report the time spent
+ * in each phase of the output (accumulation, remap, copy to host, PIO write,
+ * file setup, and file close), together with the bandwidth, computed as the
+ * bytes of field data written divided by the total output time.
+ *
+ * The phase times are the deltas of the IO timers over the run, maxed over all
+ * ranks. On GPU, kernels are asynchronous, so part of the accumulate/remap time
+ * may be charged to the host copy.
+ *
+ * Scaling over MPI ranks is obtained by running the benchmark on different
+ * numbers of ranks. With scaling=strong, ncols is the global number of columns,
+ * while with scaling=weak it is the number of columns per rank. The number of
+ * ranks is reported in the JSON config, so that results of different runs can
+ * be put side by side.
+ */
+
+namespace {
+
+using namespace scream;
+using namespace ShortFieldTagsNames;
+
+using gid_type = AbstractGrid::gid_type;
+
+struct BenchCase {
+  int         ncols;     // Global number of columns
+  int         nlevs;
+  int         nfields;
+  std::string avg_type;
+  std::string precision;
+  std::string remap;     // none, horiz, vert, or horiz_vert
+};
+
+struct BenchResult {
+  BenchCase   bench_case;
+  int         nwrites;
+  double      bytes;     // Bytes of field data written (all ranks)
+  std::vector<std::pair<std::string,double>> phases; // Max over ranks [s]
+  double      bandwidth; // [GB/s]
+};
+
+// The timers of each phase (see OutputManager and AtmosphereOutput).
+// The "close" phase is timed here, around OutputManager::finalize.
+const std::vector<std::pair<std::string,std::string>>& get_phase_timers () {
+  static const std::vector<std::pair<std::string,std::string>> timers = {
+    {"accumulate",        "EAMxx::IO::accumulate"},
+    {"vert_remap",        "EAMxx::IO::vert_remap"},
+    {"horiz_remap",       "EAMxx::IO::horiz_remap"},
+    {"host_copy",         "EAMxx::IO::host_copy"},
+    {"write",             "EAMxx::IO::write"},
+    {"file_setup",        "EAMxx::IO::standard::get_new_file"},
+    {"snapshot_finalize", "EAMxx::IO::standard::update_snapshot_tally"},
+    {"run",               "EAMxx::IO::standard"}
+  };
+  return timers;
+}
+
+std::shared_ptr<FieldManager>
+create_fm (const std::shared_ptr<const AbstractGrid>& grid,
+           const int nfields, const util::TimeStamp& t0)
+{
+  using namespace ekat::units;
+
+  const int nlcols = grid->get_num_local_dofs();
+  const int nlevs  = grid->get_num_vertical_levels();
+  const auto& gn = grid->name();
+
+  const FieldLayout lay_mid ({COL,LEV},{nlcols,nlevs});
+  const FieldLayout lay_int ({COL,ILEV},{nlcols,nlevs+1});
+
+  auto fm = std::make_shared<FieldManager>(grid);
+  fm->registration_begins();
+  fm->register_field(FieldRequest(FieldIdentifier("p_mid",lay_mid,Pa,gn),"output",SCREAM_PACK_SIZE));
+  fm->register_field(FieldRequest(FieldIdentifier("p_int",lay_int,Pa,gn),"output",SCREAM_PACK_SIZE));
+  for (int n=0; n<nfields; ++n) {
+    FieldIdentifier fid("field_"+std::to_string(n),lay_mid,Units::nondimensional(),gn);
+    fm->register_field(FieldRequest(fid,"output",SCREAM_PACK_SIZE));
+  }
+  fm->registration_ends();
+
+  // Pressure goes from 100 Pa at the top to 1e5 Pa at the surface,
+  // so that vertical remap always has valid (non masked) values
+  auto gids = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  auto p_mid = fm->get_field("p_mid").get_view<Real**,Host>();
+  auto p_int = fm->get_field("p_int").get_view<Real**,Host>();
+  const Real p_top = 100, p_bot = 1e5;
+  for (int i=0; i<nlcols; ++i) {
+    for (int k=0; k<=nlevs; ++k) {
+      p_int(i,k) = p_top + (p_bot-p_top)*k/nlevs;
+    }
+    for (int k=0; k<nlevs; ++k) {
+      p_mid(i,k) = (p_int(i,k)+p_int(i,k+1))/2;
+    }
+  }
+  for (int n=0; n<nfields; ++n) {
+    auto f = fm->get_field("field_"+std::to_string(n));
+    auto v = f.get_view<Real**,Host>();
+    for (int i=0; i<nlcols; ++i) {
+      for (int k=0; k<nlevs; ++k) {
+        v(i,k) = n + gids(i) + Real(k)/nlevs;
+      }
+    }
+  }
+  for (auto it : *fm) {
+    it.second->sync_to_dev();
+  }
+  fm->init_fields_time_stamp(t0);
+
+  return fm;
+}
+
+// The horizontal map averages 'factor' consecutive columns, while the
+// vertical one goes to 'nlevs_tgt' equally spaced pressure levels
+void create_remap_file (const std::string& filename,
+                        const ekat::Comm& comm,
+                        const int ngcols, const int factor,
+                        const int nlevs_tgt)
+{
+  EKAT_REQUIRE_MSG (factor>0 and ngcols%factor==0,
+      "Error! The number of columns must be a multiple of the coarsening factor.\n"
+      "  - ncols: " + std::to_string(ngcols) + "\n"
+      "  - coarsening_factor: " + std::to_string(factor) + "\n");
+
+  // Each rank writes a contiguous chunk of the triplets
+  const int nranks = comm.size();
+  const int offset = (static_cast<long long>(ngcols)*comm.rank())/nranks;
+  const int count  = (static_cast<long long>(ngcols)*(comm.rank()+1))/nranks - offset;
+  std::vector<int> row(count), col(count);
+  std::vector<Real> S(count,Real(1)/factor);
+  for (int i=0; i<count; ++i) {
+    col[i] = 1 + offset + i;
+    row[i] = 1 + (offset + i)/factor;
+  }
+
+  std::vector<Real> p_levs(nlevs_tgt);
+  for (int k=0; k<nlevs_tgt; ++k) {
+    p_levs[k] = 1000 + (9e4-1000)*k/std::max(nlevs_tgt-1,1);
+  }
+
+  scorpio::register_file(filename,scorpio::FileMode::Write);
+  scorpio::define_dim(filename,"n_a",ngcols);
+  scorpio::define_dim(filename,"n_b",ngcols/factor);
+  scorpio::define_dim(filename,"n_s",ngcols);
+  scorpio::define_dim(filename,"lev",nlevs_tgt);
+
+  scorpio::define_var(filename,"col",   {"n_s"},"int");
+  scorpio::define_var(filename,"row",   {"n_s"},"int");
+  scorpio::define_var(filename,"S",     {"n_s"},"real");
+  scorpio::define_var(filename,"p_levs",{"lev"},"real");
+
+  scorpio::set_dim_decomp(filename,"n_s",offset,count);
+  scorpio::enddef(filename);
+
+  scorpio::write_var(filename,"row",   row.data());
+  scorpio::write_var(filename,"col",   col.data());
+  scorpio::write_var(filename,"S",     S.data());
+  scorpio::write_var(filename,"p_levs",p_levs.data());
+
+  scorpio::release_file(filename);
+}
+
+BenchResult run_case (const ekat::Comm& comm,
+                      ekat::ParameterList& bench_pl,
+                      const BenchCase& bc,
+                      const int case_idx)
+{
+  const int nsteps = bench_pl.get<int>("num_steps",12);
+  const int freq   = bench_pl.get<int>("output_frequency",3);
+  const int max_snaps = bench_pl.get<int>("max_snapshots_per_file",4);
+  const int factor = bench_pl.get<int>("coarsening_factor",2);
+  const int nlevs_tgt = bench_pl.get<int>("vert_remap_nlevs",32);
+  const auto out_dir = bench_pl.get<std::string>("output_dir",".");
+  const int dt = 300;
+
+  EKAT_REQUIRE_MSG (bc.remap=="none" or bc.remap=="horiz" or bc.remap=="vert" or bc.remap=="horiz_vert",
+      "Error! Invalid remap for io bench.\n"
+      "  - remap: " + bc.remap + "\n"
+      "  - valid values: none, horiz, vert, horiz_vert\n");
+  const bool horiz = bc.remap=="horiz" or bc.remap=="horiz_vert";
+  const bool vert  = bc.remap=="vert"  or bc.remap=="horiz_vert";
+
+  util::TimeStamp t0 ({2000,1,1},{0,0,0});
+
+  auto gm = create_mesh_free_grids_manager(comm,0,0,bc.nlevs,bc.ncols);
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+  auto fm = create_fm(grid,bc.nfields,t0);
+
+  const auto case_name = "io_bench_case" + std::to_string(case_idx) + "_np" + std::to_string(comm.size());
+  const auto remap_file = out_dir + "/" + case_name + ".remap.nc";
+  if (horiz or vert) {
+    create_remap_file(remap_file,comm,bc.ncols,horiz ? factor : 1,nlevs_tgt);
+  }
+
+  std::vector<std::string> fnames;
+  for (int n=0; n<bc.nfields; ++n) {
+    fnames.push_back("field_"+std::to_string(n));
+  }
+
+  ekat::ParameterList om_pl(case_name);
+  om_pl.set<std::string>("filename_prefix",out_dir + "/" + case_name);
+  om_pl.set<std::string>("Averaging Type",bc.avg_type);
+  om_pl.set<std::string>("Floating Point Precision",bc.precision);
+  om_pl.set<int>("Max Snapshots Per File",max_snaps);
+  om_pl.set("Field Names",fnames);
+  if (horiz) {
+    om_pl.set<std::string>("horiz_remap_file",remap_file);
+  }
+  if (vert) {
+    om_pl.set<std::string>("vertical_remap_file",remap_file);
+  }
+  auto& ctrl_pl = om_pl.sublist("output_control");
+  ctrl_pl.set<std::string>("frequency_units","nsteps");
+  ctrl_pl.set("Frequency",freq);
+  ctrl_pl.set("save_grid_data",false);
+  ctrl_pl.set("skip_t0_output",true);
+
+  OutputManager om;
+  om.setup(comm,om_pl,fm,gm,t0,t0,false);
+
+  // Timers accumulate over cases, so we look at their deltas
+  const auto& timers = get_phase_timers();
+  std::vector<double> start(timers.size());
+  for (size_t i=0; i<timers.size(); ++i) {
+    start[i] = get_timer_wallclock(timers[i].second);
+  }
+
+  comm.barrier();
+  auto t = t0;
+  for (int n=0; n<nsteps; ++n) {
+    om.init_timestep(t,dt);
+    t += dt;
+    for (auto it : *fm) {
+      it.second->get_header().get_tracking().update_time_stamp(t);
+    }
+    om.run(t);
+  }
+  auto close_start = std::chrono::steady_clock::now();
+  om.finalize();
+  auto close_finish = std::chrono::steady_clock::now();
+
+  std::vector<double> my_times (timers.size()+1), times (timers.size()+1);
+  for (size_t i=0; i<timers.size(); ++i) {
+    my_times[i] = get_timer_wallclock(timers[i].second) - start[i];
+  }
+  my_times.back() = std::chrono::duration<double>(close_finish-close_start).count();
+  comm.all_reduce(my_times.data(),times.data(),times.size(),MPI_MAX);
+
+  BenchResult res;
+  res.bench_case = bc;
+  for (size_t i=0; i<timers.size(); ++i) {
+    res.phases.emplace_back(timers[i].first,times[i]);
+  }
+  res.phases.emplace_back("close",times.back());
+
+  // Only count the fields payload (not time, avg count, or other metadata)
+  const int ncols_out = horiz ? bc.ncols/factor : bc.ncols;
+  const int nlevs_out = vert ? nlevs_tgt : bc.nlevs;
+  const int data_size = bc.precision=="single" ? sizeof(float)
+                      : bc.precision=="double" ? sizeof(double) : sizeof(Real);
+  res.nwrites = nsteps / freq;
+  res.bytes = static_cast<double>(data_size)*ncols_out*nlevs_out*bc.nfields*res.nwrites;
+  const double total = times[timers.size()-1] + times.back();
+  res.bandwidth = total>0 ? res.bytes/total/1e9 : 0;
+
+  return res;
+}
+
+void write_json (const std::string& filename,
+                 const ekat::Comm& comm,
+                 ekat::ParameterList& bench_pl,
+                 const std::vector<BenchResult>& results)
+{
+  std::ofstream ofs (filename);
+  EKAT_REQUIRE_MSG (ofs.good(),
+      "Error! Could not open file for io bench results.\n"
+      " - filename: " + filename + "\n");
+
+  ofs << std::setprecision(8);
+  ofs << "{\n"
+      << "  \"config\": {\n"
+      << "    \"exec_space\": \"" << Kokkos::DefaultExecutionSpace::name() << "\",\n"
+      << "    \"precision\": \"" << (sizeof(Real)==8 ? "double" : "single") << "\",\n"
+      << "    \"pack_size\": " << SCREAM_PACK_SIZE << ",\n"
+      << "    \"num_ranks\": " << comm.size() << ",\n"
+      << "    \"scaling\": \"" << bench_pl.get<std::string>("scaling","weak") << "\",\n"
+      << "    \"num_steps\": " << bench_pl.get<int>("num_steps",12) << ",\n"
+      << "    \"output_frequency\": " << bench_pl.get<int>("output_frequency",3) << ",\n"
+      << "    \"max_snapshots_per_file\": " << bench_pl.get<int>("max_snapshots_per_file",4) << ",\n"
+      << "    \"coarsening_factor\": " << bench_pl.get<int>("coarsening_factor",2) << ",\n"
+      << "    \"vert_remap_nlevs\": " << bench_pl.get<int>("vert_remap_nlevs",32) << "\n"
+      << "  },\n"
+      << "  \"results\": [";
+  for (size_t i=0; i<results.size(); ++i) {
+    const auto& r = results[i];
+    const auto& bc = r.bench_case;
+    ofs << (i==0 ? "\n" : ",\n")
+        << "    {"
+        << "\"ncols\": " << bc.ncols << ", "
+        << "\"nlevs\": " << bc.nlevs << ", "
+        << "\"nfields\": " << bc.nfields << ", "
+        << "\"avg_type\": \"" << bc.avg_type << "\", "
+        << "\"fp_precision\": \"" << bc.precision << "\", "
+        << "\"remap\": \"" << bc.remap << "\", "
+        << "\"nwrites\": " << r.nwrites << ", "
+        << "\"bytes\": " << r.bytes << ", "
+        << "\"bandwidth\": " << r.bandwidth << ", "
+        << "\"phases\": {";
+    for (size_t p=0; p<r.phases.size(); ++p) {
+      ofs << (p==0 ? "" : ", ") << "\"" << r.phases[p].first << "\": " << r.phases[p].second;
+    }
+    ofs << "}}";
+  }
+  ofs << "\n  ]\n}\n";
+}
+
+template<typename T>
+std::vector<T> parse_list (const std::string& s) {
+  std::vector<T> v;
+  std::istringstream is(s);
+  std::string item;
+  while (std::getline(is,item,',')) {
+    std::istringstream item_is(item);
+    T val;
+    item_is >> val;
+    v.push_back(val);
+  }
+  return v;
+}
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+} // anonymous namespace
+
+int main (int argc, char** argv) {
+  using namespace scream;
+
+  if (argc == 1) {
+    std::cout <<
+      argv[0] << " [options]\n"
+      "Options:\n"
+      "  -i <file>           Input yaml file. Default=io_bench.yaml.\n"
+      "  -o <file>           Output json file. Default from input file.\n"
+      "  -c <n1,n2,...>      Number of columns (global or per rank, see -x). Default from input file.\n"
+      "  -x <strong|weak>    Scaling mode. Default from input file.\n"
+      "  -k <n1,n2,...>      Number of vertical levels. Default from input file.\n"
+      "  -f <n1,n2,...>      Number of output fields. Default from input file.\n"
+      "  -a <a1,a2,...>      Averaging types. Default from input file.\n"
+      "  -p <p1,p2,...>      Output precisions (single, double). Default from input file.\n"
+      "  -r <r1,r2,...>      Remaps (none, horiz, vert, horiz_vert). Default from input file.\n"
+      "  -s <steps>          Number of steps. Default from input file.\n"
+      "  -d <dir>            Directory for output files. Default from input file.\n";
+    return 1;
+  }
+
+  std::string input_file = "io_bench.yaml";
+  std::string output_file, ncols, scaling, nlevs, nfields, avg_types, precisions, remaps, steps, out_dir;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-i", "--input-file")) {
+      expect_another_arg(i, argc);
+      input_file = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-o", "--output-file")) {
+      expect_another_arg(i, argc);
+      output_file = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-c", "--ncols")) {
+      expect_another_arg(i, argc);
+      ncols = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-x", "--scaling")) {
+      expect_another_arg(i, argc);
+      scaling = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-k", "--nlevs")) {
+      expect_another_arg(i, argc);
+      nlevs = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-f", "--num-fields")) {
+      expect_another_arg(i, argc);
+      nfields = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-a", "--averaging-types")) {
+      expect_another_arg(i, argc);
+      avg_types = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-p", "--precisions")) {
+      expect_another_arg(i, argc);
+      precisions = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-r", "--remaps")) {
+      expect_another_arg(i, argc);
+      remaps = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-s", "--steps")) {
+      expect_another_arg(i, argc);
+      steps = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-d", "--output-dir")) {
+      expect_another_arg(i, argc);
+      out_dir = argv[++i];
+    }
+  }
+
+  int nerr = 0;
+  MPI_Init(&argc,&argv);
+  scream::initialize_scream_session(argc,argv); {
+    ekat::Comm comm (MPI_COMM_WORLD);
+
+    ekat::ParameterList bench_params("IO Bench");
+    parse_yaml_file(input_file,bench_params);
+
+    // Command line args override the input file
+    auto& bench_pl = bench_params.sublist("io_bench");
+    if (output_file!="") bench_pl.set("output_file",output_file);
+    if (ncols!="")       bench_pl.set("ncols",parse_list<int>(ncols));
+    if (scaling!="")     bench_pl.set("scaling",scaling);
+    if (nlevs!="")       bench_pl.set("nlevs",parse_list<int>(nlevs));
+    if (nfields!="")     bench_pl.set("num_fields",parse_list<int>(nfields));
+    if (avg_types!="")   bench_pl.set("averaging_types",parse_list<std::string>(avg_types));
+    if (precisions!="")  bench_pl.set("precisions",parse_list<std::string>(precisions));
+    if (remaps!="")      bench_pl.set("remaps",parse_list<std::string>(remaps));
+    if (steps!="")       bench_pl.set("num_steps",std::stoi(steps));
+    if (out_dir!="")     bench_pl.set("output_dir",out_dir);
+
+    bool gptl_was_inited;
+    init_gptl(gptl_was_inited);
+    scorpio::init_subsystem(comm);
+
+    std::vector<BenchResult> results;
+    try {
+      const auto scale = bench_pl.get<std::string>("scaling","weak");
+      EKAT_REQUIRE_MSG (scale=="strong" or scale=="weak",
+          "Error! Invalid scaling mode for io bench.\n"
+          "  - scaling: " + scale + "\n"
+          "  - valid values: strong, weak\n");
+      int case_idx = 0;
+      for (const auto ncol : bench_pl.get<std::vector<int>>("ncols")) {
+        for (const auto nlev : bench_pl.get<std::vector<int>>("nlevs")) {
+          for (const auto nf : bench_pl.get<std::vector<int>>("num_fields")) {
+            for (const auto& avg : bench_pl.get<std::vector<std::string>>("averaging_types")) {
+              for (const auto& prec : bench_pl.get<std::vector<std::string>>("precisions")) {
+                for (const auto& remap : bench_pl.get<std::vector<std::string>>("remaps")) {
+                  const int ngcols = scale=="weak" ? ncol*comm.size() : ncol;
+                  BenchCase bc {ngcols,nlev,nf,avg,prec,remap};
+                  results.push_back(run_case(comm,bench_pl,bc,case_idx++));
+                  const auto& r = results.back();
+                  if (comm.am_i_root()) {
+                    printf("  ncols=%-8d nlevs=%-4d nfields=%-4d %-8s %-6s remap=%-10s GB/s=%-10.4g",
+                           bc.ncols,bc.nlevs,bc.nfields,bc.avg_type.c_str(),bc.precision.c_str(),
+                           bc.remap.c_str(),r.bandwidth);
+                    for (const auto& p : r.phases) {
+                      printf(" %s=%.3g",p.first.c_str(),p.second);
+                    }
+                    printf("\n");
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+
+      const auto out_file = bench_pl.get<std::string>("output_file","io_bench.json");
+      if (comm.am_i_root()) {
+        write_json(out_file,comm,bench_pl,results);
+        printf("IO bench results written to %s\n",out_file.c_str());
+      }
+    } catch (std::exception& e) {
+      printf("[rank %d] io_bench failed:\n%s\n",comm.rank(),e.what());
+      nerr = 1;
+    }
+
+    scorpio::finalize_subsystem();
+    if (not gptl_was_inited) {
+      finalize_gptl();
+    }
+  } scream::finalize_scream_session();
+  MPI_Finalize();
+
+  return nerr;
+}
@@ -0,0 +1,620 @@
+// The AD
+#include "control/atmosphere_driver.hpp"
+
+// Physics/diagnostic includes
+#include "physics/register_physics.hpp"
+#include "physics/share/physics_constants.hpp"
+#include "diagnostics/register_diagnostics.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/grid/point_grid.hpp"
+#include "share/io/scorpio_input.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+#include "share/scream_session.hpp"
+
+// EKAT headers
+#include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <set>
+#include <sstream>
+
+/*
+ * A throughput benchmark for column physics.
+ *
+ * For each combination of process, number of columns, and number of levels,
+ * we build an atmosphere driver running only that process on a point grid,
+ * fill all its inputs, run a few warmup steps, and then time a few more steps
+ * via the per-process perf counters (see AtmosphereProcess::PerfReport).
+ * The inputs are either synthetic (plausible profiles, perturbed from column
+ * to column), or recorded (read from an ensemble file, and tiled over the
+ * columns). Results are written as JSON, and can be compared against a stored
+ * baseline with scripts/compare-physics-bench.
+ *
+ * The pack size is a compile-time option, so it cannot be swept at runtime.
+ * It is reported in the JSON config, so that the output of builds with
+ * different SCREAM_PACK_SIZE values can be compared.
+ */
+
+namespace {
+
+using namespace scream;
+using namespace scream::control;
+using namespace ShortFieldTagsNames;
+
+using gid_type = AbstractGrid::gid_type;
+using PC = scream::physics::Constants<Real>;
+
+struct BenchResult {
+  std::string process;
+  int         ncols;             // Global number of columns
+  int         nlevs;
+  long long   nsteps;
+  double      time_per_step;     // [s]
+  double      cols_per_sec;
+  double      bytes_per_col;
+  double      kernels_per_step;
+  double      bandwidth;         // [GB/s]
+};
+
+// A cheap hash of the column gid in [0,1), to perturb profiles across columns
+Real col_noise (const gid_type gid) {
+  unsigned long long h = static_cast<unsigned long long>(gid)*0x9E3779B97F4A7C15ull + 0x632BE59BD9B4E5ull;
+  h ^= h >> 31;
+  h *= 0xBF58476D1CE4E5B9ull;
+  h ^= h >> 29;
+  return static_cast<Real>(h % 10000) / 10000;
+}
+
+// Hybrid coefficients at interfaces, going from pure pressure at the
+// model top to terrain-following at the surface
+void compute_hybrid_coeffs (const int nlevs, std::vector<Real>& hyai, std::vector<Real>& hybi) {
+  const Real eta_top = 225 / PC::P0;
+  hyai.resize(nlevs+1);
+  hybi.resize(nlevs+1);
+  for (int k=0; k<=nlevs; ++k) {
+    const Real eta = eta_top + (1-eta_top)*k/nlevs;
+    const Real s = (eta-eta_top) / (1-eta_top);
+    hybi[k] = s*s;
+    hyai[k] = eta - hybi[k];
+  }
+}
+
+// Give the grid a synthetic geometry
+void set_synthetic_geometry (const std::shared_ptr<AbstractGrid>& grid) {
+  const int nlevs = grid->get_num_vertical_levels();
+  const int ngcols = grid->get_num_global_dofs();
+  const auto gids = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+
+  // The geometry created by the grids manager is read-only, but the processes
+  // have not used it yet, so it's safe to set its values now.
+  auto set_geo = [&](const std::string& name, const std::function<Real(int)>& value) {
+    auto geo = grid->get_geometry_data(name);
+    auto data = geo.get_internal_view_data_unsafe<Real,Host>();
+    const int n = geo.get_header().get_identifier().get_layout().size();
+    for (int i=0; i<n; ++i) {
+      data[i] = value(i);
+    }
+    geo.sync_to_dev();
+  };
+
+  std::vector<Real> hyai, hybi;
+  compute_hybrid_coeffs(nlevs,hyai,hybi);
+
+  // Spread the columns evenly in latitude, and use a fake longitude
+  set_geo("lat", [&](int i) { return -90 + 180*(gids(i)+0.5)/ngcols; });
+  set_geo("lon", [&](int i) { return std::fmod(137.5*gids(i),360.0); });
+  set_geo("hyam",[&](int k) { return (hyai[k]+hyai[k+1])/2; });
+  set_geo("hybm",[&](int k) { return (hybi[k]+hybi[k+1])/2; });
+
+  // SHOC needs the cell area. Use a uniform grid on the unit sphere.
+  if (not grid->has_geometry_data("area")) {
+    auto area = grid->create_geometry_data("area",grid->get_2d_scalar_layout(),
+                                           ekat::units::Units::nondimensional());
+    area.deep_copy(4*PC::Pi/ngcols);
+  }
+}
+
+// A plausible value for the input field with the given name.
+//  - p: the pressure at the field location (ps for 2d fields)
+//  - dp: the layer thickness (only meaningful for midpoint fields)
+//  - cmp: the index of the (non-level) component, if any
+Real synthetic_value (const std::string& name, const Real ps, const Real p,
+                      const Real dp, const Real noise, const int cmp)
+{
+  const Real sigma = p / ps;
+  const bool liq_cloud = sigma>0.7 and sigma<0.9;
+  const bool ice_cloud = sigma>0.2 and sigma<0.4;
+  const bool rain      = sigma>0.8;
+
+  if (name=="ps") return ps;
+  if (name=="p_mid" or name=="p_dry_mid" or name=="p_int" or name=="p_dry_int") return p;
+  if (name=="pseudo_density" or name=="pseudo_density_dry") return dp;
+  if (name=="T_mid" or name=="T_prev_micro_step") {
+    return std::max(200.0, 300*std::pow(sigma,0.19)) - 5*noise;
+  }
+  if (name=="qv" or name=="qv_prev_micro_step") return 0.015*std::pow(sigma,3)*(0.8+0.4*noise);
+  if (name=="qc") return liq_cloud ? 2e-4*(0.5+noise) : 0;
+  if (name=="nc") return liq_cloud ? 5e7 : 0;
+  if (name=="qr") return rain ? 1e-5*noise : 0;
+  if (name=="nr") return rain ? 1e4 : 0;
+  if (name=="qi") return ice_cloud ? 2e-5*(0.5+noise) : 0;
+  if (name=="ni") return ice_cloud ? 1e5 : 0;
+  if (name=="qm") return ice_cloud ? 1e-6 : 0;
+  if (name=="bm") return ice_cloud ? 1e-6/900 : 0;
+  if (name=="cldfrac_liq") return liq_cloud ? 0.8 : 0;
+  if (name=="cldfrac_tot") return (liq_cloud or ice_cloud) ? 0.8 : 0;
+  if (name=="eff_radius_qc") return 10;
+  if (name=="eff_radius_qi") return 25;
+  if (name=="o3_volume_mix_ratio") return 3e-8 + 8e-6*std::pow(1-sigma,8);
+  if (name=="horiz_winds") return cmp==0 ? 5+10*(1-sigma)+5*noise : 2*noise;
+  if (name=="tke") return 0.1;
+  if (name=="inv_qc_relvar") return 1;
+  if (name=="eddy_diff_mom") return 1;
+  if (name=="nccn") return 1e8;
+
+  // Fluxes, tendencies, and anything else: start from zero
+  return 0;
+}
+
+void fill_synthetic (Field& f, const std::shared_ptr<const AbstractGrid>& grid) {
+  const auto& fid = f.get_header().get_identifier();
+  const auto& fl  = fid.get_layout();
+  const auto& name = fid.name();
+
+  if (not fl.has_tag(COL)) {
+    f.deep_copy(synthetic_value(name,PC::P0,PC::P0,0,0,0));
+    return;
+  }
+
+  const int nlevs = grid->get_num_vertical_levels();
+  const auto gids = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  std::vector<Real> hyai, hybi;
+  compute_hybrid_coeffs(nlevs,hyai,hybi);
+
+  auto value = [&](const int icol, const int cmp, const FieldTag lev_tag, const int k) {
+    const Real noise = col_noise(gids(icol));
+    const Real ps = 1e5 - 3e3*noise;
+    auto p_int = [&](const int ilev) { return hyai[ilev]*PC::P0 + hybi[ilev]*ps; };
+    Real p = ps, dp = 0;
+    if (lev_tag==LEV) {
+      p  = (p_int(k)+p_int(k+1))/2;
+      dp = p_int(k+1)-p_int(k);
+    } else if (lev_tag==ILEV) {
+      p  = p_int(k);
+    }
+    return synthetic_value(name,ps,p,dp,noise,cmp);
+  };
+
+  const bool last_is_lev = fl.tag(fl.rank()-1)==LEV or fl.tag(fl.rank()-1)==ILEV;
+  const auto lev_tag = last_is_lev ? fl.tag(fl.rank()-1) : CMP;
+  switch (fl.rank()) {
+    case 1:
+    {
+      auto v = f.get_view<Real*,Host>();
+      for (int i=0; i<fl.dim(0); ++i) {
+        v(i) = value(i,0,lev_tag,0);
+      }
+      break;
+    }
+    case 2:
+    {
+      auto v = f.get_view<Real**,Host>();
+      for (int i=0; i<fl.dim(0); ++i) {
+        for (int j=0; j<fl.dim(1); ++j) {
+          v(i,j) = last_is_lev ? value(i,0,lev_tag,j) : value(i,j,lev_tag,0);
+        }
+      }
+      break;
+    }
+    case 3:
+    {
+      auto v = f.get_view<Real***,Host>();
+      for (int i=0; i<fl.dim(0); ++i) {
+        for (int j=0; j<fl.dim(1); ++j) {
+          for (int k=0; k<fl.dim(2); ++k) {
+            v(i,j,k) = value(i,j,lev_tag,last_is_lev ? k : 0);
+          }
+        }
+      }
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG ("Error! Unsupported layout for synthetic field.\n"
+                      "  - field name: " + name + "\n"
+                      "  - layout: " + fl.to_string() + "\n");
+  }
+  f.sync_to_dev();
+}
+
+// Read the columns of the ensemble file, and tile them over the grid columns.
+// Only fields that are in the file, and that have layout (COL) or (COL,LEV/ILEV),
+// are loaded. Returns the names of the loaded fields.
+std::set<std::string>
+load_ensemble (const std::string& filename,
+               const std::vector<Field>& fields,
+               const std::shared_ptr<const AbstractGrid>& grid)
+{
+  const auto& comm = grid->get_comm();
+  const int nlevs = grid->get_num_vertical_levels();
+  const int file_ncols = scorpio::get_dimlen(filename,"ncol");
+  EKAT_REQUIRE_MSG (scorpio::get_dimlen(filename,"lev")==nlevs,
+      "Error! The number of levels in the ensemble file does not match the benchmark one.\n"
+      "  - ensemble file: " + filename + "\n"
+      "  - file nlevs : " + std::to_string(scorpio::get_dimlen(filename,"lev")) + "\n"
+      "  - bench nlevs: " + std::to_string(nlevs) + "\n");
+
+  // Read the file on a grid matching it. We then give all columns to every
+  // rank, so that any grid column can be mapped to any ensemble column.
+  auto file_grid = create_point_grid("Ensemble",file_ncols,nlevs,comm);
+  const int file_nlcols = file_grid->get_num_local_dofs();
+
+  std::vector<Field> tgt_fields, file_fields;
+  for (const auto& f : fields) {
+    const auto& fid = f.get_header().get_identifier();
+    const auto& fl  = fid.get_layout();
+    const bool col_layout = fl.rank()==1 and fl.tag(0)==COL;
+    const bool col_lev_layout = fl.rank()==2 and fl.tag(0)==COL and
+                                (fl.tag(1)==LEV or fl.tag(1)==ILEV);
+    if (not (col_layout or col_lev_layout) or not scorpio::has_var(filename,fid.name())) {
+      continue;
+    }
+    auto file_fl = fl.clone();
+    file_fl.reset_dim(0,file_nlcols);
+    Field ff (FieldIdentifier(fid.name(),file_fl,fid.get_units(),file_grid->name()));
+    ff.allocate_view();
+    file_fields.push_back(ff);
+    tgt_fields.push_back(f);
+  }
+  if (file_fields.size()==0) {
+    return {};
+  }
+
+  AtmosphereInput reader (filename,file_grid,file_fields);
+  reader.read_variables();
+  reader.finalize();
+
+  // Point grids have contiguous gids, sorted by rank, so gathering the
+  // local chunks in rank order yields the columns in gid order
+  std::vector<int> ncols (comm.size());
+  ncols[comm.rank()] = file_nlcols;
+  comm.all_gather(ncols.data(),1);
+
+  const auto mpi_real = ekat::get_mpi_type<Real>();
+  const auto gids = grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  std::set<std::string> loaded;
+  for (size_t i=0; i<file_fields.size(); ++i) {
+    auto& ff = file_fields[i];
+    auto& f  = tgt_fields[i];
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    const int col_size = fl.rank()==1 ? 1 : fl.dim(1);
+
+    std::vector<int> counts (comm.size()), offsets (comm.size(),0);
+    for (int pid=0; pid<comm.size(); ++pid) {
+      counts[pid] = ncols[pid]*col_size;
+      offsets[pid] = pid==0 ? 0 : offsets[pid-1] + counts[pid-1];
+    }
+    std::vector<Real> all_cols (file_ncols*col_size);
+    ff.sync_to_host();
+    MPI_Allgatherv (ff.get_internal_view_data<const Real,Host>(),file_nlcols*col_size,mpi_real,
+                    all_cols.data(),counts.data(),offsets.data(),mpi_real,comm.mpi_comm());
+
+    for (int icol=0; icol<fl.dim(0); ++icol) {
+      const int ecol = gids(icol) % file_ncols;
+      if (fl.rank()==1) {
+        f.get_view<Real*,Host>()(icol) = all_cols[ecol];
+      } else {
+        auto v = f.get_view<Real**,Host>();
+        for (int k=0; k<col_size; ++k) {
+          v(icol,k) = all_cols[ecol*col_size+k];
+        }
+      }
+    }
+    f.sync_to_dev();
+    loaded.insert(f.name());
+  }
+  return loaded;
+}
+
+// Initialize all the inputs that the driver did not init from the params
+void fill_inputs (const AtmosphereDriver& ad, const std::string& ensemble_file) {
+  const auto& procs = ad.get_atm_processes();
+  const auto grid = ad.get_grids_manager()->get_grid("Physics");
+  const auto fm = ad.get_field_mgr(grid->name());
+
+  // Gather the input fields that still need a value. For bundled groups,
+  // we init the individual fields, not the bundle.
+  std::set<std::string> names;
+  for (const auto& f : procs->get_fields_in()) {
+    names.insert(f.name());
+  }
+  for (const auto& g : procs->get_groups_in()) {
+    for (const auto& it : g.m_fields) {
+      names.insert(it.second->name());
+    }
+  }
+  std::vector<Field> fields;
+  for (const auto& n : names) {
+    auto f = fm->get_field(n);
+    const auto& fid = f.get_header().get_identifier();
+    if (f.get_header().get_tracking().get_time_stamp().is_valid() or
+        f.get_header().get_children().size()>0 or
+        fid.data_type()!=DataType::RealType) {
+      continue;
+    }
+    fields.push_back(f);
+  }
+
+  std::set<std::string> loaded;
+  if (ensemble_file!="") {
+    loaded = load_ensemble(ensemble_file,fields,grid);
+  }
+  const auto& t0 = ad.get_atm_time_stamp();
+  for (auto& f : fields) {
+    if (loaded.count(f.name())==0) {
+      fill_synthetic(f,grid);
+    }
+    f.get_header().get_tracking().update_time_stamp(t0);
+  }
+
+  // Now that all subfields are inited, so are the bundles
+  for (const auto& g : procs->get_groups_in()) {
+    if (g.m_bundle) {
+      g.m_bundle->get_header().get_tracking().update_time_stamp(t0);
+    }
+  }
+}
+
+BenchResult run_case (const ekat::Comm& comm,
+                      ekat::ParameterList& bench_params,
+                      const std::string& proc,
+                      const int ncols, const int nlevs)
+{
+  auto& bench_pl = bench_params.sublist("physics_bench");
+  const int dt = bench_pl.get<int>("time_step",300);
+  const int nsteps = bench_pl.get<int>("num_steps",10);
+  const int nwarmup = bench_pl.get<int>("num_warmup_steps",2);
+  const auto ensemble_file = bench_pl.get<std::string>("ensemble_file","");
+  const auto t0 = util::str_to_time_stamp(bench_pl.get<std::string>("run_t0","2021-10-12-45000"));
+  const int ngcols = ncols*comm.size();
+
+  // Run only the requested process, on a point grid, with perf counters on
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  auto& driver_pl = ad_params.sublist("driver_options");
+  driver_pl.set<std::string>("atm_log_level","warn");
+  driver_pl.set<std::string>("Atm Log File","physics_bench.atm.log");
+  driver_pl.set("check_all_computed_fields_for_nans",false);
+  driver_pl.set<std::string>("perf_counters_filename","physics_bench_perf_counters.csv");
+
+  auto& procs_pl = ad_params.sublist("atmosphere_processes");
+  procs_pl.set<std::vector<std::string>>("atm_procs_list",{proc});
+  auto& all_procs_pl = bench_params.sublist("atmosphere_processes");
+  if (all_procs_pl.isSublist(proc)) {
+    procs_pl.sublist(proc) = all_procs_pl.sublist(proc);
+  }
+  procs_pl.sublist(proc).set("enable_perf_counters",true);
+
+  auto& gm_pl = ad_params.sublist("grids_manager");
+  gm_pl.set<std::string>("Type","Mesh Free");
+  gm_pl.set<std::string>("geo_data_source","CREATE_EMPTY_DATA");
+  gm_pl.set<std::vector<std::string>>("grids_names",{"Point Grid"});
+  auto& pg_pl = gm_pl.sublist("Point Grid");
+  pg_pl.set<std::string>("type","point_grid");
+  pg_pl.set<std::vector<std::string>>("aliases",{"Physics"});
+  pg_pl.set("number_of_global_columns",ngcols);
+  pg_pl.set("number_of_vertical_levels",nlevs);
+
+  // Inputs not set here are filled after the driver inits fields (see fill_inputs)
+  ad_params.sublist("initial_conditions") = bench_params.sublist("initial_conditions");
+
+  AtmosphereDriver ad;
+  ad.set_comm(comm);
+  ad.set_params(ad_params);
+  ad.set_provenance_data();
+  ad.init_scorpio();
+  ad.init_time_stamps(t0,t0);
+  ad.create_atm_processes();
+  ad.create_grids();
+  set_synthetic_geometry(ad.get_grids_manager()->get_grid_nonconst("Physics"));
+  ad.create_fields();
+  ad.initialize_fields();
+  fill_inputs(ad,ensemble_file);
+  ad.initialize_atm_procs();
+  ad.reset_accumulated_fields();
+  ad.initialize_output_managers();
+
+  for (int i=0; i<nwarmup; ++i) {
+    ad.run(dt);
+  }
+  ad.get_atm_processes()->reset_perf_counters();
+  for (int i=0; i<nsteps; ++i) {
+    ad.run(dt);
+  }
+
+  std::vector<AtmosphereProcess::PerfReport> reports;
+  ad.get_atm_processes()->gather_perf_reports(reports);
+  EKAT_REQUIRE_MSG (reports.size()==1,
+      "Error! Unexpected number of perf reports.\n"
+      "  - process: " + proc + "\n"
+      "  - num reports: " + std::to_string(reports.size()) + "\n");
+  const auto& r = reports.front();
+
+  BenchResult res;
+  res.process          = proc;
+  res.ncols            = ngcols;
+  res.nlevs            = nlevs;
+  res.nsteps           = r.nsteps;
+  res.time_per_step    = r.time_per_step;
+  res.cols_per_sec     = r.time_per_step>0 ? ngcols/r.time_per_step : 0;
+  res.bytes_per_col    = r.bytes_per_step/ngcols;
+  res.kernels_per_step = r.kernels_per_step;
+  res.bandwidth        = r.bandwidth;
+
+  ad.finalize();
+
+  return res;
+}
+
+void write_json (const std::string& filename,
+                 const ekat::Comm& comm,
+                 ekat::ParameterList& bench_pl,
+                 const std::vector<BenchResult>& results)
+{
+  std::ofstream ofs (filename);
+  EKAT_REQUIRE_MSG (ofs.good(),
+      "Error! Could not open file for physics bench results.\n"
+      " - filename: " + filename + "\n");
+
+  ofs << std::setprecision(8);
+  ofs << "{\n"
+      << "  \"config\": {\n"
+      << "    \"exec_space\": \"" << Kokkos::DefaultExecutionSpace::name() << "\",\n"
+      << "    \"precision\": \"" << (sizeof(Real)==8 ? "double" : "single") << "\",\n"
+      << "    \"pack_size\": " << SCREAM_PACK_SIZE << ",\n"
+      << "    \"small_pack_size\": " << SCREAM_SMALL_PACK_SIZE << ",\n"
+      << "    \"num_ranks\": " << comm.size() << ",\n"
+      << "    \"num_steps\": " << bench_pl.get<int>("num_steps",10) << ",\n"
+      << "    \"num_warmup_steps\": " << bench_pl.get<int>("num_warmup_steps",2) << ",\n"
+      << "    \"ensemble_file\": \"" << bench_pl.get<std::string>("ensemble_file","") << "\"\n"
+      << "  },\n"
+      << "  \"results\": [";
+  for (size_t i=0; i<results.size(); ++i) {
+    const auto& r = results[i];
+    ofs << (i==0 ? "\n" : ",\n")
+        << "    {"
+        << "\"process\": \"" << r.process << "\", "
+        << "\"ncols\": " << r.ncols << ", "
+        << "\"nlevs\": " << r.nlevs << ", "
+        << "\"nsteps\": " << r.nsteps << ", "
+        << "\"time_per_step\": " << r.time_per_step << ", "
+        << "\"cols_per_sec\": " << r.cols_per_sec << ", "
+        << "\"bytes_per_col\": " << r.bytes_per_col << ", "
+        << "\"kernels_per_step\": " << r.kernels_per_step << ", "
+        << "\"bandwidth\": " << r.bandwidth << "}";
+  }
+  ofs << "\n  ]\n}\n";
+}
+
+template<typename T>
+std::vector<T> parse_list (const std::string& s) {
+  std::vector<T> v;
+  std::istringstream is(s);
+  std::string item;
+  while (std::getline(is,item,',')) {
+    std::istringstream item_is(item);
+    T val;
+    item_is >> val;
+    v.push_back(val);
+  }
+  return v;
+}
+
+void expect_another_arg (int i, int argc) {
+  EKAT_REQUIRE_MSG(i != argc-1, "Expected another cmd-line arg.");
+}
+
+} // anonymous namespace
+
+int main (int argc, char** argv) {
+  using namespace scream;
+
+  if (argc == 1) {
+    std::cout <<
+      argv[0] << " [options]\n"
+      "Options:\n"
+      "  -i <file>           Input yaml file. Default=physics_bench.yaml.\n"
+      "  -o <file>           Output json file. Default from input file.\n"
+      "  -p <p1,p2,...>      Processes to benchmark. Default from input file.\n"
+      "  -c <n1,n2,...>      Number of columns per rank. Default from input file.\n"
+      "  -k <n1,n2,...>      Number of vertical levels. Default from input file.\n"
+      "  -s <steps>          Number of timed steps. Default from input file.\n"
+      "  -w <steps>          Number of warmup steps. Default from input file.\n"
+      "  -e <file>           Ensemble file with recorded columns. Default from input file.\n";
+    return 1;
+  }
+
+  std::string input_file = "physics_bench.yaml";
+  std::string output_file, processes, ncols, nlevs, steps, warmup, ensemble_file;
+  for (int i = 1; i < argc; ++i) {
+    if (ekat::argv_matches(argv[i], "-i", "--input-file")) {
+      expect_another_arg(i, argc);
+      input_file = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-o", "--output-file")) {
+      expect_another_arg(i, argc);
+      output_file = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-p", "--processes")) {
+      expect_another_arg(i, argc);
+      processes = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-c", "--ncols")) {
+      expect_another_arg(i, argc);
+      ncols = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-k", "--nlevs")) {
+      expect_another_arg(i, argc);
+      nlevs = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-s", "--steps")) {
+      expect_another_arg(i, argc);
+      steps = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-w", "--warmup")) {
+      expect_another_arg(i, argc);
+      warmup = argv[++i];
+    } else if (ekat::argv_matches(argv[i], "-e", "--ensemble-file")) {
+      expect_another_arg(i, argc);
+      ensemble_file = argv[++i];
+    }
+  }
+
+  int nerr = 0;
+  MPI_Init(&argc,&argv);
+  scream::initialize_scream_session(argc,argv); {
+    ekat::Comm comm (MPI_COMM_WORLD);
+
+    ekat::ParameterList bench_params("Physics Bench");
+    parse_yaml_file(input_file,bench_params);
+
+    // Command line args override the input file
+    auto& bench_pl = bench_params.sublist("physics_bench");
+    if (output_file!="")   bench_pl.set("output_file",output_file);
+    if (processes!="")     bench_pl.set("processes",parse_list<std::string>(processes));
+    if (ncols!="")         bench_pl.set("ncols",parse_list<int>(ncols));
+    if (nlevs!="")         bench_pl.set("nlevs",parse_list<int>(nlevs));
+    if (steps!="")         bench_pl.set("num_steps",std::stoi(steps));
+    if (warmup!="")        bench_pl.set("num_warmup_steps",std::stoi(warmup));
+    if (ensemble_file!="") bench_pl.set("ensemble_file",ensemble_file);
+
+    register_physics();
+    register_diagnostics();
+    register_mesh_free_grids_manager();
+
+    std::vector<BenchResult> results;
+    try {
+      for (const auto& proc : bench_pl.get<std::vector<std::string>>("processes")) {
+        for (const auto nlev : bench_pl.get<std::vector<int>>("nlevs")) {
+          for (const auto ncol : bench_pl.get<std::vector<int>>("ncols")) {
+            results.push_back(run_case(comm,bench_params,proc,ncol,nlev));
+            const auto& r = results.back();
+            if (comm.am_i_root()) {
+              printf("  %-12s ncols=%-8d nlevs=%-4d cols/s=%-12.4g bytes/col=%-10.4g kernels/step=%g\n",
+                     r.process.c_str(),r.ncols,r.nlevs,r.cols_per_sec,r.bytes_per_col,r.kernels_per_step);
+            }
+          }
+        }
+      }
+
+      const auto out_file = bench_pl.get<std::string>("output_file","physics_bench.json");
+      if (comm.am_i_root()) {
+        write_json(out_file,comm,bench_pl,results);
+        printf("Physics bench results written to %s\n",out_file.c_str());
+      }
+    } catch (std::exception& e) {
+      printf("[rank %d] physics_bench failed:\n%s\n",comm.rank(),e.what());
+      nerr = 1;
+    }
+  } scream::finalize_scream_session();
+  MPI_Finalize();
+
+  return nerr;
+}
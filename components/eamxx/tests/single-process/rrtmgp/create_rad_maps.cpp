@@ -0,0 +1,73 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <algorithm>
+
+namespace {
+
+using namespace scream;
+
+// Write a map in the format expected by the horiz remappers (triplets, 1-based indices)
+void write_map_file (const std::string& filename, const int n_a, const int n_b,
+                     const std::vector<int>& row, const std::vector<int>& col,
+                     const std::vector<double>& S)
+{
+  scorpio::register_file(filename, scorpio::FileMode::Write);
+
+  scorpio::define_dim(filename,"n_a",n_a);
+  scorpio::define_dim(filename,"n_b",n_b);
+  scorpio::define_dim(filename,"n_s",S.size());
+
+  scorpio::define_var(filename,"col",{"n_s"},"int");
+  scorpio::define_var(filename,"row",{"n_s"},"int");
+  scorpio::define_var(filename,"S"  ,{"n_s"},"double");
+
+  scorpio::enddef(filename);
+
+  scorpio::write_var(filename,"row",row.data());
+  scorpio::write_var(filename,"col",col.data());
+  scorpio::write_var(filename,"S",  S.data());
+
+  scorpio::release_file(filename);
+}
+
+// Creates the maps to run radiation on a grid made of one column
+// every N physics columns (N being the coarsening factor)
+TEST_CASE("create_rad_maps")
+{
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  // The physics grid geometry comes from the IC file, so use its number of columns
+  const auto& params = ekat::TestSession::get().params;
+  const int ncols  = scorpio::get_dimlen(params.at("ic_file"),"ncol");
+  const int factor = std::stoi(params.at("coarsening_factor"));
+  REQUIRE (ncols>0);
+  REQUIRE (factor>=1);
+
+  // Coarse column j is the average of the fine columns [j*N,(j+1)*N).
+  // The refining map copies the coarse value back on each fine column,
+  // so that averaging the refined field returns the coarse field.
+  const int ncols_coarse = (ncols+factor-1) / factor;
+  std::vector<int> coarse(ncols), fine(ncols);
+  std::vector<double> w(ncols), ones(ncols,1.0);
+  for (int i=0; i<ncols; ++i) {
+    const int j = i / factor;
+    const int n = std::min(ncols,(j+1)*factor) - j*factor;
+    coarse[i] = j+1;
+    fine[i]   = i+1;
+    w[i] = 1.0 / n;
+  }
+
+  const auto suffix = "_x" + std::to_string(factor) + ".nc";
+  write_map_file("rad_coarsen_map"+suffix,ncols,ncols_coarse,coarse,fine,w);
+  write_map_file("rad_refine_map"+suffix,ncols_coarse,ncols,fine,coarse,ones);
+
+  scorpio::finalize_subsystem();
+}
+
+} // anonymous namespace
@@ -0,0 +1,84 @@
+#include <catch2/catch.hpp>
+
+#include "share/io/scream_scorpio_interface.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cmath>
+#include <iostream>
+
+namespace {
+
+using namespace scream;
+
+std::vector<double> read_last_record (const std::string& filename, const std::string& varname)
+{
+  int size = 1;
+  for (const auto& d : scorpio::get_var(filename,varname).dims) {
+    size *= d->length;
+  }
+  std::vector<double> v(size);
+  scorpio::read_var(filename,varname,v.data());
+  return v;
+}
+
+// Compares the output of a run where radiation is computed on a coarse grid
+// against a full resolution run, and reports the relative l2 error of the outputs
+TEST_CASE("rrtmgp_coarse_rad_error")
+{
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  const auto& params = ekat::TestSession::get().params;
+  const auto fine_file   = params.at("fine_file");
+  const auto coarse_file = params.at("coarse_file");
+
+  scorpio::register_file(fine_file,scorpio::Read);
+  scorpio::register_file(coarse_file,scorpio::Read);
+
+  // The SW bounds are looser than the LW ones: with the coarse grid used in this
+  // test, neighboring physics columns are not necessarily close to each other,
+  // so SW quantities (which depend on the zenith angle) have larger errors.
+  // The goal is to catch mistakes (e.g., columns mapped back to the wrong place),
+  // and to monitor the error of the coarse radiation option.
+  // TODO: these bounds are NOT calibrated. They were picked when the test was
+  //       added, without a run of the coarse_rad and not_chunked tests to
+  //       measure the actual errors. Once measured (the test prints them),
+  //       set each bound just above its measured error, and record the
+  //       measured values (and the machine/compiler) here.
+  const std::vector<std::pair<std::string,double>> vars = {
+    {"LW_flux_up",       0.2},
+    {"LW_flux_dn",       0.2},
+    {"sfc_flux_lw_dn",   0.2},
+    {"SW_flux_up",       0.5},
+    {"SW_flux_dn",       0.5},
+    {"sfc_flux_sw_net",  0.5},
+    {"rad_heating_pdel", 0.5},
+  };
+  for (const auto& it : vars) {
+    const auto& name = it.first;
+    const auto fine   = read_last_record(fine_file,name);
+    const auto coarse = read_last_record(coarse_file,name);
+    REQUIRE (fine.size()==coarse.size());
+
+    double err2 = 0, norm2 = 0;
+    for (size_t i=0; i<fine.size(); ++i) {
+      REQUIRE (std::isfinite(coarse[i]));
+      err2  += (coarse[i]-fine[i])*(coarse[i]-fine[i]);
+      norm2 += fine[i]*fine[i];
+    }
+    const double rel_err = norm2>0 ? std::sqrt(err2/norm2) : std::sqrt(err2);
+    if (comm.am_i_root()) {
+      std::cout << " " << name << ": relative l2 error = " << rel_err
+                << " (bound: " << it.second << ")\n";
+    }
+    CHECK (rel_err<it.second);
+  }
+
+  scorpio::release_file(fine_file);
+  scorpio::release_file(coarse_file);
+  scorpio::finalize_subsystem();
+}
+
+} // anonymous namespace
@@ -53,9 +53,8 @@ void tracer_forcing(
     const HybridVCoord &hvcoord, const TimeLevel &tl, const int &num_q,
     const MoistDry &moisture, const double &dt,
     const ExecViewManaged<Real * [NUM_TIME_LEVELS][NP][NP]> &ps_v,
-    const ExecViewManaged<
-        Scalar * [Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]> &qdp,
-    const ExecViewManaged<Scalar **[NP][NP][NUM_LEV]> &Q) {
+    const ExecViewManaged<StorageScalar ***[NP][NP][NUM_LEV]> &qdp,
+    const ExecViewManaged<StorageScalar **[NP][NP][NUM_LEV]> &Q) {
 
   const int num_e = ps_v.extent_int(0);
   const int np1 = tl.n0;
@@ -89,7 +88,7 @@ void tracer_forcing(
               const int ilev = k / VECTOR_SIZE;
               const int vlev = k % VECTOR_SIZE;
               Real v1 = dt * f_q(ie, 0, igp, jgp, ilev)[vlev];
-              const Real &qdp_s =
+              const Real qdp_s =
                   qdp(ie, np1_qdp, 0, igp, jgp, ilev)[vlev];
               if (qdp_s + v1 < 0.0 && v1 < 0.0) {
                 if (qdp_s < 0.0) {
@@ -116,7 +115,7 @@ void tracer_forcing(
         const int jgp = (idx / NUM_LEV) % NP;
         const int k = idx % NUM_LEV;
         Scalar v1 = dt * f_q(ie, iq, igp, jgp, k);
-        Scalar &qdp_s = qdp(ie, np1_qdp, iq, igp, jgp, k);
+        Scalar qdp_s = pack_cast<Scalar>(qdp(ie, np1_qdp, iq, igp, jgp, k));
         VECTOR_SIMD_LOOP
         for (int vlev = 0; vlev < VECTOR_SIZE; ++vlev) {
           if (qdp_s[vlev] + v1[vlev] < 0.0 && v1[vlev] < 0.0) {
@@ -128,6 +127,7 @@ void tracer_forcing(
           }
           qdp_s[vlev] += v1[vlev];
         }
+        qdp(ie, np1_qdp, iq, igp, jgp, k) = pack_cast<StorageScalar>(qdp_s);
       });
 
   Kokkos::parallel_for("tracer forcing ps_v",
@@ -142,7 +142,7 @@ void tracer_forcing(
 
     const Scalar dp = hvcoord.hybrid_ai_delta(k) * hvcoord.ps0 +
                       hvcoord.hybrid_bi_delta(k) * ps_v(ie, np1, igp, jgp);
-    Q(ie, iq, igp, jgp, k) = qdp(ie, np1_qdp, iq, igp, jgp, k) / dp;
+    Q(ie, iq, igp, jgp, k) = pack_cast<StorageScalar>(pack_cast<Scalar>(qdp(ie, np1_qdp, iq, igp, jgp, k)) / dp);
   });
 }
 
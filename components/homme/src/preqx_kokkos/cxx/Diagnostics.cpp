@@ -76,10 +76,12 @@ void Diagnostics::prim_diag_scalars (const bool before_advance, const int ivar)
           Real accum_qdp_q = 0;
           Real accum_qdp = 0;
 
-          HostViewUnmanaged<Real[NUM_PHYSICAL_LEV]> qdp(&qdp_h(ie, t2_qdp, iq, igp, jgp, 0)[0]);
+          // qdp may be stored in single precision, so access it through the packs
+          const auto qdp = Homme::subview(qdp_h, ie, t2_qdp, iq, igp, jgp);
           for (int level=0; level<NUM_PHYSICAL_LEV; ++level) {
-            accum_qdp_q += qdp(level)*h_Q(ie, iq, level, igp, jgp);
-            accum_qdp   += qdp(level);
+            const Real qdp_lev = qdp(level / VECTOR_SIZE)[level % VECTOR_SIZE];
+            accum_qdp_q += qdp_lev*h_Q(ie, iq, level, igp, jgp);
+            accum_qdp   += qdp_lev;
           }
           h_Qvar(ie, ivar, iq, igp, jgp) = accum_qdp_q;
 
@@ -205,12 +205,14 @@ public:
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV),
                            [&](const int &lev) {
 
-        m_derived.m_dpdiss_ave(kv.ie, igp, jgp, lev) +=
+        auto& dpdiss_ave = m_derived.m_dpdiss_ave(kv.ie, igp, jgp, lev);
+        auto& dpdiss_bih = m_derived.m_dpdiss_biharmonic(kv.ie, igp, jgp, lev);
+        dpdiss_ave = pack_cast<StorageScalar>(pack_cast<Scalar>(dpdiss_ave) +
             m_data.eta_ave_w * m_state.m_dp3d(kv.ie, m_data.np1, igp, jgp, lev) /
-            m_data.hypervis_subcycle;
-        m_derived.m_dpdiss_biharmonic(kv.ie, igp, jgp, lev) +=
+            m_data.hypervis_subcycle);
+        dpdiss_bih = pack_cast<StorageScalar>(pack_cast<Scalar>(dpdiss_bih) +
             m_data.eta_ave_w * m_buffers.dptens(kv.ie, igp, jgp, lev) /
-            m_data.hypervis_subcycle;
+            m_data.hypervis_subcycle);
       });
     });
     kv.team_barrier();
@@ -181,7 +181,7 @@ void cxx_push_forcing_to_f90(F90Ptr elem_derived_FM, F90Ptr elem_derived_FT,
   const SimulationParams &params = Context::singleton().get<SimulationParams>();
   if (params.ftype == ForcingAlg::FORCING_0) {
     if (tracers.fq.data() == nullptr) {
-      tracers.fq = decltype(tracers.fq)("fq", elements.num_elems());
+      tracers.fq = decltype(tracers.fq)("fq", elements.num_elems(), tracers.num_tracers());
     }
     HostViewUnmanaged<Real * [QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]> fq_f90(
         elem_derived_FQ, elements.num_elems());
@@ -206,7 +206,7 @@ void f90_push_forcing_to_cxx(F90Ptr elem_derived_FM, F90Ptr elem_derived_FT,
   Tracers &tracers = Context::singleton().get<Tracers>();
   if (params.ftype == ForcingAlg::FORCING_0) {
     if (tracers.fq.data() == nullptr) {
-      tracers.fq = decltype(tracers.fq)("fq", elements.num_elems());
+      tracers.fq = decltype(tracers.fq)("fq", elements.num_elems(), tracers.num_tracers());
     }
     HostViewUnmanaged<Real * [QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]> fq_f90(
         elem_derived_FQ, elements.num_elems());
@@ -79,6 +79,11 @@ struct ComposeTransportImpl {
   ElementsGeometry m_geometry;
   Tracers m_tracers;
   SphereOperators m_sphere_ops;
+  // Compose accesses qdp and Q through raw Real pointers, so these are
+  // m_tracers.qdp and m_tracers.Q seen as Scalar views. Compose does not
+  // support HOMMEXX_MIXED_PRECISION (see setup), so they stay empty then.
+  ExecViewManaged<Scalar***[NP][NP][NUM_LEV]> m_qdp;
+  ExecViewManaged<Scalar**[NP][NP][NUM_LEV]> m_Q;
   int nslot;
   Data m_data;
 
@@ -44,6 +44,14 @@ void ComposeTransportImpl::setup () {
   m_geometry = Context::singleton().get<ElementsGeometry>();
   m_tracers = Context::singleton().get<Tracers>();
   m_sphere_ops = Context::singleton().get<SphereOperators>();
+#ifdef HOMMEXX_MIXED_PRECISION
+  Errors::runtime_abort("ComposeTransport (transport_alg > 0) does not support HOMMEXX_MIXED_PRECISION:\n"
+                        "  compose reads and writes qdp and Q as Real's, but they are stored in single precision.\n"
+                        "  Use transport_alg = 0, or build with HOMMEXX_MIXED_PRECISION=OFF.");
+#else
+  m_qdp = m_tracers.qdp;
+  m_Q = m_tracers.Q;
+#endif
   
   set_dp_tol();
   nslot = calc_nslot(m_geometry.num_elems());
@@ -56,7 +64,6 @@ void ComposeTransportImpl::reset (const SimulationParams& params) {
   if (independent_time_steps != m_data.independent_time_steps ||
       m_data.nelemd != num_elems || m_data.qsize != params.qsize) {
     const auto& g = m_geometry;
-    const auto& t = m_tracers;
     const auto& s = m_state;
     const auto& d = m_derived;
     const auto nel = num_elems;
@@ -72,10 +79,10 @@ void ComposeTransportImpl::reset (const SimulationParams& params) {
                                 s.m_dp3d.data()),
         nel, (independent_time_steps ? 1 : NUM_TIME_LEVELS), np, np, nlev),
       homme::compose::SetView<Real******>(
-        reinterpret_cast<Real*>(t.qdp.data()),
-        nel, t.qdp.extent_int(1), t.qdp.extent_int(2), np, np, nlev),
-      homme::compose::SetView<Real*****> (reinterpret_cast<Real*>(t.Q.data()),
-                                          nel, t.Q.extent_int(1), np, np, nlev),
+        reinterpret_cast<Real*>(m_qdp.data()),
+        nel, m_qdp.extent_int(1), m_qdp.extent_int(2), np, np, nlev),
+      homme::compose::SetView<Real*****> (reinterpret_cast<Real*>(m_Q.data()),
+                                          nel, m_Q.extent_int(1), np, np, nlev),
       m_data.dep_pts);
   }
   m_data.independent_time_steps = independent_time_steps;
@@ -84,6 +91,8 @@ void ComposeTransportImpl::reset (const SimulationParams& params) {
   m_data.qsize = params.qsize;
   Errors::runtime_check(m_data.qsize > 0,
                         "SL transport requires qsize > 0; if qsize == 0, use Eulerian.");
+  Errors::runtime_check(m_data.qsize <= m_tracers.num_tracers(),
+                        "qsize exceeds the number of tracers allocated in Tracers.");
   m_data.nelemd = num_elems;
 
   sl_get_params(&m_data.nu_q, &m_data.hv_scaling, &m_data.hv_q, &m_data.hv_subcycle_q,
@@ -143,7 +152,7 @@ void ComposeTransportImpl::init_boundary_exchanges () {
     be->set_diagnostics_level(sp.internal_diagnostics_level);
     be->set_buffers_manager(bm_exchange);
     be->set_num_fields(0, 0, m_data.qsize + 1);
-    be->register_field(m_tracers.qdp, i, m_data.qsize, 0);
+    be->register_field(m_qdp, i, m_data.qsize, 0);
     be->register_field(m_derived.m_omega_p);
     be->registration_completed();
   }
@@ -172,7 +181,7 @@ void ComposeTransportImpl::init_boundary_exchanges () {
       if (i == 0) 
         be->register_field(m_tracers.qtens_biharmonic, m_data.hv_q, 0);
       else
-        be->register_field(m_tracers.Q, m_data.hv_q, 0);
+        be->register_field(m_Q, m_data.hv_q, 0);
       be->registration_completed();
     }
   }
@@ -215,8 +224,8 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
   if ( ! run_cedr) {
     // For analysis purposes, property preservation was not run. Need to convert
     // Q to qdp.
-    const auto qdp = m_tracers.qdp;
-    const auto Q = m_tracers.Q;
+    const auto qdp = m_qdp;
+    const auto Q = m_Q;
     const auto dp3d = m_state.m_dp3d;
     const auto spheremp = m_geometry.m_spheremp;
     const auto f = KOKKOS_LAMBDA (const int idx) {
@@ -229,7 +238,7 @@ void ComposeTransportImpl::run (const TimeLevel& tl, const Real dt) {
   
   { // DSS qdp and omega
     GPTLstart("compose_dss_q");
-    const auto qdp = m_tracers.qdp;
+    const auto qdp = m_qdp;
     const auto spheremp = m_geometry.m_spheremp;
     const auto f1 = KOKKOS_LAMBDA (const int idx) {
       int ie, q, i, j, lev;
@@ -16,7 +16,7 @@ void ComposeTransportImpl::advance_hypervis_scalar (const Real dt_q) {
   const auto hv_q = m_data.hv_q;
   const auto nu_q = m_data.nu_q;
   const auto Qtens = m_tracers.qtens_biharmonic;
-  const auto Q = m_tracers.Q;
+  const auto Q = m_Q;
   const auto spheremp = m_geometry.m_spheremp;
   const auto tu_ne_hv_q = m_tu_ne_hv_q;
   const auto sphere_ops = m_sphere_ops;
@@ -24,10 +24,13 @@ static void fill_ics (const ComposeTransportImpl& cti, const int n0_qdp, const i
     Real lat = pll(ie,i,j,0), lon = pll(ie,i,j,1);
     compose::test::offset_latlon(cti.num_phys_lev, lev, lat, lon);
     const int p = lev / cti.packn, s = lev % cti.packn;
-    for (int q = 0; q < cti.m_data.qsize; ++q)
+    for (int q = 0; q < cti.m_data.qsize; ++q) {
+      // qdp may be stored in single precision (see StorageScalar).
+      Real qdp_ic;
       compose::test::InitialCondition::init(compose::test::get_ic(cti.m_data.qsize, lev, q),
-                                            1, &lat, &lon,
-                                            &qdp(ie,n0_qdp,q,i,j,p)[s]);
+                                            1, &lat, &lon, &qdp_ic);
+      qdp(ie,n0_qdp,q,i,j,p)[s] = qdp_ic;
+    }
     if (np1 >= 0) dp3d(ie,np1,i,j,p)[s] = 1;
   };
   cti.loop_host_ie_plev_ij(f);
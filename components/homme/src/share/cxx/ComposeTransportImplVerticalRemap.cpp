@@ -46,8 +46,8 @@ void ComposeTransportImpl::remap_q (const TimeLevel& tl) {
   const auto np1_qdp = tl.np1_qdp;
   const auto dp = m_derived.m_divdp;
   const auto dp3d = m_state.m_dp3d;
-  const auto qdp = m_tracers.qdp;
-  const auto q = m_tracers.Q;
+  const auto qdp = m_qdp;
+  const auto q = m_Q;
   const int nq = m_tracers.num_tracers();
   const auto& vrm = Context::singleton().get<VerticalRemapManager>();
   const auto r = vrm.get_remapper();
@@ -32,8 +32,8 @@ void ElementsDerivedState::init(const int num_elems) {
   m_dp                = ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>("derived_dp", m_num_elems);
   m_divdp             = ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>("derived_divdp", m_num_elems);
   m_divdp_proj        = ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>("derived_divdp_proj", m_num_elems);
-  m_dpdiss_biharmonic = ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>("derived_dpdiss_biharmonic", m_num_elems);
-  m_dpdiss_ave        = ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>("derived_dpdiss_ave", m_num_elems);
+  m_dpdiss_biharmonic = ExecViewManaged<StorageScalar * [NP][NP][NUM_LEV]>("derived_dpdiss_biharmonic", m_num_elems);
+  m_dpdiss_ave        = ExecViewManaged<StorageScalar * [NP][NP][NUM_LEV]>("derived_dpdiss_ave", m_num_elems);
 }
 
 void ElementsDerivedState::randomize(const int seed, const Real dp3d_min) {
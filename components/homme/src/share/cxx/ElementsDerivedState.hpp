@@ -27,8 +27,11 @@ public:
   ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>     m_dp;                // for dp_tracers at physics timestep
   ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>     m_divdp;             // divergence of dp
   ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>     m_divdp_proj;        // DSSed divdp
-  ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>     m_dpdiss_biharmonic; // mean dp dissipation tendency, if nu_p>0
-  ExecViewManaged<Scalar * [NP][NP][NUM_LEV]>     m_dpdiss_ave;        // mean dp used to compute psdiss_tens
+
+  // Time-averaged diagnostics. With HOMMEXX_MIXED_PRECISION, they are stored in single
+  // precision, so they must be converted to Scalar (with pack_cast) before computing.
+  ExecViewManaged<StorageScalar * [NP][NP][NUM_LEV]> m_dpdiss_biharmonic; // mean dp dissipation tendency, if nu_p>0
+  ExecViewManaged<StorageScalar * [NP][NP][NUM_LEV]> m_dpdiss_ave;        // mean dp used to compute psdiss_tens
 
   ElementsDerivedState() : m_num_elems(0) {}
 
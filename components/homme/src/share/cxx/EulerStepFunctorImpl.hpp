@@ -18,6 +18,7 @@
 #include "HybridVCoord.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "Tracers.hpp"
 #include "profiling.hpp"
 #include "mpi/BoundaryExchange.hpp"
@@ -104,6 +105,11 @@ class EulerStepFunctorImpl {
   Kokkos::TeamPolicy<ExecSpace> m_tv_policy;
   TeamUtils<ExecSpace> m_tu_ne, m_tu_ne_qsize;
 
+  // Team sizes of the kernels using m_tu_ne_qsize, and whether to tune them
+  // at the first call to advect_and_limit
+  TeamSizes m_team_sizes_ne_qsize;
+  bool      m_tune_policy = false;
+
   int m_prev_num_elems, m_prev_qsize;
 
   bool                m_kernel_will_run_limiters;
@@ -166,6 +172,10 @@ public:
     m_data.nu_q = params.nu_q;
     m_data.consthv = (params.hypervis_scaling == 0);
 
+    // Tracers views are sized with the runtime number of tracers
+    Errors::runtime_check(m_data.qsize <= m_tracers.num_tracers(),
+                          "[EulerStepFunctorImpl::reset]: qsize exceeds the number of tracers allocated in Tracers.");
+
     if (m_data.limiter_option == 4) {
       std::string msg = "[EulerStepFunctorImpl::reset]:";
       msg += "limiter_option=4 is not yet supported in C++. ";
@@ -180,8 +190,14 @@ public:
 
       const auto num_parallel_iterations = m_geometry.num_elems() * m_data.qsize;
 
+      const auto& tuner = Context::singleton().create_if_not_there<TeamPolicyTuner>();
+      m_team_sizes_ne_qsize = tuner.get_team_sizes<ExecSpace>("EulerStepFunctor", num_parallel_iterations, m_tpref);
+      // needs_tuning and tune are collective, so all ranks must call them, and agree on the result
+      const bool needs_tuning = tuner.needs_tuning("EulerStepFunctor", num_parallel_iterations);
+      m_tune_policy = needs_tuning && m_data.qsize>0;
+
       auto tp_ne       = Homme::get_default_team_policy<ExecSpace>(m_geometry.num_elems());
-      auto tp_ne_qsize = Homme::get_default_team_policy<ExecSpace>(num_parallel_iterations, m_tpref);
+      auto tp_ne_qsize = ne_qsize_policy<>();
 
       ThreadPreferences tp;
       tp.max_threads_usable = NUM_LEV;
@@ -198,6 +214,13 @@ public:
     }
   }
 
+  // Policy for the kernels that use m_tu_ne_qsize
+  template<typename... Tags>
+  Kokkos::TeamPolicy<ExecSpace,Tags...> ne_qsize_policy () const {
+    return TeamPolicyTuner::make_team_policy<Kokkos::TeamPolicy<ExecSpace,Tags...>>(
+        m_geometry.num_elems() * m_data.qsize, m_team_sizes_ne_qsize);
+  }
+
   int requested_buffer_size () const {
     constexpr int size_scalar =   NP*NP*NUM_LEV*VECTOR_SIZE;
     constexpr int size_vector = 2*NP*NP*NUM_LEV*VECTOR_SIZE;
@@ -301,13 +324,9 @@ public:
     m_data.rhs_viss = 3.0;
 
     if(m_data.nu_p > 0){
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPreNup>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
-                         *this);
+    Kokkos::parallel_for(ne_qsize_policy<BIHPreNup>(), *this);
     }else{
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPreNoNup>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
-                         *this);
+    Kokkos::parallel_for(ne_qsize_policy<BIHPreNoNup>(), *this);
 
     }
 
@@ -320,13 +339,9 @@ public:
     assert(m_data.rhs_multiplier == 2.0);
 
     if(m_data.consthv){
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPostConstHV>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
-                         *this);
+    Kokkos::parallel_for(ne_qsize_policy<BIHPostConstHV>(), *this);
     }else{
-    Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPostTensorHV>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
-                         *this);
+    Kokkos::parallel_for(ne_qsize_policy<BIHPostTensorHV>(), *this);
     }
     Kokkos::fence();
     profiling_pause();
@@ -362,7 +377,7 @@ public:
           Kokkos::parallel_for(
             Kokkos::ThreadVectorRange(team, NUM_LEV),
             [&] (const int& k) {
-              qtens_biharmonic(i,j,k) = qtens_biharmonic(i,j,k) * dpdiss_ave(i,j,k) / m_hvcoord.dp0(k);
+              qtens_biharmonic(i,j,k) = qtens_biharmonic(i,j,k) * pack_cast<Scalar>(dpdiss_ave(i,j,k)) / m_hvcoord.dp0(k);
             });
         });
       team.team_barrier();
@@ -423,17 +438,36 @@ public:
       *this);
     Kokkos::fence();
     m_kernel_will_run_limiters = true;
-    Kokkos::parallel_for(
-      //to play with launch bounds
-      //Homme::get_default_team_policy<ExecSpace, AALTracerPhase, Kokkos::LaunchBounds<128,1> >(
-      Homme::get_default_team_policy<ExecSpace, AALTracerPhase >(
-        m_geometry.num_elems() * m_data.qsize, m_tpref),
-      *this);
+    if (m_tune_policy) {
+      tune_team_policy();
+    }
+    Kokkos::parallel_for(ne_qsize_policy<AALTracerPhase>(), *this);
     Kokkos::fence();
     m_kernel_will_run_limiters = false;
     profiling_pause();
   }
 
+  // Time the tracer phase, and use the fastest team sizes for all the kernels using m_tu_ne_qsize
+  void tune_team_policy () {
+    // The tracer phase writes qtens, the limiter bounds, and the np1 qdp
+    ViewsSnapshot snapshot;
+    snapshot.add(m_tracers.qdp);
+    snapshot.add(m_tracers.qtens_biharmonic);
+    snapshot.add(m_tracers.qlim);
+
+    auto& tuner = Context::singleton().get<TeamPolicyTuner>();
+    const int num_parallel_iterations = m_geometry.num_elems() * m_data.qsize;
+    m_team_sizes_ne_qsize = tuner.tune<ExecSpace>("EulerStepFunctor", num_parallel_iterations, m_tpref,
+                                                  [&](const TeamSizes& candidate) {
+      const auto policy =
+        TeamPolicyTuner::make_team_policy<Kokkos::TeamPolicy<ExecSpace,AALTracerPhase>>(num_parallel_iterations, candidate);
+      m_tu_ne_qsize = TeamUtils<ExecSpace>(policy);
+      Kokkos::parallel_for(policy, *this);
+    }, snapshot);
+    m_tu_ne_qsize = TeamUtils<ExecSpace>(ne_qsize_policy<>());
+    m_tune_policy = false;
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator() (const AALSetupPhase&, const TeamMember& team) const {
     KernelVariables kv(team, m_tu_ne);
@@ -498,9 +532,10 @@ public:
             Kokkos::parallel_for(
               Kokkos::ThreadVectorRange(kv.team, NUM_LEV),
               [&] (const int& ilev) {
-               qdp_np1(i,j,ilev) =
-                 (qdp_n0(i,j,ilev) + (rkstage-1)*qdp_np1(i,j,ilev)) /
-                 rkstage;
+               qdp_np1(i,j,ilev) = pack_cast<StorageScalar>(
+                 (pack_cast<Scalar>(qdp_n0(i,j,ilev)) +
+                  (rkstage-1)*pack_cast<Scalar>(qdp_np1(i,j,ilev))) /
+                 rkstage);
             });
           });
       });
@@ -557,7 +592,7 @@ public:
           Kokkos::parallel_for(
             Kokkos::TeamThreadRange(kv.team, NUM_LEV),
             [&] (const int& k) {
-              const auto v = qdp_t(0,0,k) / dp_t(0,0,k);
+              const auto v = pack_cast<Scalar>(qdp_t(0,0,k)) / dp_t(0,0,k);
               qtens_biharmonic_t(0,0,k) = v;
               qlim_t(0,k) = v;
               qlim_t(1,k) = v;
@@ -568,7 +603,7 @@ public:
             Kokkos::parallel_for(
               Kokkos::TeamThreadRange(kv.team, NUM_LEV),
               [&] (const int& k) {
-                const auto v = qdp_t(i,j,k) / dp_t(i,j,k);
+                const auto v = pack_cast<Scalar>(qdp_t(i,j,k)) / dp_t(i,j,k);
                 qtens_biharmonic_t(i,j,k) = v;
                 qlim_t(0,k) = min(qlim_t(0,k), v);
                 qlim_t(1,k) = max(qlim_t(1,k), v);
@@ -714,7 +749,7 @@ private:
                 //!          dpdiss(:,:) = ( hvcoord%hybi(k+1) - hvcoord%hybi(k) ) *
                 //!          elem(ie)%derived%psdiss_biharmonic(:,:)
                 m_buffers.dpdissk(kv.ie,i,j,k) += diss_fac *
-                  m_derived_state.m_dpdiss_biharmonic(kv.ie,i,j,k) / m_geometry.m_spheremp(kv.ie,i,j);
+                  pack_cast<Scalar>(m_derived_state.m_dpdiss_biharmonic(kv.ie,i,j,k)) / m_geometry.m_spheremp(kv.ie,i,j);
               }
             }
             //! also DSS extra field
@@ -781,7 +816,7 @@ private:
         Kokkos::parallel_for(
           Kokkos::ThreadVectorRange(kv.team, NUM_LEV),
           [&] (const int& ilev) {
-            qdp(igp, jgp, ilev) = spheremp(igp, jgp) * qtens(igp, jgp, ilev);
+            qdp(igp, jgp, ilev) = pack_cast<StorageScalar>(spheremp(igp, jgp) * qtens(igp, jgp, ilev));
           });
       });
   }
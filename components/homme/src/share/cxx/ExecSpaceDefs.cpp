@@ -6,6 +6,7 @@
 
 #include <cassert>
 
+#include <algorithm>
 #include <sstream>
 #include <vector>
 
@@ -163,45 +164,120 @@ team_num_threads_vectors_for_gpu (
   }
 }
 
+std::vector<std::pair<int, int>>
+team_num_threads_vectors_candidates_from_pool (
+  const int pool_size, const ThreadPreferences tp)
+{
+  assert(pool_size >= 1);
+  assert(tp.max_threads_usable >= 1 && tp.max_vectors_usable >= 1);
+
+  std::vector<std::pair<int, int>> candidates;
+  const int max_threads = std::min(pool_size, tp.max_threads_usable);
+  for (int num_threads = 1; num_threads <= max_threads; ++num_threads) {
+    if (pool_size % num_threads != 0) {
+      continue;
+    }
+    for (int num_vectors = 1;
+         num_vectors <= tp.max_vectors_usable && num_threads*num_vectors <= pool_size;
+         num_vectors *= 2) {
+      candidates.emplace_back(num_threads, num_vectors);
+    }
+  }
+  return candidates;
+}
+
+std::vector<std::pair<int, int>>
+team_num_threads_vectors_candidates_for_gpu (
+  const int num_threads_per_warp,
+  const int min_num_warps, const int max_num_warps,
+  const ThreadPreferences tp)
+{
+  assert(num_threads_per_warp > 0 && min_num_warps > 0);
+  assert(min_num_warps <= max_num_warps);
+  assert(tp.max_threads_usable >= 1 && tp.max_vectors_usable >= 1);
+
+  std::vector<std::pair<int, int>> candidates;
+  const int max_vectors = std::min(num_threads_per_warp, tp.max_vectors_usable);
+  for (int num_warps = Homme::nextpow2(min_num_warps); num_warps <= max_num_warps; num_warps *= 2) {
+    const int num_device_threads = num_warps * num_threads_per_warp;
+    for (int num_vectors = 1; num_vectors <= max_vectors; num_vectors *= 2) {
+      // Threads beyond max_threads_usable would be idle: don't try those
+      const int num_threads = std::min(num_device_threads / num_vectors, tp.max_threads_usable);
+      const auto tv = std::make_pair(num_threads, num_vectors);
+      if (std::find(candidates.begin(), candidates.end(), tv) == candidates.end()) {
+        candidates.push_back(tv);
+      }
+    }
+  }
+  return candidates;
+}
+
 } // namespace Parallel
 
-std::pair<int, int>
-DefaultThreadsDistribution<HommexxGPU>::
-team_num_threads_vectors (const int num_parallel_iterations,
-                          const ThreadPreferences tp) {
+namespace {
+
+// Warp counts and sizes of the device, and bounds on the number of warps per team.
+struct GpuWarpLimits {
+  int num_warps_device;
+  int num_threads_warp;
+  int min_num_warps;
+  int max_num_warps;
+};
+
+GpuWarpLimits get_gpu_warp_limits () {
+  GpuWarpLimits gwl;
+
   // It appears we can't use Kokkos to tell us this. On current devices, using
   // fewer than 4 warps/thread block limits the thread occupancy to that
   // number/4. That seems to be in Cuda specs, but I don't know of a function
   // that provides this number. Use a configuration option that defaults to 4.
-  int min_num_warps = HOMMEXX_CUDA_MIN_WARP_PER_TEAM;
+  gwl.min_num_warps = HOMMEXX_CUDA_MIN_WARP_PER_TEAM;
 
-  int max_num_warps = HOMMEXX_CUDA_MAX_WARP_PER_TEAM;
+  gwl.max_num_warps = HOMMEXX_CUDA_MAX_WARP_PER_TEAM;
 #ifdef KOKKOS_ENABLE_DEBUG
   // In debug builds, team size must be smaller because of Kokkos-side data.
-  max_num_warps = std::min(max_num_warps, 8);
+  gwl.max_num_warps = std::min(gwl.max_num_warps, 8);
 #endif
 
 #ifdef KOKKOS_ENABLE_CUDA
-  const int num_warps_device = Kokkos::Impl::cuda_internal_maximum_concurrent_block_count();
-  const int num_threads_warp = Kokkos::Impl::CudaTraits::WarpSize;
+  gwl.num_warps_device = Kokkos::Impl::cuda_internal_maximum_concurrent_block_count();
+  gwl.num_threads_warp = Kokkos::Impl::CudaTraits::WarpSize;
 #elif defined(KOKKOS_ENABLE_HIP)
   // Use 64 wavefronts per CU and 120 CUs.
-  const int num_warps_device = 120*64; // no such thing Kokkos::Impl::hip_internal_maximum_warp_count();
-  const int num_threads_warp = Kokkos::Impl::HIPTraits::WarpSize;
+  gwl.num_warps_device = 120*64; // no such thing Kokkos::Impl::hip_internal_maximum_warp_count();
+  gwl.num_threads_warp = Kokkos::Impl::HIPTraits::WarpSize;
 #else
   // I want thread-distribution rules to be unit-testable even when GPU spaces
   // are off. Thus, make up a GPU-like machine:
-  const int num_warps_device = 1792;
-  const int num_threads_warp = 32;
-  max_num_warps = 16;
+  gwl.num_warps_device = 1792;
+  gwl.num_threads_warp = 32;
+  gwl.max_num_warps = 16;
 #endif
 
-  min_num_warps = std::min(min_num_warps, max_num_warps);
-  
+  gwl.min_num_warps = std::min(gwl.min_num_warps, gwl.max_num_warps);
+
+  return gwl;
+}
+
+} // anonymous namespace
+
+std::pair<int, int>
+DefaultThreadsDistribution<HommexxGPU>::
+team_num_threads_vectors (const int num_parallel_iterations,
+                          const ThreadPreferences tp) {
+  const auto gwl = get_gpu_warp_limits();
   return Parallel::team_num_threads_vectors_for_gpu(
-    num_warps_device, num_threads_warp,
-    min_num_warps, max_num_warps,
+    gwl.num_warps_device, gwl.num_threads_warp,
+    gwl.min_num_warps, gwl.max_num_warps,
     num_parallel_iterations, tp);
 }
 
+std::vector<std::pair<int, int>>
+DefaultThreadsDistribution<HommexxGPU>::
+team_num_threads_vectors_candidates (const ThreadPreferences tp) {
+  const auto gwl = get_gpu_warp_limits();
+  return Parallel::team_num_threads_vectors_candidates_for_gpu(
+    gwl.num_threads_warp, gwl.min_num_warps, gwl.max_num_warps, tp);
+}
+
 } // namespace Homme
@@ -8,6 +8,7 @@
 #define HOMMEXX_EXEC_SPACE_DEFS_HPP
 
 #include <cassert>
+#include <vector>
 #ifdef HOMMEXX_BFB_TESTING
 #include <tuple>
 #endif
@@ -136,6 +137,22 @@ team_num_threads_vectors_for_gpu(
   const int min_num_warps, const int max_num_warps,
   const int num_parallel_iterations,
   const ThreadPreferences tp = ThreadPreferences());
+
+// Enumerate the (#threads, #vectors) pairs worth trying for a pool of threads
+// provided to the process. Used by TeamPolicyTuner. #threads divides the pool
+// size, and #vectors is a power of 2.
+std::vector<std::pair<int, int>>
+team_num_threads_vectors_candidates_from_pool(
+  const int pool_size, const ThreadPreferences tp = ThreadPreferences());
+
+// Enumerate the (#threads, #vectors) pairs worth trying on a GPU. Used by
+// TeamPolicyTuner. A team uses between min_num_warps and max_num_warps warps
+// (a power of 2), and #vectors is a power of 2 not larger than a warp.
+std::vector<std::pair<int, int>>
+team_num_threads_vectors_candidates_for_gpu(
+  const int num_threads_per_warp,
+  const int min_num_warps, const int max_num_warps,
+  const ThreadPreferences tp = ThreadPreferences());
 } // namespace Parallel
 
 // Device-dependent distribution of physical threads over teams and vectors. The
@@ -149,6 +166,12 @@ struct DefaultThreadsDistribution {
       ExecSpaceType().impl_thread_pool_size()
       , num_parallel_iterations, tp);
   }
+
+  static std::vector<std::pair<int, int>>
+  team_num_threads_vectors_candidates(const ThreadPreferences tp = ThreadPreferences()) {
+    return Parallel::team_num_threads_vectors_candidates_from_pool(
+      ExecSpaceType().impl_thread_pool_size(), tp);
+  }
 };
 
 // Specialization for a GPU, where threads can't be viewed as existing simply in
@@ -158,6 +181,9 @@ struct DefaultThreadsDistribution<HommexxGPU> {
   static std::pair<int, int>
   team_num_threads_vectors(const int num_parallel_iterations,
                            const ThreadPreferences tp = ThreadPreferences());
+
+  static std::vector<std::pair<int, int>>
+  team_num_threads_vectors_candidates(const ThreadPreferences tp = ThreadPreferences());
 };
 
 // Return a TeamPolicy using defaults that, so far, have been good for all use
@@ -353,6 +353,7 @@ void GllFvRemapImpl
   const auto buf10 = m_data.buf1[0];
   const auto buf11 = m_data.buf1[1];
   const auto buf20 = m_data.buf2[0];
+  const auto bufq = m_data.buf1[Data::nbuf1-1]; // only used if HOMMEXX_MIXED_PRECISION
 
 #ifndef NDEBUG
   const auto nelemd = m_data.nelemd;
@@ -453,6 +454,7 @@ void GllFvRemapImpl
 
     { // T
       const auto ttrg = Kokkos::TeamThreadRange(kv.team, np2);
+      const auto qv_g = get_q_gll(kv, q_g, ie, 0, bufq);
       
       const EVU<Scalar[NP][NP][NUM_LEV]> w1g(rw1.data()), w2g(rw2.data()), w3g(&r2w(0,0,0,0)),
         w4g(&r2w(1,0,0,0));
@@ -487,7 +489,7 @@ void GllFvRemapImpl
                                     wrk_ij, exner_ij);
         // theta_g
         ops.get_temperature(kv, eos, use_moisture, dp3d_ij, exner_ij, vthdp_ij,
-                            Homme::subview(q_g,ie,0,i,j), wrk_ij, th_g_ij);
+                            Homme::subview(qv_g,i,j), wrk_ij, th_g_ij);
         const auto& rexner_ij = exner_ij;
         parallel_for(tvr, [&] (int k) { // could avoid this in H case but then would lose BFB
           rexner_ij(k) = p_g_ij(k);
@@ -546,9 +548,10 @@ void GllFvRemapImpl
     const EVU<const Scalar**> dp_fv_ie(&dp_fv(ie,0,0,0), nf2, nlevpk);
     
     // q
+    const auto qg_ie = get_q_gll(kv, q_g, ie, iq, bufq);
     g2f_mixing_ratio(
       kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie, w_ff, fv_metdet_ie,
-      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie, evucs_np2_nlev(&q_g(ie,iq,0,0,0)),
+      evucs_np2_nlev(&dp_g(ie,timeidx,0,0,0)), dp_fv_ie, evucs_np2_nlev(qg_ie.data()),
       evus_np2_nlev(rw1.data()), evus_np2_nlev(rw2.data()), iq,
       evus3(&q(ie,0,0,0), q.extent_int(1), q.extent_int(2), q.extent_int(3)));
   };
@@ -573,6 +576,7 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   const auto buf10 = m_data.buf1[0];
   const auto buf11 = m_data.buf1[1];
   const auto buf20 = m_data.buf2[0];
+  const auto bufq = m_data.buf1[Data::nbuf1-1]; // only used if HOMMEXX_MIXED_PRECISION
 
 #ifndef NDEBUG
   const auto nelemd = m_data.nelemd;
@@ -732,7 +736,8 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
       // FV Q_ten
       //   GLL Q0 -> FV Q0
       const evus2 dqf_ie(&r2w(0,0,0,0), nf2, nlevpk);
-      const evucs_np2_nlev dp_g_ie(&dp_g(ie,timeidx,0,0,0)), qg_ie(&q_g(ie,iq,0,0,0));
+      const evucs_np2_nlev dp_g_ie(&dp_g(ie,timeidx,0,0,0)),
+        qg_ie(get_q_gll(kv, q_g, ie, iq, bufq).data());
       g2f_mixing_ratio(
         kv, np2, nf2, nlevpk, g2f_remapd, gll_metdet_ie,
         w_ff, fv_metdet_ie, dp_g_ie, dp_fv_ie, qg_ie,
@@ -765,7 +770,7 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
     // Augment bounds with GLL Q0 bounds. This assures that if the tendency is
     // 0, GLL Q1 = GLL Q0.
-    const evucs_np2_nlev qg_ie(&q_g(ie,iq,0,0,0));
+    const evucs_np2_nlev qg_ie(get_q_gll(kv, q_g, ie, iq, bufq).data());
     const evus1 qmin(&qlim(ie,iq,0,0), nlevpk), qmax(&qlim(ie,iq,1,0), nlevpk);
     augment_extrema(kv, np2, nlevpk, qg_ie, qmin, qmax);
     kv.team_barrier();
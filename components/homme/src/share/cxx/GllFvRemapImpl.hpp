@@ -62,7 +62,12 @@ struct GllFvRemapImpl {
     int nelemd, qsize, nf2, n_dss_fld;
     bool use_moisture, theta_hydrostatic_mode;
 
+#ifdef HOMMEXX_MIXED_PRECISION
+    // The last buf1 holds the (ie,iq) slice of GLL Q widened to Scalar (see get_q_gll)
+    static constexpr int nbuf1 = 3, nbuf2 = 1;
+#else
     static constexpr int nbuf1 = 2, nbuf2 = 1;
+#endif
     Buf1 buf1[nbuf1];
     Buf2 buf2[nbuf2];
 
@@ -121,6 +126,29 @@ struct GllFvRemapImpl {
   void remap_tracer_dyn_to_fv_phys(const int time_idx, const int nq,
                                    const CPhys3T& q_dyn, const Phys3T& q_fv);
 
+  /* The remap kernels read GLL Q as Scalar's. If HOMMEXX_MIXED_PRECISION, Q is
+     stored in single precision, so widen the (ie,iq) slice in the team's slot of
+     buf and return it; otherwise, just return the slice.
+   */
+  template <typename QT>
+  static KOKKOS_FUNCTION EVU<const Scalar[NP][NP][NUM_LEV]>
+  get_q_gll (const KernelVariables& kv, const QT& q_g, const int ie, const int iq,
+             const Buf1& buf) {
+#ifdef HOMMEXX_MIXED_PRECISION
+    const EVU<Scalar[NP][NP][NUM_LEV]> w(&buf(kv.team_idx,0,0,0));
+    const auto ttr = Kokkos::TeamThreadRange(kv.team, np2);
+    const auto tvr = Kokkos::ThreadVectorRange(kv.team, num_lev_pack);
+    loop_ik(ttr, tvr, [&] (int ij, int k) {
+      w(ij/NP,ij%NP,k) = pack_cast<Scalar>(q_g(ie,iq,ij/NP,ij%NP,k));
+    });
+    kv.team_barrier();
+    return w;
+#else
+    (void) kv; (void) buf;
+    return EVU<const Scalar[NP][NP][NUM_LEV]>(&q_g(ie,iq,0,0,0));
+#endif
+  }
+
   /* Compute pressure level increments on the FV grid given ps on the FV grid.
      Directly projecting dp_gll to dp_fv disagrees numerically with the loop in
      this subroutine. This loop is essentially how CAM computes pdel in
@@ -8,12 +8,14 @@
 #include "Hommexx_Session.hpp"
 #include "ExecSpaceDefs.hpp"
 #include "profiling.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "mpi/Comm.hpp"
 
 #include "Context.hpp"
 
 #include "vector/vector_pragmas.hpp"
 
+#include <cstdlib>
 #include <iostream>
 
 namespace Homme
@@ -90,6 +92,17 @@ void initialize_hommexx_session ()
       print_homme_config_settings ();
     }
 
+    // Autotuning of team/vector sizes of the main kernels (see TeamPolicyTuner.hpp)
+    const char* cache_file = std::getenv("HOMMEXX_TEAM_POLICY_CACHE");
+    const char* tune       = std::getenv("HOMMEXX_TEAM_POLICY_TUNE");
+    auto& tuner = Context::singleton().create_if_not_there<TeamPolicyTuner>();
+    tuner.init(comm, cache_file==nullptr ? "" : cache_file,
+               tune!=nullptr && std::string(tune)=="1");
+    if (comm.root() && tuner.enabled()) {
+      std::cout << "HOMMEXX team policy cache: " << (cache_file==nullptr ? "" : cache_file)
+                << (tuner.tuning() ? " (tuning mode)" : "") << "\n";
+    }
+
     Session::m_inited = true;
   }
 }
@@ -97,6 +110,9 @@ void initialize_hommexx_session ()
 void finalize_hommexx_session ()
 {
   if (Session::m_inited) {
+    if (Context::singleton().has<TeamPolicyTuner>()) {
+      Context::singleton().get<TeamPolicyTuner>().save();
+    }
     Context::finalize_singleton();
 
     if (Session::m_handle_kokkos) {
@@ -197,9 +197,12 @@ struct PpmVertRemap : public VertRemapAlg {
     compute_integral_bounds(kv);
   }
 
+  // RemapScalar is Scalar or StorageScalar (e.g., tracers mass). The remap
+  // itself is always computed in Real.
+  template <typename RemapScalar>
   KOKKOS_INLINE_FUNCTION
   void compute_remap_phase(KernelVariables &kv,
-                           ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]> remap_var)
+                           ExecViewUnmanaged<RemapScalar[NP][NP][NUM_LEV]> remap_var)
       const {
     // From here, we loop over tracers for only those portions which depend on
     // tracer data, which includes PPM limiting and mass accumulation
@@ -244,7 +247,7 @@ struct PpmVertRemap : public VertRemapAlg {
                   Homme::subview(m_ai, kv.team_idx, igp, jgp),
                   Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp));
 
-      compute_remap(kv,
+      compute_remap<ExecSpace, RemapScalar>(kv,
                     Homme::subview(m_kid, kv.ie, igp, jgp),
                     Homme::subview(m_z2, kv.ie, igp, jgp),
                     Homme::subview(m_parabola_coeffs, kv.team_idx, igp, jgp),
@@ -270,7 +273,7 @@ struct PpmVertRemap : public VertRemapAlg {
     return mass;
   }
 
-  template <typename ExecSpaceType = ExecSpace>
+  template <typename ExecSpaceType = ExecSpace, typename RemapScalar>
   KOKKOS_INLINE_FUNCTION
   typename std::enable_if<!Homme::OnGpu<ExecSpaceType>::value, void>::type
   compute_remap(KernelVariables &/* kv */,
@@ -279,7 +282,7 @@ struct PpmVertRemap : public VertRemapAlg {
       ExecViewUnmanaged<const Real[3][NUM_PHYSICAL_LEV]> parabola_coeffs,
       ExecViewUnmanaged<Real[_ppm_consts::MASS_O_PHYSICAL_LEV]> mass,
       ExecViewUnmanaged<const Real[_ppm_consts::DPO_PHYSICAL_LEV]> prev_dp,
-      ExecViewUnmanaged<Scalar[NUM_LEV]> remap_var) const {
+      ExecViewUnmanaged<RemapScalar[NUM_LEV]> remap_var) const {
     // Compute tracer values on the new grid by integrating from the old cell
     // bottom to the new cell interface to form a new grid mass accumulation.
     // Store the mass in the integral bounds for that level
@@ -288,7 +291,8 @@ struct PpmVertRemap : public VertRemapAlg {
     // mass this needs no normalization.
     Real mass1 = 0;
     Real mass2;
-    ExecViewUnmanaged<Real[NUM_PHYSICAL_LEV]> rvar(reinterpret_cast<Real*>(remap_var.data()));
+    using RemapReal = typename PackTraits<RemapScalar>::value_type;
+    ExecViewUnmanaged<RemapReal[NUM_PHYSICAL_LEV]> rvar(reinterpret_cast<RemapReal*>(remap_var.data()));
     for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
       const int kk_cur_lev = k_id(k);
       assert(kk_cur_lev < parabola_coeffs.extent_int(1));
@@ -306,7 +310,7 @@ struct PpmVertRemap : public VertRemapAlg {
     }
   }
 
-  template <typename ExecSpaceType = ExecSpace>
+  template <typename ExecSpaceType = ExecSpace, typename RemapScalar>
   KOKKOS_INLINE_FUNCTION
   typename std::enable_if<Homme::OnGpu<ExecSpaceType>::value, void>::type
   compute_remap(KernelVariables &kv,
@@ -315,7 +319,7 @@ struct PpmVertRemap : public VertRemapAlg {
       ExecViewUnmanaged<const Real[3][NUM_PHYSICAL_LEV]> parabola_coeffs,
       ExecViewUnmanaged<Real[_ppm_consts::MASS_O_PHYSICAL_LEV]> prev_mass,
       ExecViewUnmanaged<const Real[_ppm_consts::DPO_PHYSICAL_LEV]> prev_dp,
-      ExecViewUnmanaged<Scalar[NUM_LEV]> remap_var) const {
+      ExecViewUnmanaged<RemapScalar[NUM_LEV]> remap_var) const {
     // This duplicates work, but the parallel gain on CUDA is >> 2
     assert(VECTOR_SIZE==1);
     Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_PHYSICAL_LEV),
@@ -283,7 +283,7 @@ struct RemapFunctor : public Remapper {
 
   const ElementsState m_state;
   const HybridVCoord m_hvcoord;
-  ExecViewManaged<Scalar*[Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]> m_qdp;
+  ExecViewManaged<StorageScalar***[NP][NP][NUM_LEV]> m_qdp;
 
   ExecViewManaged<bool *> valid_layer_thickness;
   typename decltype(valid_layer_thickness)::HostMirror host_valid_input;
@@ -313,6 +313,8 @@ struct RemapFunctor : public Remapper {
    , m_tu_ne_nsr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * m_fields_provider.num_states_remap()))
    , m_tu_ne_ntr(remap_team_policy<ComputeThicknessTag>(m_state.num_elems() * num_to_remap()))
   {
+    assert(qsize <= m_qdp.extent_int(2));
+
     // Members used for sanity checks
     valid_layer_thickness = decltype(valid_layer_thickness)("Check for whether the surface thicknesses are positive",elements.num_elems());
     host_valid_input = Kokkos::create_mirror_view(valid_layer_thickness);
@@ -345,15 +347,18 @@ struct RemapFunctor : public Remapper {
   KOKKOS_INLINE_FUNCTION
   int num_to_remap() const { return m_fields_provider.num_states_remap() + m_data.qsize; }
 
+  // The tracers mass is stored as StorageScalar, while the states are Scalar,
+  // so the remap phase is dispatched here rather than returning a single view.
   KOKKOS_INLINE_FUNCTION
-  ExecViewUnmanaged<Scalar[NP][NP][NUM_LEV]>
-  get_remap_val(const KernelVariables &kv, int var) const {
+  void compute_remap_phase(KernelVariables &kv, int var) const {
     if (!nonzero_rsplit || var >= m_fields_provider.num_states_remap()) {
       if (var >= m_fields_provider.num_states_remap())
         var -= m_fields_provider.num_states_remap();
-      return Homme::subview(m_qdp, kv.ie, m_data.np1_qdp, var);
+      m_remap.template compute_remap_phase<StorageScalar>(
+          kv, Homme::subview(m_qdp, kv.ie, m_data.np1_qdp, var));
     } else {
-      return m_fields_provider.get_state(kv, m_data.np1, var);
+      m_remap.template compute_remap_phase<Scalar>(
+          kv, m_fields_provider.get_state(kv, m_data.np1, var));
     }
   }
 
@@ -418,7 +423,7 @@ struct RemapFunctor : public Remapper {
     kv.ie /= num_to_remap();
     assert(kv.ie < m_state.num_elems());
 
-    this->m_remap.compute_remap_phase(kv, get_remap_val(kv, var));
+    compute_remap_phase(kv, var);
   }
 
   KOKKOS_INLINE_FUNCTION
@@ -506,7 +511,7 @@ struct RemapFunctor : public Remapper {
     const auto tu_ne_ntr = m_tu_ne_ntr;
     const auto r = KOKKOS_LAMBDA (const TeamMember& team) {
       KernelVariables kv(team, nv, tu_ne_ntr);
-      remap.compute_remap_phase(kv, Kokkos::subview(v, kv.ie, kv.iq, ALL(), ALL(), ALL()));
+      remap.template compute_remap_phase<Scalar>(kv, Kokkos::subview(v, kv.ie, kv.iq, ALL(), ALL(), ALL()));
     };
     Kokkos::fence();
     Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nv), r);
@@ -532,7 +537,7 @@ struct RemapFunctor : public Remapper {
     const auto tu_ne_ntr = m_tu_ne_ntr;
     const auto r = KOKKOS_LAMBDA (const TeamMember& team) {
       KernelVariables kv(team, nv, tu_ne_ntr);
-      remap.compute_remap_phase(kv, Kokkos::subview(v, kv.ie, n_v, kv.iq, ALL(), ALL(), ALL()));
+      remap.template compute_remap_phase<Scalar>(kv, Kokkos::subview(v, kv.ie, n_v, kv.iq, ALL(), ALL(), ALL()));
     };
     Kokkos::fence();
     Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne*nv), r);
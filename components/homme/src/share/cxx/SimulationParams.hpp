@@ -69,6 +69,11 @@ struct SimulationParams
   // to >0 for diagnostics.
   int       internal_diagnostics_level = 0;
 
+  // If true, theta-l CAAR starts its boundary exchange after computing the
+  // elements that have connections on other ranks, and computes the remaining
+  // elements while messages are in flight.
+  bool      caar_overlap_exchange = false;
+
   // Use this member to check whether the struct has been initialized
   bool      params_set = false;
 };
@@ -113,6 +118,7 @@ inline void SimulationParams::print (std::ostream& out) {
   out << "   dp3d_thresh: " << dp3d_thresh << "\n";
   out << "   vtheta_thresh: " << vtheta_thresh << "\n";
   out << "   internal_diagnostics_level: " << internal_diagnostics_level << "\n";
+  out << "   caar_overlap_exchange: " << (caar_overlap_exchange ? "yes" : "no") << "\n";
   out << "\n**********************************************************\n";
 }
 
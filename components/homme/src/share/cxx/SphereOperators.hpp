@@ -549,12 +549,13 @@ public:
     divergence_sphere_cm<CM, InputProvider, NUM_LEV_OUT>(kv, v, div_v, alpha, beta, NUM_LEV_REQUEST);
   }
 
-  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT>
+  // QdpView is a [NP][NP][NUM_LEV_IN] view of either Scalar or StorageScalar.
+  template<int NUM_LEV_OUT, int NUM_LEV_IN = NUM_LEV_OUT, int NUM_LEV_REQUEST = NUM_LEV_OUT, typename QdpView>
   KOKKOS_INLINE_FUNCTION void
   divergence_sphere_update (const KernelVariables &kv,
                             const Real alpha, const bool add_hyperviscosity,
                             const typename ViewConst<ExecViewUnmanaged<Scalar [2][NP][NP][NUM_LEV_IN]>>::type& vstar,
-                            const typename ViewConst<ExecViewUnmanaged<Scalar    [NP][NP][NUM_LEV_IN]>>::type& qdp,
+                            const QdpView& qdp,
                             // On input, qtens_biharmonic if add_hyperviscosity, undefined
                             // if not; on output, qtens.
                             const ExecViewUnmanaged<Scalar [NP][NP][NUM_LEV_OUT]>& qtens) const
@@ -575,7 +576,7 @@ public:
       const int igp = loop_idx / NP;
       const int jgp = loop_idx % NP;
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team, NUM_LEV_REQUEST), [&] (const int& ilev) {
-        const auto& qdpijk = qdp(igp, jgp, ilev);
+        const Scalar& qdpijk = pack_cast<Scalar>(qdp(igp, jgp, ilev));
         const auto v0 = vstar(0, igp, jgp, ilev) * qdpijk;
         const auto v1 = vstar(1, igp, jgp, ilev) * qdpijk;
         gv(0,igp,jgp,ilev) = (D_inv(0,0,igp,jgp) * v0 + D_inv(1,0,igp,jgp) * v1) * metdet(igp,jgp);
@@ -596,7 +597,7 @@ public:
           dvdy += dvv(igp, kgp) * gv(1, kgp, jgp, ilev);
         }
         const Scalar qtensijk0 = add_hyperviscosity ? qtens(igp,jgp,ilev) : 0;
-        qtens(igp,jgp,ilev) = (qdp(igp,jgp,ilev) +
+        qtens(igp,jgp,ilev) = (pack_cast<Scalar>(qdp(igp,jgp,ilev)) +
                                alpha*((dudx + dvdy) * (1.0 / metdet(igp,jgp) * m_scale_factor_inv)) +
                                qtensijk0);
       });
@@ -0,0 +1,122 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#include "TeamPolicyTuner.hpp"
+
+#include "Dimensions.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace Homme {
+
+void TeamPolicyTuner::init (const Comm& comm, const std::string& cache_file, const bool tune)
+{
+  m_mpi_comm   = comm.mpi_comm();
+  m_root       = comm.root();
+  m_cache_file = cache_file;
+  m_tune       = tune;
+  m_enabled    = tune || cache_file!="";
+  m_modified   = false;
+  m_cache.clear();
+
+  Errors::runtime_check(!tune || cache_file!="",
+      "Error! HOMMEXX_TEAM_POLICY_TUNE requires HOMMEXX_TEAM_POLICY_CACHE to be set.\n");
+
+  if (cache_file=="") {
+    return;
+  }
+
+  // The root rank reads the file, and broadcasts its content. A missing file is an empty cache.
+  std::string content;
+  if (m_root) {
+    std::ifstream ifs(cache_file);
+    if (ifs.good()) {
+      std::stringstream ss;
+      ss << ifs.rdbuf();
+      content = ss.str();
+    }
+  }
+  int size = content.size();
+  MPI_Bcast(&size,1,MPI_INT,0,m_mpi_comm);
+  content.resize(size);
+  MPI_Bcast(&content[0],size,MPI_CHAR,0,m_mpi_comm);
+
+  // Each line is: kernel arch nlev num_parallel_iterations team_size vector_size
+  std::istringstream iss(content);
+  std::string line;
+  while (std::getline(iss,line)) {
+    if (line.empty() || line[0]=='#') {
+      continue;
+    }
+    std::istringstream ls(line);
+    std::string kernel, arch;
+    int nlev, num_iters;
+    TeamSizes ts;
+    ls >> kernel >> arch >> nlev >> num_iters >> ts.team_size >> ts.vector_size;
+    Errors::runtime_check(!ls.fail() && ts.team_size>0 && ts.vector_size>0,
+        "Error! Invalid line in team policy cache file '" + cache_file + "':\n  " + line + "\n");
+
+    std::stringstream key;
+    key << kernel << " " << arch << " " << nlev << " " << num_iters;
+    m_cache[key.str()] = ts;
+  }
+}
+
+void TeamPolicyTuner::save () const
+{
+  if (!m_modified || !m_root) {
+    return;
+  }
+
+  std::ofstream ofs(m_cache_file);
+  if (!ofs.good()) {
+    // Not worth crashing the run over this
+    printf("[TeamPolicyTuner] WARNING! Could not open '%s'. Tuned team sizes are not saved.\n",
+           m_cache_file.c_str());
+    return;
+  }
+  ofs << "# HOMMEXX team policy cache\n"
+      << "# kernel arch nlev num_parallel_iterations team_size vector_size\n";
+  for (const auto& it : m_cache) {
+    ofs << it.first << " " << it.second.team_size << " " << it.second.vector_size << "\n";
+  }
+}
+
+bool TeamPolicyTuner::
+needs_tuning (const std::string& kernel, const int num_parallel_iterations) const
+{
+  if (!m_tune) {
+    return false;
+  }
+  return m_cache.find(make_key(kernel,max_over_ranks(num_parallel_iterations)))==m_cache.end();
+}
+
+std::string TeamPolicyTuner::arch ()
+{
+  // Exec space, its concurrency, and the pack size. No spaces allowed, since it is a field of the cache lines.
+  std::stringstream ss;
+  ss << ExecSpace::name() << "-" << ExecSpace().concurrency() << "-v" << VECTOR_SIZE;
+  return ss.str();
+}
+
+int TeamPolicyTuner::max_over_ranks (const int num_parallel_iterations) const
+{
+  int max_num_iters;
+  MPI_Allreduce(&num_parallel_iterations,&max_num_iters,1,MPI_INT,MPI_MAX,m_mpi_comm);
+  return max_num_iters;
+}
+
+std::string TeamPolicyTuner::
+make_key (const std::string& kernel, const int max_num_parallel_iterations) const
+{
+  std::stringstream ss;
+  ss << kernel << " " << arch() << " " << NUM_PHYSICAL_LEV << " " << max_num_parallel_iterations;
+  return ss.str();
+}
+
+} // namespace Homme
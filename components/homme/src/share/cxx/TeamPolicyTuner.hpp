@@ -0,0 +1,264 @@
+/********************************************************************************
+ * HOMMEXX 1.0: Copyright of Sandia Corporation
+ * This software is released under the BSD license
+ * See the file 'COPYRIGHT' in the HOMMEXX/src/share/cxx directory
+ *******************************************************************************/
+
+#ifndef HOMMEXX_TEAM_POLICY_TUNER_HPP
+#define HOMMEXX_TEAM_POLICY_TUNER_HPP
+
+#include "ErrorDefs.hpp"
+#include "ExecSpaceDefs.hpp"
+#include "kokkos_utils.hpp"
+#include "mpi/Comm.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Homme {
+
+// The team and vector sizes of a team policy
+struct TeamSizes {
+  int team_size;
+  int vector_size;
+};
+
+/*
+ * Copies of a set of views, which can be copied back into them. Used by
+ * TeamPolicyTuner::tune, to undo the changes of each (untimed) candidate run.
+ */
+class ViewsSnapshot {
+public:
+  template<typename ViewT>
+  void add (const ViewT& v) {
+    auto copy = Kokkos::create_mirror(typename ViewT::memory_space(), v);
+    Kokkos::deep_copy(copy, v);
+    m_restore.push_back([v,copy]() { Kokkos::deep_copy(v, copy); });
+  }
+
+  void restore () const {
+    for (const auto& f : m_restore) {
+      f();
+    }
+  }
+
+private:
+  std::vector<std::function<void()>> m_restore;
+};
+
+/*
+ * Autotuner for the team/vector sizes of the main kernels
+ *
+ * get_default_team_policy picks team and vector sizes heuristically, based on
+ * the concurrency of the exec space. For some kernels, on some architectures,
+ * these heuristics are measurably off. This class allows a functor to time
+ * a set of candidate team/vector sizes for one of its kernels, and to store
+ * the fastest in a cache, keyed by kernel name, problem size (number of levels
+ * and max number of parallel iterations across ranks), and architecture.
+ * The cache is saved to file at the end of the run, and loaded by later runs.
+ *
+ * The tuner is configured at session initialization via env variables:
+ *  - HOMMEXX_TEAM_POLICY_CACHE: the cache file. If it exists, it is loaded.
+ *  - HOMMEXX_TEAM_POLICY_TUNE: if set to 1, kernels that have no entry
+ *    in the cache are tuned at their first use, and the cache file
+ *    is written at session finalization.
+ * If neither is set, the tuner is disabled, and functors get the same team
+ * sizes as with get_default_team_policy.
+ *
+ * In tuning mode, a kernel is run several times for each candidate at its first
+ * use, on the live model state. To leave the state untouched, the caller passes
+ * a snapshot of all the views the kernel writes, which the tuner restores after
+ * each run, so that a tuned run is BFB with an untuned one.
+ *
+ * NOTE: if the tuner is enabled, get_team_sizes, needs_tuning, and tune are
+ *       collective, since the cache key uses the max problem size across ranks
+ *       (so that all ranks agree on the entry to use).
+ */
+class TeamPolicyTuner {
+public:
+
+  // A default-constructed tuner is disabled
+  TeamPolicyTuner () = default;
+
+  // Load the cache file (if not empty), and possibly enable tuning. Collective on comm.
+  void init (const Comm& comm, const std::string& cache_file, const bool tune);
+
+  // If anything was tuned, write the cache file (on the root rank).
+  void save () const;
+
+  bool enabled () const { return m_enabled; }
+  bool tuning  () const { return m_tune; }
+
+  // The team sizes to use for the given kernel: the cached ones, if any. Otherwise,
+  // the default ones, or, in tuning mode, those of the candidate that needs the
+  // most workspace slots, so that buffers sized with them fit any candidate.
+  template<typename ExeSpace>
+  TeamSizes get_team_sizes (const std::string& kernel,
+                            const int num_parallel_iterations,
+                            const ThreadPreferences tp = ThreadPreferences()) const;
+
+  template<typename PolicyType>
+  PolicyType get_team_policy (const std::string& kernel,
+                              const int num_parallel_iterations,
+                              const ThreadPreferences tp = ThreadPreferences()) const {
+    using ES = typename PolicyType::execution_space;
+    return make_team_policy<PolicyType>(num_parallel_iterations,
+                                        get_team_sizes<ES>(kernel,num_parallel_iterations,tp));
+  }
+
+  // Whether the kernel should be tuned at its first use
+  bool needs_tuning (const std::string& kernel, const int num_parallel_iterations) const;
+
+  // Call run(team_sizes) for each candidate, store the fastest in the cache, and return it.
+  // The caller is responsible for updating the TeamUtils used by the kernel inside run.
+  // The snapshot must contain all the views that run writes: it is restored after each run.
+  template<typename ExeSpace, typename RunFunc>
+  TeamSizes tune (const std::string& kernel,
+                  const int num_parallel_iterations,
+                  const ThreadPreferences tp,
+                  const RunFunc& run,
+                  const ViewsSnapshot& snapshot);
+
+  template<typename PolicyType>
+  static PolicyType make_team_policy (const int num_parallel_iterations, const TeamSizes& ts) {
+    PolicyType policy(num_parallel_iterations, ts.team_size, ts.vector_size);
+    policy.set_chunk_size(1);
+    return policy;
+  }
+
+  // A string identifying the architecture, used in the cache keys
+  static std::string arch ();
+
+private:
+
+  template<typename ExeSpace>
+  static TeamSizes default_team_sizes (const int num_parallel_iterations, const ThreadPreferences tp) {
+    const auto tv = DefaultThreadsDistribution<ExeSpace>::team_num_threads_vectors(num_parallel_iterations, tp);
+    return TeamSizes{tv.first, tv.second};
+  }
+
+  // The default team sizes come first, so that ties favor them
+  template<typename ExeSpace>
+  static std::vector<TeamSizes> candidates (const int num_parallel_iterations, const ThreadPreferences tp);
+
+  int max_over_ranks (const int num_parallel_iterations) const;
+
+  std::string make_key (const std::string& kernel, const int max_num_parallel_iterations) const;
+
+  MPI_Comm      m_mpi_comm = MPI_COMM_NULL;
+  bool          m_root     = false;
+
+  std::string   m_cache_file;
+  bool          m_enabled  = false;
+  bool          m_tune     = false;
+  bool          m_modified = false;
+
+  std::map<std::string,TeamSizes> m_cache;
+};
+
+// ================ Implementation ================= //
+
+template<typename ExeSpace>
+std::vector<TeamSizes> TeamPolicyTuner::
+candidates (const int num_parallel_iterations, const ThreadPreferences tp)
+{
+  std::vector<TeamSizes> tss;
+  tss.push_back(default_team_sizes<ExeSpace>(num_parallel_iterations,tp));
+  for (const auto& tv : DefaultThreadsDistribution<ExeSpace>::team_num_threads_vectors_candidates(tp)) {
+    if (tv.first!=tss[0].team_size || tv.second!=tss[0].vector_size) {
+      tss.push_back(TeamSizes{tv.first, tv.second});
+    }
+  }
+  return tss;
+}
+
+template<typename ExeSpace>
+TeamSizes TeamPolicyTuner::
+get_team_sizes (const std::string& kernel,
+                const int num_parallel_iterations,
+                const ThreadPreferences tp) const
+{
+  if (!m_enabled) {
+    return default_team_sizes<ExeSpace>(num_parallel_iterations,tp);
+  }
+
+  const int max_num_iters = max_over_ranks(num_parallel_iterations);
+  const auto it = m_cache.find(make_key(kernel,max_num_iters));
+  if (it!=m_cache.end()) {
+    return it->second;
+  } else if (!m_tune) {
+    return default_team_sizes<ExeSpace>(num_parallel_iterations,tp);
+  }
+
+  // This kernel will be tuned at its first use. Size the buffers for the worst case.
+  TeamSizes worst;
+  int max_slots = -1;
+  for (const auto& ts : candidates<ExeSpace>(max_num_iters,tp)) {
+    const auto policy = make_team_policy<Kokkos::TeamPolicy<ExeSpace>>(num_parallel_iterations,ts);
+    const int slots = TeamUtils<ExeSpace>(policy).get_num_ws_slots();
+    if (slots>max_slots) {
+      max_slots = slots;
+      worst = ts;
+    }
+  }
+  return worst;
+}
+
+template<typename ExeSpace, typename RunFunc>
+TeamSizes TeamPolicyTuner::
+tune (const std::string& kernel,
+      const int num_parallel_iterations,
+      const ThreadPreferences tp,
+      const RunFunc& run,
+      const ViewsSnapshot& snapshot)
+{
+  Errors::runtime_check(m_tune, "Error! TeamPolicyTuner::tune called, but tuning is not enabled.\n");
+
+  // Use the max number of iterations, so all ranks try the same candidates
+  const int max_num_iters = max_over_ranks(num_parallel_iterations);
+  const auto tss = candidates<ExeSpace>(max_num_iters,tp);
+
+  constexpr int num_reps = 3;
+  std::vector<double> times(tss.size(),0);
+  for (size_t i=0; i<tss.size(); ++i) {
+    // Warm up
+    run(tss[i]);
+    Kokkos::fence();
+    snapshot.restore();
+
+    // Only time the runs, not the restores
+    for (int rep=0; rep<num_reps; ++rep) {
+      Kokkos::fence();
+      Kokkos::Timer timer;
+      run(tss[i]);
+      Kokkos::fence();
+      times[i] += timer.seconds();
+      snapshot.restore();
+    }
+    times[i] /= num_reps;
+  }
+  Kokkos::fence();
+
+  // A candidate is only as fast as the slowest rank
+  MPI_Allreduce(MPI_IN_PLACE,times.data(),times.size(),MPI_DOUBLE,MPI_MAX,m_mpi_comm);
+
+  const int best = std::min_element(times.begin(),times.end()) - times.begin();
+  m_cache[make_key(kernel,max_num_iters)] = tss[best];
+  m_modified = true;
+
+  if (m_root) {
+    printf("[TeamPolicyTuner] %s: team size %d, vector size %d (%.3e s), default: team size %d, vector size %d (%.3e s)\n",
+           kernel.c_str(), tss[best].team_size, tss[best].vector_size, times[best],
+           tss[0].team_size, tss[0].vector_size, times[0]);
+  }
+
+  return tss[best];
+}
+
+} // namespace Homme
+
+#endif // HOMMEXX_TEAM_POLICY_TUNER_HPP
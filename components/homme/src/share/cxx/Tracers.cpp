@@ -27,13 +27,14 @@ void Tracers::init(const int num_elems, const int num_tracers)
   // Sanity check
   assert(num_elems>0);
   assert(num_tracers>=0);
+  assert(num_tracers<=QSIZE_D);
 
   ne = num_elems;
   nt = num_tracers;
 
-  qdp = decltype(qdp)("tracers mass", num_elems);
-  qtens_biharmonic = decltype(qtens_biharmonic)("qtens(_biharmonic)", num_elems);
-  qlim = decltype(qlim)("qlim", num_elems);
+  qdp = decltype(qdp)("tracers mass", num_elems,Q_NUM_TIME_LEVELS,num_tracers);
+  qtens_biharmonic = decltype(qtens_biharmonic)("qtens(_biharmonic)", num_elems,num_tracers);
+  qlim = decltype(qlim)("qlim", num_elems,num_tracers);
 
   Q = decltype(Q)("tracers concentration", num_elems,num_tracers);
   fq = decltype(fq)("fq",num_elems,num_tracers);
@@ -55,17 +56,18 @@ void Tracers::randomize(const int seed, const Real min, const Real max) {
   genRandArray(Q, engine, random_dist);
 }
 
+// The F90 array is still sized with QSIZE_D; only the first nt tracers are synced.
+// The F90 array is always in Real: with HOMMEXX_MIXED_PRECISION, qdp is
+// narrowed on pull and widened on push.
 void Tracers::pull_qdp(CF90Ptr &state_qdp) {
-  HostViewUnmanaged<
-      const Real * [Q_NUM_TIME_LEVELS][QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]>
-  state_qdp_f90(state_qdp, qdp.extent_int(0));
+  HostViewUnmanaged<const Real***[NUM_PHYSICAL_LEV][NP][NP]>
+  state_qdp_f90(state_qdp, qdp.extent_int(0), Q_NUM_TIME_LEVELS, QSIZE_D);
   sync_to_device(state_qdp_f90, qdp);
 }
 
 void Tracers::push_qdp(F90Ptr &state_qdp) const {
-  HostViewUnmanaged<
-      Real * [Q_NUM_TIME_LEVELS][QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]>
-  state_qdp_f90(state_qdp, qdp.extent_int(0));
+  HostViewUnmanaged<Real***[NUM_PHYSICAL_LEV][NP][NP]>
+  state_qdp_f90(state_qdp, qdp.extent_int(0), Q_NUM_TIME_LEVELS, QSIZE_D);
   sync_to_host(qdp, state_qdp_f90);
 }
 
@@ -34,11 +34,18 @@ struct Tracers {
 
   bool inited () const { return m_inited; }
 
-  ExecViewManaged<Scalar*[Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]> qdp;
-  ExecViewManaged<Scalar*[QSIZE_D][NP][NP][NUM_LEV]>                    qtens_biharmonic; // Also doubles as just qtens.
-  ExecViewManaged<Scalar*[QSIZE_D][2][NUM_LEV]>                         qlim;
-  ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>                    Q;
-  ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>                    fq;
+  // The tracer dimension is sized at runtime with num_tracers (rather than with
+  // QSIZE_D), so that runs with fewer tracers do not pay for the unused ones.
+  // qdp's extents are (num_elems, Q_NUM_TIME_LEVELS, num_tracers).
+  // With HOMMEXX_MIXED_PRECISION, qdp and Q are stored in single precision:
+  // kernels must convert them to Scalar (with pack_cast) before computing.
+  // This is only supported with the Eulerian transport (transport_alg = 0),
+  // since the SL transport (compose) accesses them as Real's.
+  ExecViewManaged<StorageScalar***[NP][NP][NUM_LEV]> qdp;
+  ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>  qtens_biharmonic; // Also doubles as just qtens.
+  ExecViewManaged<Scalar**[2][NUM_LEV]>       qlim;
+  ExecViewManaged<StorageScalar**[NP][NP][NUM_LEV]> Q;
+  ExecViewManaged<Scalar**[NP][NP][NUM_LEV]>  fq;
 
   HashType hash(const int qdp_time_level) const;
 
@@ -47,6 +47,62 @@ static_assert(sizeof(Scalar) > 0, "Vector type has 0 size");
 static_assert(sizeof(Scalar) == sizeof(Real[VECTOR_SIZE]), "Vector type is not correctly defined");
 static_assert(Scalar::vector_length>0, "Vector type is not correctly defined (vector_length=0)");
 
+// Storage type for fields that can be stored in single precision. Such fields
+// are only used to load/store values: kernels convert them to Scalar (see
+// pack_cast), so that all the arithmetic is still done in Real.
+#ifdef HOMMEXX_MIXED_PRECISION
+using StorageReal = float;
+#else
+using StorageReal = Real;
+#endif
+
+using StorageScalar = KokkosKernels::Batched::Experimental::Vector<
+  KokkosKernels::Batched::Experimental::VectorTag<
+    KokkosKernels::Batched::Experimental::SIMD<StorageReal, ExecSpace>, VECTOR_SIZE>>;
+
+#ifdef HOMMEXX_MIXED_PRECISION
+// Specialize PackTraits for StorageScalar (if not the same as Scalar)
+template<>
+struct PackTraits<StorageScalar> {
+  static constexpr int pack_length = StorageScalar::vector_length;
+  using value_type = StorageReal;
+};
+#endif
+
+static_assert(sizeof(StorageScalar) == sizeof(StorageReal[VECTOR_SIZE]), "Storage vector type is not correctly defined");
+
+namespace Impl {
+template<typename DstPack, typename SrcPack>
+struct PackCast {
+  static_assert(DstPack::vector_length==SrcPack::vector_length,
+                "Error! Cannot cast between packs of different length.\n");
+  KOKKOS_FORCEINLINE_FUNCTION
+  static DstPack cast (const SrcPack& src) {
+    DstPack dst;
+VECTOR_SIMD_LOOP
+    for (int i=0; i<DstPack::vector_length; ++i) {
+      dst[i] = src[i];
+    }
+    return dst;
+  }
+};
+
+// No conversion needed (e.g., StorageScalar=Scalar if HOMMEXX_MIXED_PRECISION is off)
+template<typename Pack>
+struct PackCast<Pack,Pack> {
+  KOKKOS_FORCEINLINE_FUNCTION
+  static const Pack& cast (const Pack& src) { return src; }
+};
+} // namespace Impl
+
+// Convert a pack to a pack with the same length but a different value type,
+// e.g., StorageScalar->Scalar (before computing) or Scalar->StorageScalar (before storing).
+template<typename DstPack, typename SrcPack>
+KOKKOS_FORCEINLINE_FUNCTION
+DstPack pack_cast (const SrcPack& src) {
+  return Impl::PackCast<DstPack,SrcPack>::cast(src);
+}
+
 using MemoryManaged   = Kokkos::MemoryTraits<Kokkos::Restrict>;
 using MemoryUnmanaged = Kokkos::MemoryTraits<Kokkos::Unmanaged | Kokkos::Restrict>;
 
@@ -42,6 +42,7 @@ BoundaryExchange::BoundaryExchange()
   m_num_2d_fields = 0;
   m_num_3d_fields = 0;
   m_num_3d_int_fields = 0;
+  m_num_3d_storage_fields = 0;
 
   m_connectivity    = std::shared_ptr<Connectivity>();
   m_buffers_manager = std::shared_ptr<MpiBuffersManager>();
@@ -59,6 +60,7 @@ BoundaryExchange::BoundaryExchange()
   m_cleaned_up = true;
   m_send_pending = false;
   m_recv_pending = false;
+  m_non_shared_pack_pending = false;
 
   m_diagnostics_level = 0;
 }
@@ -167,6 +169,12 @@ void BoundaryExchange::set_num_fields (const int num_1d_fields, const int num_2d
   } else {
     alloc3d(m_3d_fields, m_3d_int_fields, m_num_elems, num_3d_fields, num_3d_int_fields);
   }
+#ifdef HOMMEXX_MIXED_PRECISION
+  // Any of the 3d fields may be stored in single precision
+  m_3d_storage_fields = decltype(m_3d_storage_fields)("3d storage fields", m_num_elems, num_3d_fields);
+#else
+  m_3d_storage_fields = decltype(m_3d_storage_fields)("3d storage fields", m_num_elems, 0);
+#endif
 
   // Now we can start register fields
   m_registration_started   = true;
@@ -190,11 +198,13 @@ void BoundaryExchange::clean_up()
   m_1d_fields = decltype(m_1d_fields)("m_1d_fields", 0, 0);
   m_2d_fields = decltype(m_2d_fields)("m_2d_fields", 0, 0);
   alloc3d(m_3d_fields, m_3d_int_fields, 0, 0, 0);
+  m_3d_storage_fields = decltype(m_3d_storage_fields)("m_3d_storage_fields", 0, 0);
 
   m_num_1d_fields = 0;
   m_num_2d_fields = 0;
   m_num_3d_fields = 0;
   m_num_3d_int_fields = 0;
+  m_num_3d_storage_fields = 0;
 
   // If we clean up, we need to reset the number of fields
   m_registration_started   = false;
@@ -227,7 +237,8 @@ void BoundaryExchange::registration_completed()
   // Note: for 2d/3d fields, we have 1 Real per GP (per level, in 3d). For 1d fields,
   //       we have 2 Real per level (max and min over element).
 
-  int single_ptr_buf_size = m_num_2d_fields + m_num_3d_int_fields*NUM_LEV_P*VECTOR_SIZE;
+  int single_ptr_buf_size = m_num_2d_fields + m_num_3d_int_fields*NUM_LEV_P*VECTOR_SIZE
+                          + m_num_3d_storage_fields*NUM_LEV*VECTOR_SIZE;
   for (int i = 0; i < m_num_3d_fields; ++i)
     single_ptr_buf_size += m_3d_nlev_pack[i]*VECTOR_SIZE;
   m_elem_buf_size[etoi(ConnectionKind::CORNER)] = m_num_1d_fields*2*NUM_LEV*VECTOR_SIZE + single_ptr_buf_size * 1;
@@ -285,7 +296,7 @@ void BoundaryExchange::exchange (const ExecViewUnmanaged<const Real * [NP][NP]>*
   assert (m_exchange_type==MPI_EXCHANGE);
 
   // I am not sure why and if we could have this scenario, but just in case. I think MPI *may* go bananas in this case
-  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields+m_num_3d_storage_fields==0) {
     return;
   }
 
@@ -360,12 +371,21 @@ void BoundaryExchange::exchange_min_max ()
 #endif
 }
 
+// Whether a connection is not in the subset of connections to pack
+KOKKOS_INLINE_FUNCTION
+static bool skip_connection (const int subset, const std::uint8_t sharing) {
+  const bool shared = (sharing == etoi(ConnectionSharing::SHARED));
+  return (subset == BoundaryExchange::PACK_SHARED && !shared) ||
+         (subset == BoundaryExchange::PACK_NON_SHARED && shared);
+}
+
 static void
 pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const int num_elems, const int num_2d_fields,
+      const int subset = BoundaryExchange::PACK_ALL) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
   const int nconn = ucon.extent_int(0);
   Kokkos::parallel_for(
@@ -374,6 +394,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const int iconn = it / num_2d_fields;
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
+      if (skip_connection(subset, info.sharing))
+        return;
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                 info.sharing_local_remote_iconn :
                                 iconn);
@@ -385,14 +407,17 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
     });
 }
 
-template <int NUM_LEV_PACKS, bool partial_column=false>
+// FieldScalar is the pack type of the fields (Scalar or StorageScalar). The
+// buffers always store Scalar's.
+template <int NUM_LEV_PACKS, bool partial_column=false, typename FieldScalar=Scalar>
 static void
 pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
       const ExecViewUnmanaged<const int*> ucon_ptr,
-      const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
+      const ExecViewUnmanaged<ExecViewManaged<FieldScalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
       const int num_elems, const int num_3d_fields,
-      ExecViewManaged<int*>* nlev_packs_ = nullptr) {
+      ExecViewManaged<int*>* nlev_packs_ = nullptr,
+      const int subset = BoundaryExchange::PACK_ALL) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
   ExecViewUnmanaged<const int*> nlev_packs;
@@ -411,6 +436,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         }
         const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto& info = ucon(iconn);
+        if (skip_connection(subset, info.sharing))
+          return;
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
                                   iconn);
@@ -418,7 +445,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         const auto& sb = send_3d_buffers(ifield, buffer_iconn);
         const auto& f3 = fields_3d(info.local_lid, ifield);
         for (int k = 0; k < helpers.CONNECTION_SIZE[info.kind]; ++k)
-          sb(k, ilev) = f3(pts[k].ip, pts[k].jp, ilev);
+          sb(k, ilev) = pack_cast<Scalar>(f3(pts[k].ip, pts[k].jp, ilev));
       });
   } else {
     const auto num_parallel_iterations = num_elems*num_3d_fields;
@@ -442,6 +469,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
           const auto& info = ucon(iconn);
           assert(info.kind != etoi(ConnectionSharing::MISSING));
+          if (skip_connection(subset, info.sharing))
+            continue;
           const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                     info.sharing_local_remote_iconn :
                                     iconn);
@@ -454,7 +483,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
             [&] (const int& k) {
               auto* const sbp = &sb(k, 0);
               const auto* const f3p = &f3(pts[k].ip, pts[k].jp, 0);
-              Kokkos::parallel_for(tvr, [&] (const int& ilev) { sbp[ilev] = f3p[ilev]; });
+              Kokkos::parallel_for(tvr, [&] (const int& ilev) { sbp[ilev] = pack_cast<Scalar>(f3p[ilev]); });
             });
         }
       });
@@ -462,6 +491,55 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
 }
 
 void BoundaryExchange::pack_and_send ()
+{
+  pack_and_send(PACK_ALL);
+}
+
+void BoundaryExchange::pack_and_send_shared ()
+{
+  // Check that this object is setup to perform exchange and not exchange_min_max
+  assert (m_exchange_type==MPI_EXCHANGE);
+
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields+m_num_3d_storage_fields==0) {
+    return;
+  }
+
+  pack_and_send(PACK_SHARED);
+
+  // The local connections are packed in recv_and_unpack
+  m_non_shared_pack_pending = true;
+}
+
+void BoundaryExchange::pack_fields (const PackSubset subset)
+{
+  const auto& ucon = m_connectivity->get_d_ucon();
+  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
+  // First, pack 2d fields (if any)...
+  if (m_num_2d_fields > 0)
+    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
+         m_num_2d_fields, subset);
+  // ...then pack 3d fields (if any)...
+  if (m_num_3d_fields > 0) {
+    if (m_3d_nlev_pack_d.size() > 0)
+      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d, subset);
+    else
+      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
+                    m_num_elems, m_num_3d_fields, nullptr, subset);
+  }
+  // ...then pack 3d interface fields (if any)...
+  if (m_num_3d_int_fields > 0)
+    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
+                    m_num_elems, m_num_3d_int_fields, nullptr, subset);
+  // ...then pack 3d storage-precision fields (if any)
+  if (m_num_3d_storage_fields > 0)
+    pack<NUM_LEV, false, StorageScalar>(ucon, ucon_ptr, m_3d_storage_fields,
+                                        m_send_3d_storage_buffers, m_num_elems,
+                                        m_num_3d_storage_fields, nullptr, subset);
+  Kokkos::fence();
+}
+
+void BoundaryExchange::pack_and_send (const PackSubset subset)
 {
   tstart("be pack_and_send");
   // The registration MUST be completed by now
@@ -472,7 +550,7 @@ void BoundaryExchange::pack_and_send ()
   assert (m_exchange_type==MPI_EXCHANGE);
 
   // I am not sure why and if we could have this scenario, but just in case. I think MPI *may* go bananas in this case
-  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields+m_num_3d_storage_fields==0) {
     return;
   }
 
@@ -489,27 +567,17 @@ void BoundaryExchange::pack_and_send ()
     tstop("be build_buffer_views_and_requests");
   }
 
-  // ---- Pack ---- //
-  const auto& ucon = m_connectivity->get_d_ucon();
-  const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
-  // First, pack 2d fields (if any)...
-  if (m_num_2d_fields > 0)
-    pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
-         m_num_2d_fields);
-  // ...then pack 3d fields (if any)...
-  if (m_num_3d_fields > 0) {
-    if (m_3d_nlev_pack_d.size() > 0)
-      pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
-    else
-      pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
+  // If some process can already send me stuff while I'm still packing, that's ok.
+  // Note: if we come from 'exchange', the receives were already started.
+  if (!m_recv_pending) {
+    if ( ! m_recv_requests.empty())
+      HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                              m_connectivity->get_comm().mpi_comm());
+    m_recv_pending = true;
   }
-  // ...then pack 3d interface fields (if any)
-  if (m_num_3d_int_fields > 0)
-    pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
-                    m_num_elems, m_num_3d_int_fields);
-  Kokkos::fence();
+
+  // ---- Pack ---- //
+  pack_fields(subset);
 
   // ---- Send ---- //
   tstart("be sync_send_buffer");
@@ -529,6 +597,10 @@ void BoundaryExchange::recv_and_unpack () {
   recv_and_unpack(nullptr);
 }
 
+void BoundaryExchange::recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  recv_and_unpack(&rspheremp);
+}
+
 // assume:conn-edges-snwe
 static void
 unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
@@ -574,12 +646,30 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
   }
 }
 
+// Accumulate into a field entry. For StorageScalar fields, the sum is computed
+// in Scalar and then rounded to the storage precision.
+KOKKOS_FORCEINLINE_FUNCTION
+static void add_to (Scalar& f, const Scalar& r) { f += r; }
+template <typename FieldScalar> KOKKOS_FORCEINLINE_FUNCTION
+static void add_to (FieldScalar& f, const Scalar& r) {
+  f = pack_cast<FieldScalar>(pack_cast<Scalar>(f) + r);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static void scale (Scalar& f, const Real& a) { f *= a; }
+template <typename FieldScalar> KOKKOS_FORCEINLINE_FUNCTION
+static void scale (FieldScalar& f, const Real& a) {
+  f = pack_cast<FieldScalar>(pack_cast<Scalar>(f) * a);
+}
+
 // assume:conn-edges-snwe
-template <int NUM_LEV_PACKS, bool partial_column=false>
+// FieldScalar is the pack type of the fields (Scalar or StorageScalar). The
+// sum of the contributions is computed in Scalar.
+template <int NUM_LEV_PACKS, bool partial_column=false, typename FieldScalar=Scalar>
 static void
 unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
         const ExecViewUnmanaged<const int*> ucon_ptr,
-        const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
+        const ExecViewUnmanaged<ExecViewManaged<FieldScalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
         const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> recv_3d_buffers,
         const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp,
         const int num_elems, const int num_3d_fields,
@@ -605,15 +695,15 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
         for (int k = 0; k < NP; ++k) {
           for (const int iedge : helpers.UNPACK_EDGES_ORDER) {
             const auto& pts = helpers.CONNECTION_PTS_FWD[iedge][k];
-            f3(pts.ip, pts.jp, ilev) +=
-              recv_3d_buffers(ifield, iconn_beg + iedge)(k, ilev);
+            add_to(f3(pts.ip, pts.jp, ilev),
+                   recv_3d_buffers(ifield, iconn_beg + iedge)(k, ilev));
           }
         }
         const auto iconn_end = ucon_ptr(ie+1);
         for (int iconn = iconn_beg + 4; iconn < iconn_end; ++iconn) {
           const auto& pts = helpers.CONNECTION_PTS_FWD[ucon(iconn).local_dir][0];
-          f3(pts.ip, pts.jp, ilev) +=
-            recv_3d_buffers(ifield, iconn)(0, ilev);
+          add_to(f3(pts.ip, pts.jp, ilev),
+                 recv_3d_buffers(ifield, iconn)(0, ilev));
         }
       });
     if (rspheremp) {
@@ -627,7 +717,7 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
           const int i = (it / (NP*NUM_LEV_PACKS)) % NP;
           const int j = (it / NUM_LEV_PACKS) % NP;
           const int ilev = it % NUM_LEV_PACKS;
-          fields_3d(ie, ifield)(i, j, ilev) *= rsmp(ie, i, j);
+          scale(fields_3d(ie, ifield)(i, j, ilev), rsmp(ie, i, j));
         });
     }
   } else {
@@ -647,7 +737,7 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
           const auto& r3 = recv_3d_buffers(ifield, iconn_beg + iedge);
           auto* const f3p = &f3(ip, jp, 0);
           const auto* const r3p = &r3(k, 0);
-          Kokkos::parallel_for(tvr, [&] (const int& ilev) { f3p[ilev] += r3p[ilev]; });
+          Kokkos::parallel_for(tvr, [&] (const int& ilev) { add_to(f3p[ilev], r3p[ilev]); });
         };
         for (int k = 0; k < NP; ++k) {
           ef(0, k, 0,    k   );
@@ -662,14 +752,14 @@ unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> u
                                 helpers.CONNECTION_PTS_FWD[dir][0].jp, 0);
           assert(r3.size() > 0);
           const auto* const r3p = &r3(0, 0);
-          Kokkos::parallel_for(tvr, [&] (const int& ilev) { f3p[ilev] += r3p[ilev]; });
+          Kokkos::parallel_for(tvr, [&] (const int& ilev) { add_to(f3p[ilev], r3p[ilev]); });
         }
         if (rspheremp) {
           for (int i = 0; i < NP; ++i)
             for (int j = 0; j < NP; ++j) {
               auto* const f3p = &f3(i, j, 0);
               const auto& rsmp = (*rspheremp)(ie, i, j);
-              Kokkos::parallel_for(tvr, [&] (const int& ilev) { f3p[ilev] *= rsmp; });
+              Kokkos::parallel_for(tvr, [&] (const int& ilev) { scale(f3p[ilev], rsmp); });
             }
         }
       });
@@ -689,7 +779,7 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
 
   // I am not sure why and if we could have this scenario, but just in case. I
   // think MPI *may* go bananas in this case
-  if (m_num_2d_fields+m_num_3d_fields==0) {
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_storage_fields==0) {
     return;
   }
 
@@ -708,6 +798,13 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
   }
   tstop("be recv_and_unpack book");
 
+  // If only the shared connections were packed (see pack_and_send_shared), the
+  // fields are now up to date on all elements, so pack the local connections.
+  if (m_non_shared_pack_pending) {
+    pack_fields(PACK_NON_SHARED);
+    m_non_shared_pack_pending = false;
+  }
+
   // ---- Recv ---- //
   tstart("be recv waitall");
   if ( ! m_recv_requests.empty())
@@ -737,10 +834,15 @@ void BoundaryExchange::recv_and_unpack (const ExecViewUnmanaged<const Real * [NP
       unpack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_recv_3d_buffers, rspheremp,
                       m_num_elems, m_num_3d_fields);
   }
-  // ...then unpack 3d interface fields (if any).
+  // ...then unpack 3d interface fields (if any)...
   if (m_num_3d_int_fields > 0)
     unpack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_recv_3d_int_buffers, rspheremp,
                       m_num_elems, m_num_3d_int_fields);
+  // ...then unpack 3d storage-precision fields (if any).
+  if (m_num_3d_storage_fields > 0)
+    unpack<NUM_LEV, false, StorageScalar>(ucon, ucon_ptr, m_3d_storage_fields,
+                                          m_recv_3d_storage_buffers, rspheremp,
+                                          m_num_elems, m_num_3d_storage_fields);
   Kokkos::fence();
 
   // If another BE structure starts an exchange, it has no way to check that
@@ -1061,6 +1163,8 @@ void BoundaryExchange::build_buffer_views_and_requests()
   m_recv_3d_buffers = decltype(m_recv_3d_buffers)("3d recv buffer", m_num_3d_fields, nconn);
   m_send_3d_int_buffers = decltype(m_send_3d_int_buffers)("3d interface send buffer", m_num_3d_int_fields, nconn);
   m_recv_3d_int_buffers = decltype(m_recv_3d_int_buffers)("3d interface recv buffer", m_num_3d_int_fields, nconn);
+  m_send_3d_storage_buffers = decltype(m_send_3d_storage_buffers)("3d storage send buffer", m_num_3d_storage_fields, nconn);
+  m_recv_3d_storage_buffers = decltype(m_recv_3d_storage_buffers)("3d storage recv buffer", m_num_3d_storage_fields, nconn);
   const auto h_send_1d_buffers = Kokkos::create_mirror_view(m_send_1d_buffers);
   const auto h_recv_1d_buffers = Kokkos::create_mirror_view(m_recv_1d_buffers);
   const auto h_send_2d_buffers = Kokkos::create_mirror_view(m_send_2d_buffers);
@@ -1069,6 +1173,8 @@ void BoundaryExchange::build_buffer_views_and_requests()
   const auto h_recv_3d_buffers = Kokkos::create_mirror_view(m_recv_3d_buffers);
   const auto h_send_3d_int_buffers = Kokkos::create_mirror_view(m_send_3d_int_buffers);
   const auto h_recv_3d_int_buffers = Kokkos::create_mirror_view(m_recv_3d_int_buffers);
+  const auto h_send_3d_storage_buffers = Kokkos::create_mirror_view(m_send_3d_storage_buffers);
+  const auto h_recv_3d_storage_buffers = Kokkos::create_mirror_view(m_recv_3d_storage_buffers);
 
   ConnectionHelpers helpers;
   for (size_t k = 0; k < nconn; ++k) {
@@ -1112,6 +1218,16 @@ void BoundaryExchange::build_buffer_views_and_requests()
         helpers.CONNECTION_SIZE[info.kind], NUM_LEV_P);
       h_buf_offset[info.sharing] += h_increment_3d[info.kind]*NUM_LEV_P*VECTOR_SIZE;
     }
+    // The buffers of the storage-precision fields are in Scalar, like all others
+    for (int f = 0; f < m_num_3d_storage_fields; ++f) {
+      h_send_3d_storage_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
+        reinterpret_cast<Scalar*>(send_buffer.get() + h_buf_offset[info.sharing]),
+        helpers.CONNECTION_SIZE[info.kind], NUM_LEV);
+      h_recv_3d_storage_buffers(f, i) = ExecViewUnmanaged<Scalar**>(
+        reinterpret_cast<Scalar*>(recv_buffer.get() + h_buf_offset[info.sharing]),
+        helpers.CONNECTION_SIZE[info.kind], NUM_LEV);
+      h_buf_offset[info.sharing] += h_increment_3d[info.kind]*NUM_LEV*VECTOR_SIZE;
+    }
   }
   Kokkos::deep_copy(m_send_1d_buffers, h_send_1d_buffers);
   Kokkos::deep_copy(m_recv_1d_buffers, h_recv_1d_buffers);
@@ -1121,6 +1237,8 @@ void BoundaryExchange::build_buffer_views_and_requests()
   Kokkos::deep_copy(m_recv_3d_buffers, h_recv_3d_buffers);
   Kokkos::deep_copy(m_send_3d_int_buffers, h_send_3d_int_buffers);
   Kokkos::deep_copy(m_recv_3d_int_buffers, h_recv_3d_int_buffers);
+  Kokkos::deep_copy(m_send_3d_storage_buffers, h_send_3d_storage_buffers);
+  Kokkos::deep_copy(m_recv_3d_storage_buffers, h_recv_3d_storage_buffers);
 
 #ifndef NDEBUG
   // Sanity check: compute the buffers sizes for this boundary exchange, and
@@ -1275,6 +1393,8 @@ void BoundaryExchange::clear_buffer_views_and_requests ()
   m_recv_3d_buffers = decltype(m_recv_3d_buffers)("m_recv_3d_buffers", 0, 0);
   m_send_3d_int_buffers = decltype(m_send_3d_int_buffers)("m_send_3d_int_buffers", 0, 0);
   m_recv_3d_int_buffers = decltype(m_recv_3d_int_buffers)("m_recv_3d_int_buffers", 0, 0);
+  m_send_3d_storage_buffers = decltype(m_send_3d_storage_buffers)("m_send_3d_storage_buffers", 0, 0);
+  m_recv_3d_storage_buffers = decltype(m_recv_3d_storage_buffers)("m_recv_3d_storage_buffers", 0, 0);
 
   // Done
   m_buffer_views_and_requests_built = false;
@@ -91,6 +91,13 @@ class BoundaryExchange
 {
 public:
 
+  // Subsets of the connections to pack (see pack_and_send_shared)
+  enum PackSubset : int {
+    PACK_ALL,
+    PACK_SHARED,
+    PACK_NON_SHARED
+  };
+
   BoundaryExchange();
   BoundaryExchange(std::shared_ptr<Connectivity> connectivity, std::shared_ptr<MpiBuffersManager> buffers_manager);
 
@@ -107,6 +114,7 @@ public:
   void set_buffers_manager (std::shared_ptr<MpiBuffersManager> buffers_manager);
 
   // These number refers to *scalar* fields. A 2-vector field counts as 2 fields.
+  // Note: num_3d_fields includes the StorageScalar fields (if any).
   void set_num_fields (const int num_1d_fields, const int num_2d_fields, const int num_3d_fields, const int num_3d_int_fields = 0);
 
   // Clean up MPI stuff and registered fields (but leaves connectivity and buffers manager)
@@ -181,9 +189,21 @@ public:
                                >::type field,
         int num_dims, int start_dim, int nlev);
 
+#ifdef HOMMEXX_MIXED_PRECISION
+  // 3d fields stored in single precision (see StorageScalar). They are exchanged
+  // in Real: values are widened when packed, and the sum of the contributions
+  // is narrowed when unpacked. Only full columns (NUM_LEV) are supported.
+  template<typename... Properties>
+  void register_field (ExecView<StorageScalar***[NP][NP][NUM_LEV], Properties...> field, int idim_out, int num_dims, int start_dim);
+  template<typename... Properties>
+  void register_field (ExecView<StorageScalar**[NP][NP][NUM_LEV], Properties...> field, int num_dims, int start_dim);
+#endif
+
   // This registration method should be used for the exchange of min/max fields
   template<int DIM, typename... Properties>
   void register_min_max_fields (ExecView<Scalar*[DIM][2][NUM_LEV], Properties...> field_min_max, int num_dims, int start_dim);
+  template<typename... Properties>
+  void register_min_max_fields (ExecView<Scalar**[2][NUM_LEV], Properties...> field_min_max, int num_dims, int start_dim);
 
   // Size the buffers, and initialize the MPI types
   void registration_completed();
@@ -199,6 +219,7 @@ public:
   int get_num_1d_fields () const { return m_num_1d_fields; }
   int get_num_2d_fields () const { return m_num_2d_fields; }
   int get_num_3d_fields () const { return m_num_3d_fields; }
+  int get_num_3d_storage_fields () const { return m_num_3d_storage_fields; }
   int get_num_3d_int_fields () const { return m_num_3d_int_fields; }
 
   template<typename ptr_type, typename raw_type>
@@ -218,6 +239,14 @@ public:
   // Perform the pack_and_send and recv_and_unpack for boundary exchange of 2d/3d fields
   void pack_and_send ();
   void recv_and_unpack ();
+  void recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
+  // Start the receives, then pack and send only the connections shared with other
+  // ranks. The local connections are packed at the beginning of recv_and_unpack.
+  // This allows to overlap communication with computation: the fields on elements
+  // with shared connections must be final when this method is called, while the
+  // other elements can be updated until recv_and_unpack is called.
+  void pack_and_send_shared ();
 
   // Perform the pack_and_send and recv_and_unpack for min/max boundary exchange of 1d fields
   void pack_and_send_min_max ();
@@ -244,6 +273,9 @@ private:
 
   void build_buffer_views_and_requests ();
 
+  void pack_and_send (const PackSubset subset);
+  void pack_fields (const PackSubset subset);
+
   std::shared_ptr<Connectivity>   m_connectivity;
 
   int                       m_elem_buf_size[2];
@@ -255,6 +287,7 @@ private:
   ExecViewManaged<ExecViewManaged<Real[NP][NP]>**>                  m_2d_fields;
   ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV]>**>       m_3d_fields;
   ExecViewManaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_P]>**>     m_3d_int_fields;
+  ExecViewManaged<ExecViewManaged<StorageScalar[NP][NP][NUM_LEV]>**> m_3d_storage_fields;
 
   // This class contains all the buffers to be stuffed in the buffers views, and used in pack/unpack,
   // as well as the mpi buffers used in MPI calls (which are the same as the former if MPIMemSpace=ExecMemSpace),
@@ -277,6 +310,10 @@ private:
 
   ExecViewManaged<ExecViewUnmanaged<Scalar**>**>            m_send_3d_buffers;
   ExecViewManaged<ExecViewUnmanaged<Scalar**>**>            m_recv_3d_buffers;
+
+  // The buffers of StorageScalar fields still hold Scalar's
+  ExecViewManaged<ExecViewUnmanaged<Scalar**>**>            m_send_3d_storage_buffers;
+  ExecViewManaged<ExecViewUnmanaged<Scalar**>**>            m_recv_3d_storage_buffers;
   
   // TODO: optimize: you only need to pack/unpack the first entry of the NUM_LEV_P-th pack.
   //       This is because, if NUM_LEV!=NUM_LEV_P, then the NUM_LEV_P-th pack contains
@@ -292,6 +329,7 @@ private:
   int         m_num_2d_fields;
   int         m_num_3d_fields;
   int         m_num_3d_int_fields;
+  int         m_num_3d_storage_fields;
 
   // The following flags are used to ensure that a bad user does not call setup/cleanup/registration
   // methods of this class in an order that generate errors. And if he/she does, we try to avoid errors.
@@ -301,6 +339,7 @@ private:
   bool        m_cleaned_up;
   bool        m_send_pending;
   bool        m_recv_pending;
+  bool        m_non_shared_pack_pending;
 
   int         m_num_elems;
 
@@ -604,6 +643,58 @@ void BoundaryExchange::register_field_impl (
   ++m_num_3d_int_fields;
 }
 
+#ifdef HOMMEXX_MIXED_PRECISION
+// --- 3d NUM_LEV fields stored in single precision --- //
+
+template<typename... Properties>
+void BoundaryExchange::register_field (ExecView<StorageScalar***[NP][NP][NUM_LEV], Properties...> field, int outer_dim, int num_dims, int start_dim)
+{
+  using Kokkos::ALL;
+
+  // Sanity checks
+  assert (m_registration_started && !m_registration_completed);
+  assert (num_dims>0 && start_dim>=0 && outer_dim>=0);
+  assert (start_dim+num_dims<=field.extent_int(2));
+  assert (m_num_3d_fields+m_num_3d_storage_fields+num_dims<=m_3d_storage_fields.extent_int(1));
+  assert (m_num_1d_fields==0);
+
+  {
+    auto l_num_3d_storage_fields = m_num_3d_storage_fields;
+    auto l_3d_storage_fields = m_3d_storage_fields;
+    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+                         KOKKOS_LAMBDA(const int ie, const int idim){
+        l_3d_storage_fields(ie, l_num_3d_storage_fields+idim) = Kokkos::subview(field, ie, outer_dim, start_dim+idim, ALL, ALL, ALL);
+    });
+  }
+
+  m_num_3d_storage_fields += num_dims;
+}
+
+template<typename... Properties>
+void BoundaryExchange::register_field (ExecView<StorageScalar**[NP][NP][NUM_LEV], Properties...> field, int num_dims, int start_dim)
+{
+  using Kokkos::ALL;
+
+  // Sanity checks
+  assert (m_registration_started && !m_registration_completed);
+  assert (num_dims>0 && start_dim>=0);
+  assert (start_dim+num_dims<=field.extent_int(1));
+  assert (m_num_3d_fields+m_num_3d_storage_fields+num_dims<=m_3d_storage_fields.extent_int(1));
+  assert (m_num_1d_fields==0);
+
+  {
+    auto l_num_3d_storage_fields = m_num_3d_storage_fields;
+    auto l_3d_storage_fields = m_3d_storage_fields;
+    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+                         KOKKOS_LAMBDA(const int ie, const int idim){
+        l_3d_storage_fields(ie, l_num_3d_storage_fields+idim) = Kokkos::subview(field, ie, start_dim+idim, ALL, ALL, ALL);
+    });
+  }
+
+  m_num_3d_storage_fields += num_dims;
+}
+#endif
+
 // --- min-max fields --- //
 
 template<int DIM, typename... Properties>
@@ -613,7 +704,29 @@ void BoundaryExchange::register_min_max_fields (ExecView<Scalar*[DIM][2][NUM_LEV
 
   // Sanity checks
   assert(m_registration_started && !m_registration_completed);
-  assert(m_num_2d_fields == 0 && m_num_3d_fields == 0);
+  assert(m_num_2d_fields == 0 && m_num_3d_fields == 0 && m_num_3d_storage_fields == 0);
+
+  {
+    auto l_num_1d_fields = m_num_1d_fields;
+    auto l_1d_fields     = m_1d_fields;
+    Kokkos::parallel_for(MDRangePolicy<ExecSpace, 2>({0, 0}, {m_connectivity->get_num_local_elements(), num_dims}, {1, 1}),
+                         KOKKOS_LAMBDA(const int ie, const int idim){
+      l_1d_fields(ie, l_num_1d_fields+idim) = Kokkos::subview(field_min_max, ie, start_dim+idim, ALL, ALL);
+    });
+  }
+
+  m_num_1d_fields += num_dims;
+}
+
+template<typename... Properties>
+void BoundaryExchange::register_min_max_fields (ExecView<Scalar**[2][NUM_LEV], Properties...> field_min_max, int num_dims, int start_dim)
+{
+  using Kokkos::ALL;
+
+  // Sanity checks
+  assert(m_registration_started && !m_registration_completed);
+  assert(m_num_2d_fields == 0 && m_num_3d_fields == 0 && m_num_3d_storage_fields == 0);
+  assert(start_dim+num_dims<=field_min_max.extent_int(1));
 
   {
     auto l_num_1d_fields = m_num_1d_fields;
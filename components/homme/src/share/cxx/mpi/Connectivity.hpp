@@ -100,6 +100,11 @@ public:
   HostViewUnmanaged<const ConnectionInfo*> get_h_ucon () const { return h_ucon; }
   HostViewUnmanaged<const int*> get_h_ucon_ptr () const { return h_ucon_ptr; }
 
+  // Local IDs of the elements with at least one connection shared with another
+  // rank (boundary elements), and of all the other ones (interior elements).
+  ExecViewUnmanaged<const int*> get_d_boundary_elems () const { return d_boundary_elems; }
+  ExecViewUnmanaged<const int*> get_d_interior_elems () const { return d_interior_elems; }
+
   // Get number of connections with given kind and sharing
   template<typename MemSpace>
   KOKKOS_INLINE_FUNCTION
@@ -156,6 +161,8 @@ private:
   ExecViewManaged<int*>::HostMirror h_ucon_ptr;
   ExecViewManaged<int*>             d_ucon_dir_ptr;
   ExecViewManaged<int*>::HostMirror h_ucon_dir_ptr;
+  ExecViewManaged<int*>             d_boundary_elems;
+  ExecViewManaged<int*>             d_interior_elems;
   // Helper used to accumulate connections during add_connection phase. Emptied
   // in finalize. l_ is local; r_ is remote.
   struct UConInfo {
@@ -167,6 +174,9 @@ private:
   // In finalize call, construct the unstructured connectivity data using
   // ucon_info.
   void setup_ucon();
+  // In finalize call, after setup_ucon, split the local elements into boundary
+  // and interior elements.
+  void setup_boundary_elems();
 };
 
 } // namespace Homme
@@ -217,7 +217,7 @@ void update_q (const int np1_qdp, const int np1)
     const int level =  idx % NUM_LEV;
 
     const Scalar dp = hyai_delta(level)*ps0 + hybi_delta(level)*ps_v(ie,np1,igp,jgp);
-    Q(ie,iq,igp,jgp,level) = qdp(ie,np1_qdp,iq,igp,jgp,level)/dp;
+    Q(ie,iq,igp,jgp,level) = pack_cast<StorageScalar>(pack_cast<Scalar>(qdp(ie,np1_qdp,iq,igp,jgp,level))/dp);
   });
 }
 
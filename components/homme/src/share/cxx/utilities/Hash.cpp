@@ -8,8 +8,9 @@
 
 namespace Homme {
 
-void hash (const int tl, const ExecViewManaged<Scalar******>& v, int n5,
-           HashType& accum_out) {
+template <typename PackType>
+static void hash_impl (const int tl, const ExecViewManaged<PackType******>& v, int n5,
+                       HashType& accum_out) {
   HashType accum;
   Kokkos::parallel_reduce(
     MDRangePolicy<ExecSpace, 6>(
@@ -17,7 +18,7 @@ void hash (const int tl, const ExecViewManaged<Scalar******>& v, int n5,
       {v.extent_int(0), tl+1, v.extent_int(2), v.extent_int(3), v.extent_int(4), n5}),
     KOKKOS_LAMBDA(int i0, int i1, int i2, int i3, int i4, int i5, HashType& accum) {
       const auto* vcol = &v(i0,i1,i2,i3,i4,0)[0];
-      Homme::hash(vcol[i5], accum);
+      Homme::hash(static_cast<double>(vcol[i5]), accum);
     }, HashReducer<>(accum));
   hash(accum, accum_out);
 }
@@ -36,8 +37,9 @@ void hash (const int tl, const ExecViewManaged<Scalar*****>& v, int n4,
   hash(accum, accum_out);
 }
 
-void hash (const ExecViewManaged<Scalar*****>& v, int n4,
-           HashType& accum_out) {
+template <typename PackType>
+static void hash_impl (const ExecViewManaged<PackType*****>& v, int n4,
+                       HashType& accum_out) {
   HashType accum;
   Kokkos::parallel_reduce(
     MDRangePolicy<ExecSpace, 5>(
@@ -45,7 +47,7 @@ void hash (const ExecViewManaged<Scalar*****>& v, int n4,
       {v.extent_int(0), v.extent_int(1), v.extent_int(2), v.extent_int(3), n4}),
     KOKKOS_LAMBDA(int i0, int i1, int i2, int i3, int i4, HashType& accum) {
       const auto* vcol = &v(i0,i1,i2,i3,0)[0];
-      Homme::hash(vcol[i4], accum);
+      Homme::hash(static_cast<double>(vcol[i4]), accum);
     }, HashReducer<>(accum));
   hash(accum, accum_out);
 }
@@ -63,4 +65,27 @@ void hash (const int tl, const ExecViewManaged<Real****>& v,
   hash(accum, accum_out);
 }
 
+void hash (const int tl, const ExecViewManaged<Scalar******>& v, int n5,
+           HashType& accum_out) {
+  hash_impl(tl, v, n5, accum_out);
+}
+
+void hash (const ExecViewManaged<Scalar*****>& v, int n4,
+           HashType& accum_out) {
+  hash_impl(v, n4, accum_out);
+}
+
+#ifdef HOMMEXX_MIXED_PRECISION
+// Values are widened to double before hashing
+void hash (const int tl, const ExecViewManaged<StorageScalar******>& v, int n5,
+           HashType& accum_out) {
+  hash_impl(tl, v, n5, accum_out);
+}
+
+void hash (const ExecViewManaged<StorageScalar*****>& v, int n4,
+           HashType& accum_out) {
+  hash_impl(v, n4, accum_out);
+}
+#endif
+
 } // Homme
@@ -46,6 +46,12 @@ void hash(const int tl, const ExecViewManaged<Real****>& v, HashType& accum);
 // No time level slot.
 void hash(const ExecViewManaged<Scalar*****>& v, HashType& accum);
 
+#ifdef HOMMEXX_MIXED_PRECISION
+// Fields stored in single precision (see StorageScalar).
+void hash(const int tl, const ExecViewManaged<StorageScalar******>& v, int n5, HashType& accum);
+void hash(const ExecViewManaged<StorageScalar*****>& v, int n4, HashType& accum);
+#endif
+
 // For Kokkos::parallel_reduce.
 template <typename ExecSpace = Kokkos::HostSpace>
 struct HashReducer {
@@ -352,6 +352,71 @@ subview(ViewType<ScalarType ** [DIM1][DIM2][DIM3][DIM4], MemSpace,
     &v_in.impl_map().reference(ie, remap_idx, idim1, idim2, 0, 0));
 }
 
+template <typename ScalarType, int DIM1, int DIM2,
+          typename MemSpace, typename... Properties>
+KOKKOS_INLINE_FUNCTION ViewUnmanaged<ScalarType[DIM1][DIM2], MemSpace>
+subview(ViewType<ScalarType ** [DIM1][DIM2], MemSpace,
+                 Properties...> v_in,
+        int ie, int idim1) {
+  assert(v_in.data() != nullptr);
+  assert(ie < v_in.extent_int(0));
+  assert(ie >= 0);
+  assert(idim1 < v_in.extent_int(1));
+  assert(idim1 >= 0);
+  return ViewUnmanaged<ScalarType[DIM1][DIM2], MemSpace>(
+    &v_in.impl_map().reference(ie, idim1, 0, 0));
+}
+
+// Views with three runtime dimensions (e.g., tracers mass, with
+// extents (num_elems, num_time_levels, num_tracers))
+template <typename ScalarType, int DIM1, int DIM2, int DIM3,
+          typename MemSpace, typename... Properties>
+KOKKOS_INLINE_FUNCTION ViewUnmanaged<ScalarType * [DIM1][DIM2][DIM3], MemSpace>
+subview(ViewType<ScalarType *** [DIM1][DIM2][DIM3], MemSpace,
+                 Properties...> v_in,
+        int ie, int idim1) {
+  assert(v_in.data() != nullptr);
+  assert(ie < v_in.extent_int(0));
+  assert(ie >= 0);
+  assert(idim1 < v_in.extent_int(1));
+  assert(idim1 >= 0);
+  return ViewUnmanaged<ScalarType * [DIM1][DIM2][DIM3], MemSpace>(
+    &v_in.impl_map().reference(ie, idim1, 0, 0, 0, 0), v_in.extent_int(2));
+}
+
+template <typename ScalarType, int DIM1, int DIM2, int DIM3,
+          typename MemSpace, typename... Properties>
+KOKKOS_INLINE_FUNCTION ViewUnmanaged<ScalarType[DIM1][DIM2][DIM3], MemSpace>
+subview(ViewType<ScalarType *** [DIM1][DIM2][DIM3], MemSpace,
+                 Properties...> v_in,
+        int ie, int idim1, int idim2) {
+  assert(v_in.data() != nullptr);
+  assert(ie < v_in.extent_int(0));
+  assert(ie >= 0);
+  assert(idim1 < v_in.extent_int(1));
+  assert(idim1 >= 0);
+  assert(idim2 < v_in.extent_int(2));
+  assert(idim2 >= 0);
+  return ViewUnmanaged<ScalarType[DIM1][DIM2][DIM3], MemSpace>(
+    &v_in.impl_map().reference(ie, idim1, idim2, 0, 0, 0));
+}
+
+template <typename ScalarType, int DIM1, int DIM2, int DIM3,
+          typename MemSpace, typename... Properties>
+KOKKOS_INLINE_FUNCTION ViewUnmanaged<ScalarType[DIM3], MemSpace>
+subview(ViewType<ScalarType *** [DIM1][DIM2][DIM3], MemSpace,
+                 Properties...> v_in,
+        int ie, int idim1, int idim2, int idim3, int idim4) {
+  assert(v_in.data() != nullptr);
+  assert(ie >= 0 && ie < v_in.extent_int(0));
+  assert(idim1 >= 0 && idim1 < v_in.extent_int(1));
+  assert(idim2 >= 0 && idim2 < v_in.extent_int(2));
+  assert(idim3 >= 0 && idim3 < v_in.extent_int(3));
+  assert(idim4 >= 0 && idim4 < v_in.extent_int(4));
+  return ViewUnmanaged<ScalarType[DIM3], MemSpace>(
+    &v_in.impl_map().reference(ie, idim1, idim2, idim3, idim4, 0));
+}
+
 // Force a subview to be const
 template<typename View, typename... Ints>
 KOKKOS_INLINE_FUNCTION
@@ -46,6 +46,8 @@ template <typename ViewT, typename ArrayT> struct host_view_mappable {
 // Despite the ugly templates, this provides much better error messages
 // These functions synchronize views from the Fortran layout to the Kernel
 // layout
+// The tracers views (Q and qdp) may be stored in single precision (see
+// StorageScalar): their values are converted to/from Real element by element.
 
 // ===================== SYNC FROM DEVICE TO HOST ============================ //
 
@@ -78,7 +80,8 @@ sync_to_host(Source_T source, Dest_T dest)
 template <typename Source_T, typename Dest_T>
 typename std::enable_if
   <
-    (exec_view_mappable<Source_T, Scalar ** [NP][NP][NUM_LEV]>::value &&
+    ((exec_view_mappable<Source_T, Scalar ** [NP][NP][NUM_LEV]>::value ||
+      exec_view_mappable<Source_T, StorageScalar ** [NP][NP][NUM_LEV]>::value) &&
      host_view_mappable<Dest_T, Real ** [NUM_PHYSICAL_LEV][NP][NP]>::value),
     void
   >::type
@@ -222,17 +225,21 @@ sync_to_host(Source_T source, Dest_T dest)
 template <typename Source_T, typename Dest_T>
 typename std::enable_if
   <
-    (exec_view_mappable<Source_T, Scalar * [Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]>::value &&
-     host_view_mappable<Dest_T, Real * [Q_NUM_TIME_LEVELS][QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]>::value),
+    ((exec_view_mappable<Source_T, Scalar *** [NP][NP][NUM_LEV]>::value ||
+      exec_view_mappable<Source_T, StorageScalar *** [NP][NP][NUM_LEV]>::value) &&
+     host_view_mappable<Dest_T, Real *** [NUM_PHYSICAL_LEV][NP][NP]>::value),
     void
   >::type
 sync_to_host(Source_T source, Dest_T dest)
 {
   typename Source_T::HostMirror source_mirror = Kokkos::create_mirror_view(source);
   Kokkos::deep_copy(source_mirror, source);
+  // The third dim is qsize in one view and qsize_d in the other,
+  // so only sync the entries they have in common.
+  const int nq = std::min(source.extent_int(2), dest.extent_int(2));
   for (int ie = 0; ie < source.extent_int(0); ++ie) {
-    for (int time = 0; time < Q_NUM_TIME_LEVELS; ++time) {
-      for (int tracer = 0; tracer < QSIZE_D; ++tracer) {
+    for (int time = 0; time < source.extent_int(1); ++time) {
+      for (int tracer = 0; tracer < nq; ++tracer) {
         for (int level = 0; level < NUM_PHYSICAL_LEV; ++level) {
           const int ilev = level / VECTOR_SIZE;
           const int ivec = level % VECTOR_SIZE;
@@ -320,7 +327,8 @@ template <typename Source_T, typename Dest_T>
 typename std::enable_if
   <
     (host_view_mappable<Source_T, Real**[NUM_PHYSICAL_LEV][NP][NP]>::value &&
-     exec_view_mappable<Dest_T, Scalar**[NP][NP][NUM_LEV]>::value),
+     (exec_view_mappable<Dest_T, Scalar**[NP][NP][NUM_LEV]>::value ||
+      exec_view_mappable<Dest_T, StorageScalar**[NP][NP][NUM_LEV]>::value)),
     void
   >::type
 sync_to_device(Source_T source, Dest_T dest) {
@@ -490,16 +498,20 @@ sync_to_device(Source_T source, Dest_T dest)
 template <typename Source_T, typename Dest_T>
 typename std::enable_if
   <
-    (host_view_mappable<Source_T,Real * [Q_NUM_TIME_LEVELS][QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]>::value &&
-     exec_view_mappable<Dest_T,Scalar * [Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]>::value),
+    (host_view_mappable<Source_T,Real *** [NUM_PHYSICAL_LEV][NP][NP]>::value &&
+     (exec_view_mappable<Dest_T,Scalar *** [NP][NP][NUM_LEV]>::value ||
+      exec_view_mappable<Dest_T,StorageScalar *** [NP][NP][NUM_LEV]>::value)),
     void
   >::type
 sync_to_device(Source_T source, Dest_T dest)
 {
   typename Dest_T::HostMirror dest_mirror = Kokkos::create_mirror_view(dest);
+  // The third dim is qsize in one view and qsize_d in the other,
+  // so only sync the entries they have in common.
+  const int nq = std::min(source.extent_int(2), dest.extent_int(2));
   for (int ie = 0; ie < source.extent_int(0); ++ie) {
-    for (int q_tl = 0; q_tl < Q_NUM_TIME_LEVELS; ++q_tl) {
-      for (int q = 0; q < QSIZE_D; ++q) {
+    for (int q_tl = 0; q_tl < dest.extent_int(1); ++q_tl) {
+      for (int q = 0; q < nq; ++q) {
         for (int level = 0; level < NUM_PHYSICAL_LEV; ++level) {
           const int ilev = level / VECTOR_SIZE;
           const int ivec = level % VECTOR_SIZE;
@@ -36,6 +36,17 @@ void genRandArray(Scalar *const x, int length, rngAlg &engine, PDF &&pdf) {
   }
 }
 
+#ifdef HOMMEXX_MIXED_PRECISION
+template <typename rngAlg, typename PDF>
+void genRandArray(StorageScalar *const x, int length, rngAlg &engine, PDF &&pdf) {
+  for (int i = 0; i < length; ++i) {
+    for (int j = 0; j < VECTOR_SIZE; ++j) {
+      x[i][j] = pdf(engine);
+    }
+  }
+}
+#endif
+
 template <typename ViewType, typename rngAlg, typename PDF>
 typename std::enable_if<Kokkos::is_view<ViewType>::value, void>::type
 genRandArray(ViewType view, rngAlg &engine, PDF &&pdf,
@@ -12,8 +12,8 @@
 
 namespace Homme {
 
-// This helper struct (and its shorter alias) simply provide
-// the map 'Scalar->Real' and 'const Scalar->const Real'
+// These helper structs (and the shorter alias) simply provide the map
+// 'Scalar->Real' and 'const Scalar->const Real' (and the same for StorageScalar)
 namespace Impl {
 template<typename In, typename Out>
 struct ConstIfConst {
@@ -23,18 +23,28 @@ struct ConstIfConst {
                   typename std::remove_const<Out>::type
                >::type;
 };
+
+// Map Scalar->Real and StorageScalar->StorageReal
+template<typename PackType>
+struct PackRealType {
+  static constexpr bool is_pack = std::is_same<PackType,Scalar>::value ||
+                                  std::is_same<PackType,StorageScalar>::value;
+  using type = typename std::conditional<std::is_same<PackType,Scalar>::value,Real,StorageReal>::type;
+};
 } // namespace Impl
 
 template<typename ScalarType>
-using RealType = typename Impl::ConstIfConst<ScalarType,Real>::type;
+using RealType = typename Impl::ConstIfConst<ScalarType,
+                   typename Impl::PackRealType<typename std::remove_const<ScalarType>::type>::type>::type;
 
 // ================ Reinterpret a view of Scalar as a view of Real ======================= //
 // Note: we template on ScalarType to allow both const and non-const, but the underlying
-//       type (the one you get with std::remove_const) *must* be Scalar (as defined in Types.hpp).
+//       type (the one you get with std::remove_const) *must* be Scalar or StorageScalar
+//       (as defined in Types.hpp). A view of StorageScalar is reinterpreted as a view of StorageReal.
 template <typename ScalarType, int DIM1, typename... Properties>
 KOKKOS_INLINE_FUNCTION
 typename
-std::enable_if<std::is_same<typename std::remove_const<ScalarType>::type,Scalar>::value,
+std::enable_if<Impl::PackRealType<typename std::remove_const<ScalarType>::type>::is_pack,
                Unmanaged<ViewType<RealType<ScalarType>[DIM1*VECTOR_SIZE],Properties...>>
               >::type
 viewAsReal(ViewType<ScalarType [DIM1], Properties...> v_in) {
@@ -46,7 +56,7 @@ viewAsReal(ViewType<ScalarType [DIM1], Properties...> v_in) {
 template <typename ScalarType, int DIM1, int DIM2, typename... Properties>
 KOKKOS_INLINE_FUNCTION
 typename
-std::enable_if<std::is_same<typename std::remove_const<ScalarType>::type,Scalar>::value,
+std::enable_if<Impl::PackRealType<typename std::remove_const<ScalarType>::type>::is_pack,
                Unmanaged<ViewType<RealType<ScalarType>[DIM1][DIM2*VECTOR_SIZE],Properties...>>
               >::type
 viewAsReal(ViewType<ScalarType [DIM1][DIM2], Properties...> v_in) {
@@ -58,7 +68,7 @@ viewAsReal(ViewType<ScalarType [DIM1][DIM2], Properties...> v_in) {
 template <typename ScalarType, int DIM1, int DIM2, int DIM3, typename... Properties>
 KOKKOS_INLINE_FUNCTION
 typename
-std::enable_if<std::is_same<typename std::remove_const<ScalarType>::type,Scalar>::value,
+std::enable_if<Impl::PackRealType<typename std::remove_const<ScalarType>::type>::is_pack,
                Unmanaged<ViewType<RealType<ScalarType>[DIM1][DIM2][DIM3*VECTOR_SIZE],Properties...>>
               >::type
 viewAsReal(ViewType<ScalarType [DIM1][DIM2][DIM3], Properties...> v_in) {
@@ -70,7 +80,7 @@ viewAsReal(ViewType<ScalarType [DIM1][DIM2][DIM3], Properties...> v_in) {
 template <typename ScalarType, int DIM1, int DIM2, int DIM3, int DIM4, typename... Properties>
 KOKKOS_INLINE_FUNCTION
 typename
-std::enable_if<std::is_same<typename std::remove_const<ScalarType>::type,Scalar>::value,
+std::enable_if<Impl::PackRealType<typename std::remove_const<ScalarType>::type>::is_pack,
                Unmanaged<ViewType<RealType<ScalarType>[DIM1][DIM2][DIM3][DIM4*VECTOR_SIZE],Properties...>>
               >::type
 viewAsReal(ViewType<ScalarType [DIM1][DIM2][DIM3][DIM4], Properties...> v_in) {
@@ -20,6 +20,7 @@
 #include "RKStageData.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "kokkos_utils.hpp"
 
 #include "mpi/BoundaryExchange.hpp"
@@ -31,6 +32,7 @@
 #include "ErrorDefs.hpp"
 
 #include <assert.h>
+#include <string>
 
 namespace Homme {
 
@@ -104,6 +106,7 @@ struct CaarFunctorImpl {
   SphereOperators       m_sphere_ops;
 
   struct TagPreExchange {};
+  struct TagPreExchangeElems {};
   struct TagPostExchange {};
 
   // Policies
@@ -116,11 +119,25 @@ struct CaarFunctorImpl {
 #endif
 
   TeamPolicyType<TagPreExchange>   m_policy_pre;
+  TeamSizes                        m_team_sizes;
+
+  // If m_overlap_exchange is true, the pre-exchange kernel is first run on the
+  // elements with connections shared with other ranks, then the exchange of these
+  // connections is started, and the kernel is run on the remaining elements
+  // while messages are in flight. m_elems is the list of elements of the
+  // current TagPreExchangeElems launch.
+  bool m_overlap_exchange = false;
+  ExecViewUnmanaged<const int*> m_boundary_elems;
+  ExecViewUnmanaged<const int*> m_interior_elems;
+  ExecViewUnmanaged<const int*> m_elems;
 
   Kokkos::RangePolicy<ExecSpace, TagPostExchange> m_policy_post;
 
   TeamUtils<ExecSpace> m_tu;
 
+  // Whether the team sizes of m_policy_pre are tuned at the first call to run
+  bool m_tune_policy;
+
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, NUM_TIME_LEVELS> m_bes;
 
   CaarFunctorImpl(const Elements &elements, const Tracers &/* tracers */,
@@ -141,6 +158,8 @@ struct CaarFunctorImpl {
       , m_policy_post (0,m_num_elems*NP*NP)
       , m_tu(m_policy_pre)
   {
+    init_team_policy();
+
     // Initialize equation of state
     m_eos.init(params.theta_hydrostatic_mode,m_hvcoord);
 
@@ -157,7 +176,44 @@ struct CaarFunctorImpl {
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,num_elems*NP*NP)
       , m_tu(m_policy_pre)
-  {}
+  {
+    init_team_policy();
+  }
+
+  // Use the team sizes from the team policy tuner, which are the defaults if there is no cache entry
+  void init_team_policy () {
+    const auto& tuner = Context::singleton().create_if_not_there<TeamPolicyTuner>();
+    m_team_sizes = tuner.get_team_sizes<ExecSpace>("CaarFunctor",m_num_elems);
+    m_policy_pre = TeamPolicyTuner::make_team_policy<TeamPolicyType<TagPreExchange>>(m_num_elems,m_team_sizes);
+    m_tu = TeamUtils<ExecSpace>(m_policy_pre);
+    m_tune_policy = tuner.needs_tuning("CaarFunctor",m_num_elems);
+  }
+
+  void tune_team_policy () {
+    // The pre-exchange kernel updates the np1 state and the derived quantities
+    ViewsSnapshot snapshot;
+    snapshot.add(m_state.m_v);
+    snapshot.add(m_state.m_w_i);
+    snapshot.add(m_state.m_vtheta_dp);
+    snapshot.add(m_state.m_phinh_i);
+    snapshot.add(m_state.m_dp3d);
+    snapshot.add(m_derived.m_omega_p);
+    snapshot.add(m_derived.m_vn0);
+    snapshot.add(m_derived.m_eta_dot_dpdn);
+
+    auto& tuner = Context::singleton().get<TeamPolicyTuner>();
+    const auto ts = tuner.tune<ExecSpace>("CaarFunctor",m_num_elems,ThreadPreferences(),
+                                          [&](const TeamSizes& candidate) {
+      m_policy_pre = TeamPolicyTuner::make_team_policy<TeamPolicyType<TagPreExchange>>(m_num_elems,candidate);
+      m_tu = TeamUtils<ExecSpace>(m_policy_pre);
+      int nerr;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+    }, snapshot);
+    m_team_sizes = ts;
+    m_policy_pre = TeamPolicyTuner::make_team_policy<TeamPolicyType<TagPreExchange>>(m_num_elems,ts);
+    m_tu = TeamUtils<ExecSpace>(m_policy_pre);
+    m_tune_policy = false;
+  }
 
   void setup (const Elements &elements, const Tracers &/*tracers*/,
               const ReferenceElement &ref_FE, const HybridVCoord &hvcoord,
@@ -299,6 +355,11 @@ struct CaarFunctorImpl {
 
   void init_boundary_exchanges (const std::shared_ptr<MpiBuffersManager>& bm_exchange) {
     const auto& sp = Context::singleton().get<SimulationParams>();
+
+    // Overlap of the exchange with the computation on interior elements.
+    // Results are BFB with the non-overlapped version.
+    set_overlap_exchange(sp.caar_overlap_exchange);
+
     for (int tl=0; tl<NUM_TIME_LEVELS; ++tl) {
       m_bes[tl] = std::make_shared<BoundaryExchange>();
       auto& be = *m_bes[tl];
@@ -325,6 +386,17 @@ struct CaarFunctorImpl {
     }
   }
 
+  // Note: the halo is still one element deep, with one exchange per RK stage;
+  //       only its latency is hidden behind the interior elements.
+  void set_overlap_exchange (const bool overlap) {
+    m_overlap_exchange = overlap;
+    if (m_overlap_exchange) {
+      const auto& connectivity = Context::singleton().get<Connectivity>();
+      m_boundary_elems = connectivity.get_d_boundary_elems();
+      m_interior_elems = connectivity.get_d_interior_elems();
+    }
+  }
+
   void set_rk_stage_data (const RKStageData& data) {
     m_data = data;
 
@@ -343,20 +415,28 @@ struct CaarFunctorImpl {
 
     set_rk_stage_data(data);
 
+    if (m_tune_policy) {
+      tune_team_policy();
+    }
+
     profiling_resume();
 
-    GPTLstart("caar compute");
-    int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
-    Kokkos::fence();
-    GPTLstop("caar compute");
-    if (nerr > 0)
-      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+    if (m_overlap_exchange) {
+      run_overlapped(data);
+    } else {
+      GPTLstart("caar compute");
+      int nerr;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+      Kokkos::fence();
+      GPTLstop("caar compute");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
 
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    Kokkos::fence();
-    GPTLstop("caar_bexchV");
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    }
 
     if (!m_theta_hydrostatic_mode) {
       GPTLstart("caar compute");
@@ -370,12 +450,65 @@ struct CaarFunctorImpl {
     profiling_pause();
   }
 
+  void run_overlapped (const RKStageData& data)
+  {
+    // The launches on the subsets use the same team sizes as m_policy_pre,
+    // so that m_tu (and the buffers sized with it) are valid for them.
+    const auto& ts = m_team_sizes;
+    using PolicyType = TeamPolicyType<TagPreExchangeElems>;
+
+    // Boundary elements first, so their connections can be sent ASAP
+    GPTLstart("caar compute");
+    int nerr_boundary = 0;
+    m_elems = m_boundary_elems;
+    if (m_elems.size()>0) {
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange (boundary elems)",
+                              TeamPolicyTuner::make_team_policy<PolicyType>(m_elems.extent_int(0),ts),
+                              *this, nerr_boundary);
+    }
+    Kokkos::fence();
+    GPTLstop("caar compute");
+
+    GPTLstart("caar_bexchV");
+    m_bes[data.np1]->pack_and_send_shared();
+    GPTLstop("caar_bexchV");
+
+    GPTLstart("caar compute");
+    int nerr_interior = 0;
+    m_elems = m_interior_elems;
+    if (m_elems.size()>0) {
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange (interior elems)",
+                              TeamPolicyTuner::make_team_policy<PolicyType>(m_elems.extent_int(0),ts),
+                              *this, nerr_interior);
+    }
+    Kokkos::fence();
+    GPTLstop("caar compute");
+    if (nerr_boundary+nerr_interior > 0)
+      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+
+    GPTLstart("caar_bexchV");
+    m_bes[data.np1]->recv_and_unpack(m_geometry.m_rspheremp);
+    Kokkos::fence();
+    GPTLstop("caar_bexchV");
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagPreExchange&, const TeamMember &team, int& nerr) const {
-    // In this body, we use '====' to separate sync epochs (delimited by barriers)
-    // Note: make sure the same temp is not used within each epoch!
+    KernelVariables kv(team, m_tu);
+    compute_pre_exchange(kv, nerr);
+  }
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagPreExchangeElems&, const TeamMember &team, int& nerr) const {
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elems(team.league_rank());
+    compute_pre_exchange(kv, nerr);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void compute_pre_exchange (const KernelVariables& kv, int& nerr) const {
+    // In this body, we use '====' to separate sync epochs (delimited by barriers)
+    // Note: make sure the same temp is not used within each epoch!
 
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);
@@ -32,7 +32,7 @@ public:
     if (use_moisture) {
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
                            [&](const int ilev) {
-        R(ilev) = (Rgas + (Rwater_vapor-Rgas)*Q(ilev));
+        R(ilev) = (Rgas + (Rwater_vapor-Rgas)*pack_cast<Scalar>(Q(ilev)));
       });
     } else {
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
@@ -262,11 +262,11 @@ public:
   KOKKOS_INLINE_FUNCTION
   Real compute_fqdt (const int& k,
                      const ExecViewUnmanaged<Scalar[NUM_LEV]>& fq,
-                     const ExecViewUnmanaged<Scalar[NUM_LEV]>& qdp) const {
+                     const ExecViewUnmanaged<StorageScalar[NUM_LEV]>& qdp) const {
     const int ilev = k / VECTOR_SIZE;
     const int ivec = k % VECTOR_SIZE;
     Real fqdt = m_dt * fq(ilev)[ivec];
-    const Real& qdp_s = qdp(ilev)[ivec];
+    const Real qdp_s = qdp(ilev)[ivec];
     if (qdp_s + fqdt < 0.0 && fqdt < 0.0) {
       if (qdp_s < 0.0) {
         fqdt = 0.0;
@@ -280,9 +280,9 @@ public:
   KOKKOS_INLINE_FUNCTION
   Scalar compute_fqdt_pack (const int& ilev,
                             const ExecViewUnmanaged<Scalar[NUM_LEV]>& fq,
-                            const ExecViewUnmanaged<Scalar[NUM_LEV]>& qdp) const {
+                            const ExecViewUnmanaged<StorageScalar[NUM_LEV]>& qdp) const {
     Scalar fqdt = m_dt * fq(ilev);
-    const Scalar& qdp_s = qdp(ilev);
+    const Scalar qdp_s = pack_cast<Scalar>(qdp(ilev));
     // NOTE: here is where masks for simd operations would be handy
     VECTOR_SIMD_LOOP
     for (int iv=0; iv<VECTOR_SIZE; ++iv) {
@@ -334,14 +334,13 @@ public:
 
       // Compute Rstar
       auto Rstar = Homme::subview(m_Rstar,kv.team_idx,igp,jgp);
-      m_elem_ops.get_R_star (kv, m_moist,
-                             (m_moist ?
-                              Homme::subview(m_tracers.Q,kv.ie,0,igp,jgp) :
-                              // If not moist, qsize might be 0, so we can't use
-                              // Q. Use Rstar as an unused argument in its
-                              // place.
-                              Rstar),
-                             Rstar);
+      if (m_moist) {
+        m_elem_ops.get_R_star (kv, m_moist, Homme::subview(m_tracers.Q,kv.ie,0,igp,jgp), Rstar);
+      } else {
+        // If not moist, qsize might be 0, so we can't use Q. Use Rstar as an
+        // unused argument in its place.
+        m_elem_ops.get_R_star (kv, m_moist, Rstar, Rstar);
+      }
 
       // Compute temperature
       auto tn1 = Homme::subview(m_tn1,kv.ie,igp,jgp);
@@ -370,7 +369,7 @@ public:
           if (!m_adjust_ps) {
             Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
                                 [&](const int ilev) {
-              dp_adj(ilev) = dp(ilev) + dp(ilev)*(fq(ilev)-q(ilev));
+              dp_adj(ilev) = dp(ilev) + dp(ilev)*(fq(ilev)-pack_cast<Scalar>(q(ilev)));
             });
           }
         } else {
@@ -413,18 +412,19 @@ public:
       auto dp_adj = Homme::subview(m_dp_adj, kv.ie,igp,jgp);
       Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
                            [&](const int ilev) {
-        Scalar& qdp_ilev = qdp(ilev);
+        Scalar qdp_ilev = pack_cast<Scalar>(qdp(ilev));
         if (m_adjustment) {
           qdp_ilev = dp(ilev)*fq(ilev);
         } else {
           qdp_ilev += compute_fqdt_pack(ilev,fq,qdp);
         }
+        qdp(ilev) = pack_cast<StorageScalar>(qdp_ilev);
 
         // Update tracers concentration
         if (m_moist) {
-          Q(ilev) = qdp_ilev/dp_adj(ilev);
+          Q(ilev) = pack_cast<StorageScalar>(qdp_ilev/dp_adj(ilev));
         } else {
-          Q(ilev) = qdp_ilev/dp(ilev);
+          Q(ilev) = pack_cast<StorageScalar>(qdp_ilev/dp(ilev));
         }
       });
     });
@@ -443,11 +443,11 @@ public:
 
       // Compute Rstar
       auto Rstar = Homme::subview(m_Rstar,kv.team_idx,igp,jgp);
-      m_elem_ops.get_R_star (kv, m_moist,
-                             (m_moist ?
-                              Homme::subview(m_tracers.Q,kv.ie,0,igp,jgp) :
-                              Rstar),
-                             Rstar);
+      if (m_moist) {
+        m_elem_ops.get_R_star (kv, m_moist, Homme::subview(m_tracers.Q,kv.ie,0,igp,jgp), Rstar);
+      } else {
+        m_elem_ops.get_R_star (kv, m_moist, Rstar, Rstar);
+      }
 
       auto tn1    = Homme::subview(m_tn1,kv.ie,igp,jgp);
       auto pnh    = Homme::subview(m_pnh,kv.ie,igp,jgp);
@@ -33,12 +33,12 @@ HyperviscosityFunctorImpl (const SimulationParams&     params,
  , m_hvcoord (Context::singleton().get<HybridVCoord>())
  , m_policy_update_states (Homme::get_default_team_policy<ExecSpace,TagUpdateStates>(m_num_elems))
  , m_policy_first_laplace (Homme::get_default_team_policy<ExecSpace,TagFirstLaplaceHV>(m_num_elems))
- , m_policy_pre_exchange (Homme::get_default_team_policy<ExecSpace, TagHyperPreExchange>(m_num_elems))
  , m_policy_nutop_laplace (Homme::get_default_team_policy<ExecSpace, TagNutopLaplace>(m_num_elems))
  , m_policy_nutop_update_states (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems))
  , m_tu(m_policy_update_states)
 {
   init_params(params);
+  init_team_policies();
 
   // Make sure the sphere operators have buffers large enough to accommodate this functor's needs
   m_sphere_ops.allocate_buffers(m_tu);
@@ -53,12 +53,51 @@ HyperviscosityFunctorImpl (const int num_elems, const SimulationParams &params)
   , m_hvcoord (Context::singleton().get<HybridVCoord>())
   , m_policy_update_states (Homme::get_default_team_policy<ExecSpace,TagUpdateStates>(m_num_elems))
   , m_policy_first_laplace (Homme::get_default_team_policy<ExecSpace,TagFirstLaplaceHV>(m_num_elems))
-  , m_policy_pre_exchange (Homme::get_default_team_policy<ExecSpace, TagHyperPreExchange>(m_num_elems))
   , m_policy_nutop_laplace (Homme::get_default_team_policy<ExecSpace, TagNutopLaplace>(m_num_elems))
   , m_policy_nutop_update_states (Homme::get_default_team_policy<ExecSpace,TagNutopUpdateStates>(m_num_elems))
   , m_tu(m_policy_update_states)
 {
   init_params(params);
+  init_team_policies();
+}
+
+void HyperviscosityFunctorImpl::init_team_policies ()
+{
+  const auto& tuner = Context::singleton().create_if_not_there<TeamPolicyTuner>();
+  m_team_sizes = tuner.get_team_sizes<ExecSpace>("HyperviscosityFunctor",m_num_elems);
+  m_tune_policies = tuner.needs_tuning("HyperviscosityFunctor",m_num_elems);
+
+  m_policy_update_states = TeamPolicyTuner::make_team_policy<decltype(m_policy_update_states)>(m_num_elems,m_team_sizes);
+  m_policy_first_laplace = TeamPolicyTuner::make_team_policy<decltype(m_policy_first_laplace)>(m_num_elems,m_team_sizes);
+  m_policy_nutop_laplace = TeamPolicyTuner::make_team_policy<decltype(m_policy_nutop_laplace)>(m_num_elems,m_team_sizes);
+  m_policy_nutop_update_states = TeamPolicyTuner::make_team_policy<decltype(m_policy_nutop_update_states)>(m_num_elems,m_team_sizes);
+  m_policy_update_first_laplace = TeamPolicyTuner::make_team_policy<decltype(m_policy_update_first_laplace)>(m_num_elems,m_team_sizes);
+  m_policy_second_laplace_const_pre_exchange  = TeamPolicyTuner::make_team_policy<decltype(m_policy_second_laplace_const_pre_exchange)>(m_num_elems,m_team_sizes);
+  m_policy_second_laplace_tensor_pre_exchange = TeamPolicyTuner::make_team_policy<decltype(m_policy_second_laplace_tensor_pre_exchange)>(m_num_elems,m_team_sizes);
+  m_policy_nutop_update_laplace = TeamPolicyTuner::make_team_policy<decltype(m_policy_nutop_update_laplace)>(m_num_elems,m_team_sizes);
+  m_tu = TeamUtils<ExecSpace>(m_policy_update_states);
+}
+
+void HyperviscosityFunctorImpl::tune_team_policies ()
+{
+  // The first laplacian subtracts the reference states from the np1 state in place
+  ViewsSnapshot snapshot;
+  snapshot.add(m_state.m_v);
+  snapshot.add(m_state.m_w_i);
+  snapshot.add(m_state.m_vtheta_dp);
+  snapshot.add(m_state.m_phinh_i);
+  snapshot.add(m_state.m_dp3d);
+
+  auto& tuner = Context::singleton().get<TeamPolicyTuner>();
+  m_team_sizes = tuner.tune<ExecSpace>("HyperviscosityFunctor",m_num_elems,ThreadPreferences(),
+                                       [&](const TeamSizes& candidate) {
+    m_policy_first_laplace = TeamPolicyTuner::make_team_policy<decltype(m_policy_first_laplace)>(m_num_elems,candidate);
+    m_tu = TeamUtils<ExecSpace>(m_policy_first_laplace);
+    Kokkos::parallel_for(m_policy_first_laplace, *this);
+  }, snapshot);
+
+  // The tuner has an entry now, so this simply picks the tuned sizes
+  init_team_policies();
 }
 
 void HyperviscosityFunctorImpl::init_params(const SimulationParams& params)
@@ -266,24 +305,47 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   });
   Kokkos::fence();
 
+  if (m_tune_policies) {
+    tune_team_policies();
+  }
+
+  // Each subcycle needs two DSS's: one after each laplacian. All the element-local
+  // work between two DSS's is done in a single launch: the state update of a subcycle
+  // is fused with the first laplacian of the next one, and the pre-exchange step is
+  // fused with the second laplacian. This is the same sequence of operations as in
+  // biharmonic_wk_theta + TagHyperPreExchange + TagUpdateStates.
+  assert (m_be->is_registration_completed());
   for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
     GPTLstart("hvf-bhwk");
-    biharmonic_wk_theta ();
-    GPTLstop("hvf-bhwk");
+    if (icycle==0) {
+      Kokkos::parallel_for(m_policy_first_laplace, *this);
+    } else {
+      Kokkos::parallel_for(m_policy_update_first_laplace, *this);
+    }
+    Kokkos::fence();
+
+    GPTLstart("hvf-bexch");
+    m_be->exchange(m_geometry.m_rspheremp);
+    GPTLstop("hvf-bexch");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
+    if ( m_data.consthv ) {
+      Kokkos::parallel_for(m_policy_second_laplace_const_pre_exchange, *this);
+    } else {
+      Kokkos::parallel_for(m_policy_second_laplace_tensor_pre_exchange, *this);
+    }
     Kokkos::fence();
+    GPTLstop("hvf-bhwk");
 
-    // Exchange
-    assert (m_be->is_registration_completed());
     GPTLstart("hvf-bexch");
     m_be->exchange();
     GPTLstop("hvf-bexch");
+  } //subcycle
 
-    // Update states
+  // Update states of the last subcycle
+  if (m_data.hypervis_subcycle > 0) {
     Kokkos::parallel_for(m_policy_update_states, *this);
     Kokkos::fence();
-  } //subcycle
+  }
 
   // Convert theta back to vtheta, and adjust w at surface
   auto geo = m_geometry;
@@ -333,17 +395,25 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
 
   // sponge layer 
   if (m_data.nu_top > 0) {
+    assert (m_be_tom->is_registration_completed());
     for (int icycle = 0; icycle < m_data.hypervis_subcycle_tom; ++icycle) {
-      // laplace(fields) --> ttens, etc.
-      Kokkos::parallel_for(m_policy_nutop_laplace, *this);
+      // laplace(fields) --> ttens, etc. The state update of the previous subcycle
+      // is fused with it.
+      if (icycle==0) {
+        Kokkos::parallel_for(m_policy_nutop_laplace, *this);
+      } else {
+        Kokkos::parallel_for(m_policy_nutop_update_laplace, *this);
+      }
       Kokkos::fence();
 
       // exchange is done on ttens, dptens, vtens, etc.
-      assert (m_be->is_registration_completed());
       GPTLstart("hvf-bexch");
       m_be_tom->exchange();
       GPTLstop("hvf-bexch");
+    }
 
+    // Update states of the last subcycle
+    if (m_data.hypervis_subcycle_tom > 0) {
       Kokkos::parallel_for(m_policy_nutop_update_states, *this);
       Kokkos::fence();
     }
@@ -367,10 +437,10 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
   // Compute second laplacian, tensor or const hv
   const int ne = m_geometry.num_elems();
   if ( m_data.consthv ) {
-    auto policy = Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceConstHV>(ne);
+    auto policy = TeamPolicyTuner::make_team_policy<Kokkos::TeamPolicy<ExecSpace,TagSecondLaplaceConstHV>>(ne,m_team_sizes);
     Kokkos::parallel_for(policy, *this);
   }else{
-    auto policy = Homme::get_default_team_policy<ExecSpace,TagSecondLaplaceTensorHV>(ne);
+    auto policy = TeamPolicyTuner::make_team_policy<Kokkos::TeamPolicy<ExecSpace,TagSecondLaplaceTensorHV>>(ne,m_team_sizes);
     Kokkos::parallel_for(policy, *this);
   }
   Kokkos::fence();
@@ -380,7 +450,26 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
 KOKKOS_INLINE_FUNCTION
 void HyperviscosityFunctorImpl::operator() (const TagNutopLaplace&, const TeamMember& team) const {
   KernelVariables kv(team, m_tu);
+  nutop_laplace(kv);
+}
+
+KOKKOS_INLINE_FUNCTION
+void HyperviscosityFunctorImpl::operator() (const TagNutopUpdateStates&, const TeamMember& team) const {
+  KernelVariables kv(team, m_tu);
+  nutop_update_states(kv);
+}
 
+KOKKOS_INLINE_FUNCTION
+void HyperviscosityFunctorImpl::operator() (const TagNutopUpdateStatesLaplace&, const TeamMember& team) const {
+  KernelVariables kv(team, m_tu);
+  nutop_update_states(kv);
+  // The laplacians need the updated states at all gll points
+  kv.team_barrier();
+  nutop_laplace(kv);
+}
+
+KOKKOS_INLINE_FUNCTION
+void HyperviscosityFunctorImpl::nutop_laplace (const KernelVariables& kv) const {
   using MidColumn = decltype(Homme::subview(m_buffers.wtens,0,0,0));
 
   // Laplacian of layer thickness
@@ -449,12 +538,10 @@ void HyperviscosityFunctorImpl::operator() (const TagNutopLaplace&, const TeamMe
 
         }); // threadvectorrange
     }); // teamthreadrange
-} // TagNutopLaplace
+} // nutop_laplace
 
 KOKKOS_INLINE_FUNCTION
-void HyperviscosityFunctorImpl::operator() (const TagNutopUpdateStates&, const TeamMember& team) const {
-  KernelVariables kv(team, m_tu);
-
+void HyperviscosityFunctorImpl::nutop_update_states (const KernelVariables& kv) const {
   using MidColumn = decltype(Homme::subview(m_buffers.wtens,0,0,0));
   using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
@@ -504,6 +591,6 @@ void HyperviscosityFunctorImpl::operator() (const TagNutopUpdateStates&, const T
       }
     }); // threadvectorrange
   }); // threadteamrange
-} // tagUpdateStates2
+} // nutop_update_states
 
 } // namespace Homme
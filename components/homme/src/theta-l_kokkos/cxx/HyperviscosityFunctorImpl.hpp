@@ -17,6 +17,7 @@
 #include "KernelVariables.hpp"
 #include "SimulationParams.hpp"
 #include "SphereOperators.hpp"
+#include "TeamPolicyTuner.hpp"
 
 #include "utilities/VectorUtils.hpp"
 
@@ -81,6 +82,11 @@ public:
   struct TagSecondLaplaceConstHV {};
   struct TagSecondLaplaceTensorHV {};
   struct TagUpdateStates {};
+  // Fused kernels, used by run() to cut the number of launches per subcycle
+  struct TagUpdateStatesFirstLaplaceHV {};
+  struct TagSecondLaplaceConstHVPreExchange {};
+  struct TagSecondLaplaceTensorHVPreExchange {};
+  struct TagNutopUpdateStatesLaplace {};
   struct TagApplyInvMass {};
   struct TagHyperPreExchange {};
   struct TagNutopUpdateStates {};
@@ -107,12 +113,92 @@ public:
 
   void biharmonic_wk_theta () const;
 
+  // Set the team sizes of all the policies from the team policy tuner (defaults, if no cache entry)
+  void init_team_policies ();
+  // Tune the team sizes, timing the first laplacian kernel (which only writes to buffers)
+  void tune_team_policies ();
+
   // first iter of laplace, const hv
   KOKKOS_INLINE_FUNCTION
   void operator() (const TagFirstLaplaceHV&, const TeamMember& team) const {
-     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
+    KernelVariables kv(team, m_tu);
+    first_laplace(kv);
+  }
+
+  // update states of the previous subcycle, then first iter of laplace of the next one
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagUpdateStatesFirstLaplaceHV&, const TeamMember& team) const {
+    KernelVariables kv(team, m_tu);
+    update_states(kv);
+    // The laplacians need the updated states at all gll points
+    kv.team_barrier();
+    first_laplace(kv);
+  }
+
+  //second iter of laplace, const hv
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagSecondLaplaceConstHV&, const TeamMember& team) const {
+    KernelVariables kv(team, m_tu);
+    second_laplace_const_hv(kv);
+  }
 
+  //second iter of laplace, tensor hv
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagSecondLaplaceTensorHV&, const TeamMember& team) const {
     KernelVariables kv(team, m_tu);
+    second_laplace_tensor_hv(kv);
+  }
+
+  //second iter of laplace, const hv, followed by the pre-exchange step
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagSecondLaplaceConstHVPreExchange&, const TeamMember& team) const {
+    KernelVariables kv(team, m_tu);
+    second_laplace_const_hv(kv);
+    kv.team_barrier();
+    hyper_pre_exchange(kv);
+  }
+
+  //second iter of laplace, tensor hv, followed by the pre-exchange step
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagSecondLaplaceTensorHVPreExchange&, const TeamMember& team) const {
+    KernelVariables kv(team, m_tu);
+    second_laplace_tensor_hv(kv);
+    kv.team_barrier();
+    hyper_pre_exchange(kv);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator() (const TagUpdateStates&, const TeamMember& team) const {
+    KernelVariables kv(team, m_tu);
+    update_states(kv);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagHyperPreExchange, const TeamMember &team) const {
+    KernelVariables kv(team, m_tu);
+    hyper_pre_exchange(kv);
+  }
+
+  // Laplace for nu_top
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagNutopLaplace&, const TeamMember& team) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagNutopUpdateStates&, const TeamMember& team) const;
+
+  // update states of the previous nu_top subcycle, then laplace of the next one
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagNutopUpdateStatesLaplace&, const TeamMember& team) const;
+
+protected:
+
+  // The bodies of the kernels above. The fused kernels call several of them in the
+  // same launch, on the same element, sharing the workspace slot of the team.
+
+  KOKKOS_INLINE_FUNCTION
+  void first_laplace (const KernelVariables& kv) const {
+    using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
+
     // Subtract the reference states from the states
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
                          [&](const int idx) {
@@ -181,19 +267,10 @@ public:
     m_sphere_ops.vlaplace_sphere_wk_contra(kv, m_data.nu_ratio1,
                               Homme::subview(m_state.m_v,kv.ie,m_data.np1),
                               Homme::subview(m_buffers.vtens,kv.ie));
-  }//TagFirstLaplaceHV
+  }//first_laplace
 
-  // Laplace for nu_top
   KOKKOS_INLINE_FUNCTION
-  void operator()(const TagNutopLaplace&, const TeamMember& team) const;
-
-  KOKKOS_INLINE_FUNCTION
-  void operator()(const TagNutopUpdateStates&, const TeamMember& team) const;
-
-  //second iter of laplace, const hv
-  KOKKOS_INLINE_FUNCTION
-  void operator() (const TagSecondLaplaceConstHV&, const TeamMember& team) const {
-    KernelVariables kv(team, m_tu);
+  void second_laplace_const_hv (const KernelVariables& kv) const {
     // Laplacian of layers thickness
     m_sphere_ops.laplace_simple(kv,
                    Homme::subview(m_buffers.dptens,kv.ie),
@@ -217,12 +294,10 @@ public:
     m_sphere_ops.vlaplace_sphere_wk_contra(kv, m_data.nu_ratio2,
                               Homme::subview(m_buffers.vtens,kv.ie),
                               Homme::subview(m_buffers.vtens,kv.ie));
-  } //tag second laplace const hv
+  } //second_laplace_const_hv
 
-  //second iter of laplace, tensor hv
   KOKKOS_INLINE_FUNCTION
-  void operator() (const TagSecondLaplaceTensorHV&, const TeamMember& team) const {
-    KernelVariables kv(team, m_tu);
+  void second_laplace_tensor_hv (const KernelVariables& kv) const {
     // Laplacian of layers thickness
     m_sphere_ops.laplace_tensor(kv,
                    Homme::subview(m_geometry.m_tensorvisc,kv.ie),
@@ -252,12 +327,10 @@ public:
                    Homme::subview(m_geometry.m_vec_sph2cart,kv.ie),
                    Homme::subview(m_buffers.vtens,kv.ie),
                    Homme::subview(m_buffers.vtens,kv.ie));
-  } //SecondLaplaceTensorHV
+  } //second_laplace_tensor_hv
 
   KOKKOS_INLINE_FUNCTION
-  void operator() (const TagUpdateStates&, const TeamMember& team) const {
-    KernelVariables kv(team, m_tu);
-
+  void update_states (const KernelVariables& kv) const {
     using MidColumn = decltype(Homme::subview(m_buffers.wtens,0,0,0));
     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
@@ -309,13 +382,12 @@ public:
         }
       });
     });
-  }  //tagupdatestates
+  }  //update_states
 
   KOKKOS_INLINE_FUNCTION
-  void operator()(const TagHyperPreExchange, const TeamMember &team) const {
+  void hyper_pre_exchange (const KernelVariables& kv) const {
     using IntColumn = decltype(Homme::subview(m_state.m_w_i,0,0,0,0));
 
-    KernelVariables kv(team, m_tu);
     Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team, NP * NP),
                          [&](const int &point_idx) {
       const int igp = point_idx / NP;
@@ -345,8 +417,10 @@ public:
           phi(ilev) += phi_ref(ilev);
         }
         if (m_data.nu_p>0) {
-          dpdiss_ave(ilev) += m_data.eta_ave_w*dp3d(ilev) / m_data.hypervis_subcycle;
-          dpdiss_bih(ilev) += m_data.eta_ave_w*dptens(ilev) / m_data.hypervis_subcycle;
+          dpdiss_ave(ilev) = pack_cast<StorageScalar>(pack_cast<Scalar>(dpdiss_ave(ilev)) +
+                                                      m_data.eta_ave_w*dp3d(ilev) / m_data.hypervis_subcycle);
+          dpdiss_bih(ilev) = pack_cast<StorageScalar>(pack_cast<Scalar>(dpdiss_bih(ilev)) +
+                                                      m_data.eta_ave_w*dptens(ilev) / m_data.hypervis_subcycle);
         }
       });
 
@@ -382,9 +456,13 @@ public:
       });//thread vector
 
     });//parallel 4
-  } //taghyperpreexchange
+  } //hyper_pre_exchange
 
-protected:
+  KOKKOS_INLINE_FUNCTION
+  void nutop_laplace (const KernelVariables& kv) const;
+
+  KOKKOS_INLINE_FUNCTION
+  void nutop_update_states (const KernelVariables& kv) const;
 
   const int             m_num_elems;
   HyperviscosityData    m_data;
@@ -402,13 +480,22 @@ protected:
   // Policies
   Kokkos::TeamPolicy<ExecSpace,TagUpdateStates>     m_policy_update_states;
   Kokkos::TeamPolicy<ExecSpace,TagFirstLaplaceHV>   m_policy_first_laplace;
-  Kokkos::TeamPolicy<ExecSpace,TagHyperPreExchange> m_policy_pre_exchange;
 
   Kokkos::TeamPolicy<ExecSpace,TagNutopLaplace>      m_policy_nutop_laplace;
   Kokkos::TeamPolicy<ExecSpace,TagNutopUpdateStates> m_policy_nutop_update_states;
 
+  // Fused policies
+  Kokkos::TeamPolicy<ExecSpace,TagUpdateStatesFirstLaplaceHV>       m_policy_update_first_laplace;
+  Kokkos::TeamPolicy<ExecSpace,TagSecondLaplaceConstHVPreExchange>  m_policy_second_laplace_const_pre_exchange;
+  Kokkos::TeamPolicy<ExecSpace,TagSecondLaplaceTensorHVPreExchange> m_policy_second_laplace_tensor_pre_exchange;
+  Kokkos::TeamPolicy<ExecSpace,TagNutopUpdateStatesLaplace>         m_policy_nutop_update_laplace;
+
   TeamUtils<ExecSpace> m_tu; // If the policies only differ by tag, just need one tu
 
+  // All the policies share m_tu, so they must share the team sizes too
+  TeamSizes m_team_sizes;
+  bool      m_tune_policies;
+
   std::shared_ptr<BoundaryExchange> m_be, m_be_tom;
 
   ExecViewManaged<Scalar[NUM_LEV]> m_nu_scale_top;
@@ -47,7 +47,8 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
                                const bool& use_cpstar, const int& transport_alg, const bool& theta_hydrostatic_mode, const char** test_case,
                                const int& dt_remap_factor, const int& dt_tracer_factor,
                                const double& scale_factor, const double& laplacian_rigid_factor, const int& nsplit, const bool& pgrad_correction,
-                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level)
+                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level,
+                               const bool& caar_overlap_exchange)
 {
   // Check that the simulation options are supported. This helps us in the future, since we
   // are currently 'assuming' some option have/not have certain values. As we support for more
@@ -124,6 +125,7 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   params.dp3d_thresh                   = dp3d_thresh;
   params.vtheta_thresh                 = vtheta_thresh;
   params.internal_diagnostics_level    = internal_diagnostics_level;
+  params.caar_overlap_exchange         = caar_overlap_exchange;
 
   if (time_step_type==5) {
     //5 stage, 3rd order, explicit
@@ -525,7 +527,7 @@ void init_elements_states_c (CF90Ptr& elem_state_v_ptr,       CF90Ptr& elem_stat
     const int jgp = (idx / NUM_LEV) % NP;
     const int k   =  idx % NUM_LEV;
 
-    q (ie,iq,igp,jgp,k) = qdp (ie,n0_qdp,iq,igp,jgp,k) / dp(ie,n0,igp,jgp,k);
+    q (ie,iq,igp,jgp,k) = pack_cast<StorageScalar>(pack_cast<Scalar>(qdp (ie,n0_qdp,iq,igp,jgp,k)) / dp(ie,n0,igp,jgp,k));
   });
 }
 
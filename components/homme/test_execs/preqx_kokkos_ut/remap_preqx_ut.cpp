@@ -46,7 +46,7 @@ TEST_CASE("remap_interface", "vertical remap") {
   }
 
   ExecViewManaged<Scalar*[NP][NP][NUM_LEV]> eta_dot_dpdn ("",num_elems);
-  ExecViewManaged<Scalar*[Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]> qdp("",num_elems);
+  ExecViewManaged<Scalar***[NP][NP][NUM_LEV]> qdp("",num_elems,Q_NUM_TIME_LEVELS,QSIZE_D);
 
   // TODO: make dt random
   constexpr int np1 = 0;
@@ -213,7 +213,12 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
       be3->pack_and_send_min_max();
       be1->pack_and_send();
       be1->recv_and_unpack();
-      be2->pack_and_send();
+      // Alternate with the split pack of shared/local connections, which must give the same result
+      if (itest % 2 == 0) {
+        be2->pack_and_send();
+      } else {
+        be2->pack_and_send_shared();
+      }
       be2->recv_and_unpack();
       be3->recv_and_unpack_min_max();
     }
@@ -13,8 +13,17 @@
 #include "utilities/Hash.hpp"
 
 #include "HybridVCoord.hpp"
-
+#include "TeamPolicyTuner.hpp"
+#include "Context.hpp"
+#include "mpi/Comm.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <random>
+#include <type_traits>
+#include <vector>
 
 using namespace Homme;
 
@@ -132,6 +141,148 @@ TEST_CASE("ExecSpaceDefs",
       REQUIRE(tv.second == c[5]);
     }
   }
+
+  SECTION("CPU/KNL candidates") {
+    for (int pool = 1; pool <= 64; ++pool) {
+      Homme::ThreadPreferences tp;
+      tp.max_vectors_usable = plev;
+      const auto tvs = Homme::Parallel::team_num_threads_vectors_candidates_from_pool(pool, tp);
+      REQUIRE(tvs.size() >= 1);
+      for (const auto& tv : tvs) {
+        REQUIRE(tv.first >= 1);
+        REQUIRE(tv.second >= 1);
+        REQUIRE(pool % tv.first == 0);
+        REQUIRE(Homme::prevpow2(tv.second) == tv.second);
+        REQUIRE(tv.first * tv.second <= pool);
+        REQUIRE(tv.first <= tp.max_threads_usable);
+        REQUIRE(tv.second <= tp.max_vectors_usable);
+      }
+    }
+  }
+
+  SECTION("GPU candidates") {
+    static const int min_warps_per_team = 4, max_warps_per_team = 16;
+    static const int num_threads_per_warp = 32;
+    Homme::ThreadPreferences tp;
+    tp.max_vectors_usable = plev;
+    const auto tvs = Homme::Parallel::team_num_threads_vectors_candidates_for_gpu(
+      num_threads_per_warp, min_warps_per_team, max_warps_per_team, tp);
+    REQUIRE(tvs.size() >= 1);
+    for (const auto& tv : tvs) {
+      REQUIRE(Homme::prevpow2(tv.second) == tv.second);
+      REQUIRE(tv.second <= num_threads_per_warp);
+      REQUIRE(tv.first <= tp.max_threads_usable);
+      if (tv.first < tp.max_threads_usable)
+        REQUIRE(tv.first * tv.second >= num_threads_per_warp*min_warps_per_team);
+      REQUIRE(tv.first * tv.second <= num_threads_per_warp*max_warps_per_team);
+      // No duplicates
+      REQUIRE(std::count(tvs.begin(), tvs.end(), tv) == 1);
+    }
+  }
+}
+
+TEST_CASE("TeamPolicyTuner", "Test the team policy cache of the tuner.") {
+  const auto& comm = Context::singleton().get<Comm>();
+  const std::string cache_file = "team_policy_tuner_ut.cache";
+  const ThreadPreferences tp;
+
+  const auto default_sizes = [&] (const int num_iters) {
+    return DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(num_iters, tp);
+  };
+  const auto same = [] (const TeamSizes& ts, const std::pair<int,int>& tv) {
+    return ts.team_size==tv.first && ts.vector_size==tv.second;
+  };
+
+  // An entry for the current architecture, one for another architecture,
+  // and one for another number of levels.
+  if (comm.root()) {
+    std::ofstream ofs(cache_file);
+    ofs << "# a comment\n"
+        << "kernel_a " << TeamPolicyTuner::arch() << " " << NUM_PHYSICAL_LEV << " 10 3 2\n"
+        << "kernel_a other_arch " << NUM_PHYSICAL_LEV << " 20 5 4\n"
+        << "kernel_a " << TeamPolicyTuner::arch() << " " << NUM_PHYSICAL_LEV+1 << " 30 7 8\n";
+  }
+  MPI_Barrier(comm.mpi_comm());
+
+  SECTION("disabled") {
+    TeamPolicyTuner tuner;
+    REQUIRE(!tuner.enabled());
+    REQUIRE(!tuner.needs_tuning("kernel_a", 10));
+    REQUIRE(same(tuner.get_team_sizes<ExecSpace>("kernel_a", 10), default_sizes(10)));
+  }
+
+  SECTION("load") {
+    TeamPolicyTuner tuner;
+    tuner.init(comm, cache_file, false);
+    REQUIRE(tuner.enabled());
+    REQUIRE(!tuner.tuning());
+
+    // The key must match kernel, arch, nlev, and number of iterations
+    const auto ts = tuner.get_team_sizes<ExecSpace>("kernel_a", 10);
+    REQUIRE(ts.team_size==3);
+    REQUIRE(ts.vector_size==2);
+    REQUIRE(same(tuner.get_team_sizes<ExecSpace>("kernel_b", 10), default_sizes(10)));
+    REQUIRE(same(tuner.get_team_sizes<ExecSpace>("kernel_a", 20), default_sizes(20)));
+    REQUIRE(same(tuner.get_team_sizes<ExecSpace>("kernel_a", 30), default_sizes(30)));
+
+    // Without tuning, nothing needs tuning
+    REQUIRE(!tuner.needs_tuning("kernel_b", 10));
+  }
+
+  SECTION("tune_and_save") {
+    const int num_iters = 16;
+    TeamSizes tuned;
+    {
+      TeamPolicyTuner tuner;
+      tuner.init(comm, cache_file, true);
+      REQUIRE(tuner.tuning());
+      REQUIRE(!tuner.needs_tuning("kernel_a", 10));
+      REQUIRE(tuner.needs_tuning("kernel_b", num_iters));
+
+      // The candidate runs update a view in place: the tuner must undo that
+      ExecViewManaged<Real*> x("x", num_iters);
+      Kokkos::deep_copy(x, 1.0);
+      ViewsSnapshot snapshot;
+      snapshot.add(x);
+
+      int num_runs = 0;
+      tuned = tuner.tune<ExecSpace>("kernel_b", num_iters, tp,
+                                    [&](const TeamSizes& ts) {
+        REQUIRE(ts.team_size>0);
+        REQUIRE(ts.vector_size>0);
+        Kokkos::parallel_for(Kokkos::RangePolicy<ExecSpace>(0, num_iters),
+                             KOKKOS_LAMBDA(const int i) { x(i) *= 2; });
+        ++num_runs;
+      }, snapshot);
+      REQUIRE(num_runs>0);
+      const auto x_h = Kokkos::create_mirror_view(x);
+      Kokkos::deep_copy(x_h, x);
+      for (int i=0; i<num_iters; ++i) {
+        REQUIRE(x_h(i)==1.0);
+      }
+      REQUIRE(!tuner.needs_tuning("kernel_b", num_iters));
+      const auto ts = tuner.get_team_sizes<ExecSpace>("kernel_b", num_iters);
+      REQUIRE(ts.team_size==tuned.team_size);
+      REQUIRE(ts.vector_size==tuned.vector_size);
+      tuner.save();
+    }
+    MPI_Barrier(comm.mpi_comm());
+
+    // The saved cache has both the old and the new entries
+    TeamPolicyTuner tuner;
+    tuner.init(comm, cache_file, false);
+    const auto ts_a = tuner.get_team_sizes<ExecSpace>("kernel_a", 10);
+    REQUIRE(ts_a.team_size==3);
+    REQUIRE(ts_a.vector_size==2);
+    const auto ts_b = tuner.get_team_sizes<ExecSpace>("kernel_b", num_iters);
+    REQUIRE(ts_b.team_size==tuned.team_size);
+    REQUIRE(ts_b.vector_size==tuned.vector_size);
+  }
+
+  MPI_Barrier(comm.mpi_comm());
+  if (comm.root()) {
+    std::remove(cache_file.c_str());
+  }
 }
 
 template <typename Dispatcher, int num_points, int scan_length>
@@ -563,3 +714,66 @@ TEST_CASE("hasher", "hasher") {
   testeq<float>();
   testeq<double>(); 
 }
+
+TEST_CASE("mixed_precision", "storage in single precision, arithmetic in double precision") {
+  // Test the single precision storage pack explicitly, so that this test is
+  // meaningful also in builds without HOMMEXX_MIXED_PRECISION.
+  using namespace KokkosKernels::Batched::Experimental;
+  using FloatScalar = Vector<VectorTag<SIMD<float, ExecSpace>, VECTOR_SIZE>>;
+  constexpr Real feps = std::numeric_limits<float>::epsilon();
+
+  std::mt19937_64 engine(42);
+  std::uniform_real_distribution<Real> dist(0.5, 2.0);
+
+  SECTION("round_trip") {
+    for (int n = 0; n < 100; ++n) {
+      Scalar x;
+      for (int i = 0; i < VECTOR_SIZE; ++i) {
+        x[i] = dist(engine);
+      }
+      const auto y = pack_cast<Scalar>(pack_cast<FloatScalar>(x));
+      const auto z = pack_cast<Scalar>(pack_cast<StorageScalar>(x));
+      for (int i = 0; i < VECTOR_SIZE; ++i) {
+        REQUIRE(std::abs(y[i] - x[i]) <= feps * std::abs(x[i]));
+        REQUIRE(std::abs(z[i] - x[i]) <= feps * std::abs(x[i]));
+        if (std::is_same<StorageReal, Real>::value) {
+          REQUIRE(z[i] == x[i]);
+        }
+      }
+    }
+  }
+
+  SECTION("accumulation") {
+    // Mimic the accumulation of a time-averaged diagnostic (e.g., dpdiss_ave) over
+    // a number of steps: the accumulator is stored in single precision, but each
+    // update is computed in double precision. The relative error should grow at
+    // most linearly with the number of updates, and the column sum (e.g., a mass)
+    // should be preserved up to single precision accuracy.
+    constexpr int num_steps = 256;
+    constexpr int num_packs = 16;
+    std::vector<Scalar>      acc_d(num_packs);
+    std::vector<FloatScalar> acc_f(num_packs);
+    const Real w = 1.0 / num_steps;
+    for (int step = 0; step < num_steps; ++step) {
+      for (int k = 0; k < num_packs; ++k) {
+        Scalar inc;
+        for (int i = 0; i < VECTOR_SIZE; ++i) {
+          inc[i] = w * dist(engine);
+        }
+        acc_d[k] += inc;
+        acc_f[k] = pack_cast<FloatScalar>(pack_cast<Scalar>(acc_f[k]) + inc);
+      }
+    }
+
+    Real sum_d = 0, sum_f = 0;
+    for (int k = 0; k < num_packs; ++k) {
+      const auto acc_fd = pack_cast<Scalar>(acc_f[k]);
+      for (int i = 0; i < VECTOR_SIZE; ++i) {
+        REQUIRE(std::abs(acc_fd[i] - acc_d[k][i]) <= num_steps * feps * acc_d[k][i]);
+        sum_d += acc_d[k][i];
+        sum_f += acc_fd[i];
+      }
+    }
+    REQUIRE(std::abs(sum_f - sum_d) <= num_steps * feps * sum_d);
+  }
+}
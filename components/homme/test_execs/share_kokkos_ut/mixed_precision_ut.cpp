@@ -0,0 +1,177 @@
+#include <catch2/catch.hpp>
+
+#include "EulerStepFunctorImpl.hpp"
+#include "PpmRemap.hpp"
+#include "utilities/SubviewUtils.hpp"
+#include "utilities/TestUtils.hpp"
+
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Homme;
+using namespace Remap;
+using namespace Ppm;
+using rngAlg = std::mt19937_64;
+
+// These tests check that the tracers mass is conserved when qdp is stored as
+// StorageScalar. If HOMMEXX_MIXED_PRECISION is off, StorageScalar=Scalar, and
+// the tolerances reduce to the usual double precision ones.
+
+static constexpr Real eps  = std::numeric_limits<Real>::epsilon();
+static constexpr Real seps = std::numeric_limits<StorageReal>::epsilon();
+
+static rngAlg get_engine () {
+  std::random_device rd;
+  const unsigned int catchRngSeed = Catch::rngSeed();
+  const unsigned int seed = catchRngSeed==0 ? rd() : catchRngSeed;
+  std::cout << "seed: " << seed << (catchRngSeed==0 ? " (catch rng seed was 0)\n" : "\n");
+  return rngAlg(seed);
+}
+
+TEST_CASE("euler_step_mass", "mixed precision") {
+  // Mimic the end of the Euler step: limit the tracers mass in Real, then
+  // store sphweights*ptens in qdp (see EulerStepFunctorImpl::apply_spheremp).
+  auto engine = get_engine();
+
+  ExecViewManaged<Real[NP][NP]> sphweights("sphweights");
+  ExecViewManaged<Scalar[NP][NP][NUM_LEV]> dpmass("dpmass"), ptens("ptens");
+  ExecViewManaged<Scalar[2][NUM_LEV]> qlim("qlim");
+  ExecViewManaged<StorageScalar[NP][NP][NUM_LEV]> qdp("qdp");
+
+  auto h_sphweights = Kokkos::create_mirror_view(sphweights);
+  auto h_dpmass = Kokkos::create_mirror_view(dpmass);
+  auto h_ptens = Kokkos::create_mirror_view(ptens);
+  auto h_qlim = Kokkos::create_mirror_view(qlim);
+  auto h_qdp = Kokkos::create_mirror_view(qdp);
+
+  genRandArray(h_sphweights, engine, std::uniform_real_distribution<Real>(1.0/16, 2.0/16));
+  genRandArray(h_dpmass, engine, std::uniform_real_distribution<Real>(0.5, 1));
+  genRandArray(h_ptens, engine, std::uniform_real_distribution<Real>(0, 1));
+
+  // Turn ptens into density, and set limits that are feasible (they contain
+  // the mass-weighted average of q) but that require the limiter to act.
+  std::vector<Real> Qmass(NUM_PHYSICAL_LEV);
+  for (int k = 0; k < NUM_PHYSICAL_LEV; ++k) {
+    const int vi = k / VECTOR_SIZE, si = k % VECTOR_SIZE;
+    Real m = 0, dpm = 0, minq = 1, maxq = 0;
+    for (int i = 0; i < NP; ++i)
+      for (int j = 0; j < NP; ++j) {
+        const Real q = h_ptens(i,j,vi)[si];
+        minq = std::min(minq, q);
+        maxq = std::max(maxq, q);
+        h_ptens(i,j,vi)[si] *= h_dpmass(i,j,vi)[si];
+        m += h_sphweights(i,j) * h_ptens(i,j,vi)[si];
+        dpm += h_sphweights(i,j) * h_dpmass(i,j,vi)[si];
+      }
+    const Real qavg = m / dpm;
+    h_qlim(0,vi)[si] = (minq + qavg) / 2;
+    h_qlim(1,vi)[si] = (maxq + qavg) / 2;
+    Qmass[k] = m;
+  }
+
+  Kokkos::deep_copy(sphweights, h_sphweights);
+  Kokkos::deep_copy(dpmass, h_dpmass);
+  Kokkos::deep_copy(ptens, h_ptens);
+  Kokkos::deep_copy(qlim, h_qlim);
+
+  Kokkos::parallel_for(get_default_team_policy<ExecSpace>(1),
+                       KOKKOS_LAMBDA(const TeamMember& team) {
+    EulerStepFunctorImpl::limiter_clip_and_sum(team, sphweights, dpmass, qlim, ptens);
+    team.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, NP*NP),
+                         [&](const int idx) {
+      const int igp = idx / NP;
+      const int jgp = idx % NP;
+      Kokkos::parallel_for(Kokkos::ThreadVectorRange(team, NUM_LEV),
+                           [&](const int& ilev) {
+        qdp(igp,jgp,ilev) = pack_cast<StorageScalar>(sphweights(igp,jgp)*ptens(igp,jgp,ilev));
+      });
+    });
+  });
+  Kokkos::deep_copy(h_qdp, qdp);
+
+  for (int k = 0; k < NUM_PHYSICAL_LEV; ++k) {
+    const int vi = k / VECTOR_SIZE, si = k % VECTOR_SIZE;
+    Real m = 0;
+    for (int i = 0; i < NP; ++i)
+      for (int j = 0; j < NP; ++j) {
+        const Real qdp_ij = h_qdp(i,j,vi)[si];
+        const Real dpw = h_sphweights(i,j)*h_dpmass(i,j,vi)[si];
+        // Check that the mixing ratio is limited, up to the storage precision.
+        REQUIRE(qdp_ij >= (1 - 1e1*eps - seps)*h_qlim(0,vi)[si]*dpw);
+        REQUIRE(qdp_ij <= (1 + 1e1*eps + seps)*h_qlim(1,vi)[si]*dpw);
+        m += qdp_ij;
+      }
+    // Check mass conservation. qdp>0, so the rounding errors of the
+    // stores add up to at most seps/2 of the mass.
+    REQUIRE(std::abs(m - Qmass[k]) <= (1e2*eps + seps)*Qmass[k]);
+  }
+}
+
+TEST_CASE("remap_mass", "mixed precision") {
+  // Remap qdp stored as StorageScalar, and check that the column mass is
+  // conserved to the storage precision.
+  constexpr int ne = 2;
+  auto engine = get_engine();
+
+  PpmVertRemap<PpmMirrored> remap(ne, 1);
+
+  ExecViewManaged<Scalar*[NP][NP][NUM_LEV]> src_dp("src_dp", ne), tgt_dp("tgt_dp", ne);
+  ExecViewManaged<StorageScalar*[NP][NP][NUM_LEV]> qdp("qdp", ne);
+
+  auto h_src_dp = Kokkos::create_mirror_view(src_dp);
+  auto h_tgt_dp = Kokkos::create_mirror_view(tgt_dp);
+  auto h_qdp = Kokkos::create_mirror_view(qdp);
+
+  genRandArray(h_src_dp, engine, std::uniform_real_distribution<Real>(0.5, 2));
+  genRandArray(h_tgt_dp, engine, std::uniform_real_distribution<Real>(0.5, 2));
+  genRandArray(h_qdp, engine, std::uniform_real_distribution<Real>(0.125, 1000));
+
+  // The two grids must span the same column.
+  HostViewManaged<Real*[NP][NP]> mass("mass", ne);
+  for (int ie = 0; ie < ne; ++ie) {
+    for (int igp = 0; igp < NP; ++igp) {
+      for (int jgp = 0; jgp < NP; ++jgp) {
+        Real src_sum = 0, tgt_sum = 0;
+        for (int k = 0; k < NUM_PHYSICAL_LEV; ++k) {
+          const int vi = k / VECTOR_SIZE, si = k % VECTOR_SIZE;
+          src_sum += h_src_dp(ie,igp,jgp,vi)[si];
+          tgt_sum += h_tgt_dp(ie,igp,jgp,vi)[si];
+          mass(ie,igp,jgp) += h_qdp(ie,igp,jgp,vi)[si];
+        }
+        for (int k = 0; k < NUM_PHYSICAL_LEV; ++k) {
+          const int vi = k / VECTOR_SIZE, si = k % VECTOR_SIZE;
+          h_tgt_dp(ie,igp,jgp,vi)[si] *= src_sum / tgt_sum;
+        }
+      }
+    }
+  }
+
+  Kokkos::deep_copy(src_dp, h_src_dp);
+  Kokkos::deep_copy(tgt_dp, h_tgt_dp);
+  Kokkos::deep_copy(qdp, h_qdp);
+
+  Kokkos::parallel_for(get_default_team_policy<ExecSpace>(ne),
+                       KOKKOS_LAMBDA(const TeamMember& team) {
+    KernelVariables kv(team);
+    remap.compute_grids_phase(kv, Homme::subview(src_dp, kv.ie),
+                                  Homme::subview(tgt_dp, kv.ie));
+    remap.compute_remap_phase<StorageScalar>(kv, Homme::subview(qdp, kv.ie));
+  });
+  Kokkos::deep_copy(h_qdp, qdp);
+
+  for (int ie = 0; ie < ne; ++ie) {
+    for (int igp = 0; igp < NP; ++igp) {
+      for (int jgp = 0; jgp < NP; ++jgp) {
+        Real m = 0;
+        for (int k = 0; k < NUM_PHYSICAL_LEV; ++k) {
+          const int vi = k / VECTOR_SIZE, si = k % VECTOR_SIZE;
+          m += h_qdp(ie,igp,jgp,vi)[si];
+        }
+        REQUIRE(std::abs(m - mass(ie,igp,jgp)) <= (1e4*eps + NUM_PHYSICAL_LEV*seps)*mass(ie,igp,jgp));
+      }
+    }
+  }
+}
@@ -7,6 +7,7 @@
 #include "CaarFunctorImpl.hpp"
 #include "SimulationParams.hpp"
 #include "Tracers.hpp"
+#include "TeamPolicyTuner.hpp"
 #include "PhysicalConstants.hpp"
 
 #include "utilities/TestUtils.hpp"
@@ -446,6 +447,333 @@ TEST_CASE("caar", "caar_testing") {
     }
   }
 
+  SECTION ("caar_overlap_bfb") {
+    // The overlapped exchange must give the same results as the default path
+    params.theta_adv_form = AdvectionForm::Conservative;
+    params.rsplit = 3;
+    params.pgrad_correction = true;
+    for (const bool hydrostatic : {true,false}) {
+      if (comm.root()) {
+        std::cout << " -> " << (hydrostatic ? "Hydrostatic\n" : "Non-Hydrostatic\n");
+      }
+      params.theta_hydrostatic_mode = hydrostatic;
+
+      Real dt = RPDF(1.0,10.0)(engine);
+      Real eta_ave_w = RPDF(0.1,1.0)(engine);
+      Real scale1 = RPDF(1.0,2.0)(engine);
+      Real scale2 = RPDF(1.0,2.0)(engine);
+      Real scale3 = RPDF(1.0,2.0)(engine);
+      int  np1 = IPDF(0,2)(engine);
+
+      auto mpi_comm = comm.mpi_comm();
+      MPI_Bcast(&dt,1,MPI_DOUBLE,0,mpi_comm);
+      MPI_Bcast(&scale1,1,MPI_DOUBLE,0,mpi_comm);
+      MPI_Bcast(&scale2,1,MPI_DOUBLE,0,mpi_comm);
+      MPI_Bcast(&scale3,1,MPI_DOUBLE,0,mpi_comm);
+      MPI_Bcast(&eta_ave_w,1,MPI_DOUBLE,0,mpi_comm);
+      MPI_Bcast(&np1,1,MPI_INT,0,mpi_comm);
+
+      const int  n0  = (np1+1)%3;
+      const int  nm1 = (np1+2)%3;
+
+      RKStageData data (nm1, n0, np1, 0, dt, eta_ave_w, scale1, scale2, scale3);
+
+      elems.m_state.randomize(seed,max_pressure,hvcoord.ps0,hvcoord.hybrid_ai0,geo.m_phis);
+      elems.m_derived.randomize(seed,dp3d_min(elems.m_state.m_dp3d));
+
+      // Save the initial state, since caar updates it in place.
+      // Note: use create_mirror, since create_mirror_view may alias the device view
+      auto& state = elems.m_state;
+      auto& derived = elems.m_derived;
+      auto dp3d_0         = Kokkos::create_mirror(state.m_dp3d);
+      auto vtheta_dp_0    = Kokkos::create_mirror(state.m_vtheta_dp);
+      auto w_i_0          = Kokkos::create_mirror(state.m_w_i);
+      auto phinh_i_0      = Kokkos::create_mirror(state.m_phinh_i);
+      auto v_0            = Kokkos::create_mirror(state.m_v);
+      auto vn0_0          = Kokkos::create_mirror(derived.m_vn0);
+      auto eta_dot_dpdn_0 = Kokkos::create_mirror(derived.m_eta_dot_dpdn);
+      auto omega_p_0      = Kokkos::create_mirror(derived.m_omega_p);
+      Kokkos::deep_copy(dp3d_0,        state.m_dp3d);
+      Kokkos::deep_copy(vtheta_dp_0,   state.m_vtheta_dp);
+      Kokkos::deep_copy(w_i_0,         state.m_w_i);
+      Kokkos::deep_copy(phinh_i_0,     state.m_phinh_i);
+      Kokkos::deep_copy(v_0,           state.m_v);
+      Kokkos::deep_copy(vn0_0,         derived.m_vn0);
+      Kokkos::deep_copy(eta_dot_dpdn_0,derived.m_eta_dot_dpdn);
+      Kokkos::deep_copy(omega_p_0,     derived.m_omega_p);
+
+      CaarFunctorImpl caar(elems,tracers,ref_FE,hvcoord,sphop,params);
+      FunctorsBuffersManager fbm;
+      fbm.request_size( caar.requested_buffer_size() );
+      fbm.request_size(limiter.requested_buffer_size());
+      fbm.allocate();
+      caar.init_buffers(fbm);
+      limiter.init_buffers(fbm);
+      caar.init_boundary_exchanges(c.get_ptr<MpiBuffersManager>());
+
+      // Run the default path, and save the results
+      caar.set_overlap_exchange(false);
+      caar.run(data);
+
+      auto dp3d_ref         = Kokkos::create_mirror(state.m_dp3d);
+      auto vtheta_dp_ref    = Kokkos::create_mirror(state.m_vtheta_dp);
+      auto w_i_ref          = Kokkos::create_mirror(state.m_w_i);
+      auto phinh_i_ref      = Kokkos::create_mirror(state.m_phinh_i);
+      auto v_ref            = Kokkos::create_mirror(state.m_v);
+      auto vn0_ref          = Kokkos::create_mirror(derived.m_vn0);
+      auto eta_dot_dpdn_ref = Kokkos::create_mirror(derived.m_eta_dot_dpdn);
+      auto omega_p_ref      = Kokkos::create_mirror(derived.m_omega_p);
+      Kokkos::deep_copy(dp3d_ref,        state.m_dp3d);
+      Kokkos::deep_copy(vtheta_dp_ref,   state.m_vtheta_dp);
+      Kokkos::deep_copy(w_i_ref,         state.m_w_i);
+      Kokkos::deep_copy(phinh_i_ref,     state.m_phinh_i);
+      Kokkos::deep_copy(v_ref,           state.m_v);
+      Kokkos::deep_copy(vn0_ref,         derived.m_vn0);
+      Kokkos::deep_copy(eta_dot_dpdn_ref,derived.m_eta_dot_dpdn);
+      Kokkos::deep_copy(omega_p_ref,     derived.m_omega_p);
+
+      // Restore the initial state, and run the overlapped path
+      Kokkos::deep_copy(state.m_dp3d,          dp3d_0);
+      Kokkos::deep_copy(state.m_vtheta_dp,     vtheta_dp_0);
+      Kokkos::deep_copy(state.m_w_i,           w_i_0);
+      Kokkos::deep_copy(state.m_phinh_i,       phinh_i_0);
+      Kokkos::deep_copy(state.m_v,             v_0);
+      Kokkos::deep_copy(derived.m_vn0,         vn0_0);
+      Kokkos::deep_copy(derived.m_eta_dot_dpdn,eta_dot_dpdn_0);
+      Kokkos::deep_copy(derived.m_omega_p,     omega_p_0);
+
+      caar.set_overlap_exchange(true);
+      caar.run(data);
+
+      auto h_dp3d         = Kokkos::create_mirror(state.m_dp3d);
+      auto h_vtheta_dp    = Kokkos::create_mirror(state.m_vtheta_dp);
+      auto h_w_i          = Kokkos::create_mirror(state.m_w_i);
+      auto h_phinh_i      = Kokkos::create_mirror(state.m_phinh_i);
+      auto h_v            = Kokkos::create_mirror(state.m_v);
+      auto h_vn0          = Kokkos::create_mirror(derived.m_vn0);
+      auto h_eta_dot_dpdn = Kokkos::create_mirror(derived.m_eta_dot_dpdn);
+      auto h_omega_p      = Kokkos::create_mirror(derived.m_omega_p);
+      Kokkos::deep_copy(h_dp3d,        state.m_dp3d);
+      Kokkos::deep_copy(h_vtheta_dp,   state.m_vtheta_dp);
+      Kokkos::deep_copy(h_w_i,         state.m_w_i);
+      Kokkos::deep_copy(h_phinh_i,     state.m_phinh_i);
+      Kokkos::deep_copy(h_v,           state.m_v);
+      Kokkos::deep_copy(h_vn0,         derived.m_vn0);
+      Kokkos::deep_copy(h_eta_dot_dpdn,derived.m_eta_dot_dpdn);
+      Kokkos::deep_copy(h_omega_p,     derived.m_omega_p);
+
+      for (int ie=0; ie<num_elems; ++ie) {
+        auto dp3d_cxx      = viewAsReal(Homme::subview(h_dp3d,ie,np1));
+        auto vtheta_dp_cxx = viewAsReal(Homme::subview(h_vtheta_dp,ie,np1));
+        auto w_i_cxx       = viewAsReal(Homme::subview(h_w_i,ie,np1));
+        auto phinh_i_cxx   = viewAsReal(Homme::subview(h_phinh_i,ie,np1));
+        auto v_cxx         = viewAsReal(Homme::subview(h_v,ie,np1));
+        auto vn0_cxx          = viewAsReal(Homme::subview(h_vn0,ie));
+        auto eta_dot_dpdn_cxx = viewAsReal(Homme::subview(h_eta_dot_dpdn,ie));
+        auto omega_p_cxx      = viewAsReal(Homme::subview(h_omega_p,ie));
+
+        auto dp3d_exp      = viewAsReal(Homme::subview(dp3d_ref,ie,np1));
+        auto vtheta_dp_exp = viewAsReal(Homme::subview(vtheta_dp_ref,ie,np1));
+        auto w_i_exp       = viewAsReal(Homme::subview(w_i_ref,ie,np1));
+        auto phinh_i_exp   = viewAsReal(Homme::subview(phinh_i_ref,ie,np1));
+        auto v_exp         = viewAsReal(Homme::subview(v_ref,ie,np1));
+        auto vn0_exp          = viewAsReal(Homme::subview(vn0_ref,ie));
+        auto eta_dot_dpdn_exp = viewAsReal(Homme::subview(eta_dot_dpdn_ref,ie));
+        auto omega_p_exp      = viewAsReal(Homme::subview(omega_p_ref,ie));
+
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
+              REQUIRE(dp3d_cxx(igp,jgp,k)==dp3d_exp(igp,jgp,k));
+              REQUIRE(vtheta_dp_cxx(igp,jgp,k)==vtheta_dp_exp(igp,jgp,k));
+              REQUIRE(w_i_cxx(igp,jgp,k)==w_i_exp(igp,jgp,k));
+              REQUIRE(phinh_i_cxx(igp,jgp,k)==phinh_i_exp(igp,jgp,k));
+              REQUIRE(v_cxx(0,igp,jgp,k)==v_exp(0,igp,jgp,k));
+              REQUIRE(v_cxx(1,igp,jgp,k)==v_exp(1,igp,jgp,k));
+              REQUIRE(vn0_cxx(0,igp,jgp,k)==vn0_exp(0,igp,jgp,k));
+              REQUIRE(vn0_cxx(1,igp,jgp,k)==vn0_exp(1,igp,jgp,k));
+              REQUIRE(eta_dot_dpdn_cxx(igp,jgp,k)==eta_dot_dpdn_exp(igp,jgp,k));
+              REQUIRE(omega_p_cxx(igp,jgp,k)==omega_p_exp(igp,jgp,k));
+            }
+            // Last interface
+            const int k = NUM_INTERFACE_LEV-1;
+            REQUIRE(w_i_cxx(igp,jgp,k)==w_i_exp(igp,jgp,k));
+            REQUIRE(phinh_i_cxx(igp,jgp,k)==phinh_i_exp(igp,jgp,k));
+          }
+        }
+      }
+    }
+  }
+
+  SECTION ("caar_tuned_bfb") {
+    // Tuning runs the pre-exchange kernel several times on the live state, for
+    // each candidate team size. A tuned run must give the same results as an
+    // untuned one.
+    params.theta_adv_form = AdvectionForm::Conservative;
+    params.rsplit = 3;
+    params.pgrad_correction = true;
+    params.theta_hydrostatic_mode = false;
+
+    Real dt = RPDF(1.0,10.0)(engine);
+    Real eta_ave_w = RPDF(0.1,1.0)(engine);
+    Real scale1 = RPDF(1.0,2.0)(engine);
+    Real scale2 = RPDF(1.0,2.0)(engine);
+    Real scale3 = RPDF(1.0,2.0)(engine);
+    int  np1 = IPDF(0,2)(engine);
+
+    auto mpi_comm = comm.mpi_comm();
+    MPI_Bcast(&dt,1,MPI_DOUBLE,0,mpi_comm);
+    MPI_Bcast(&scale1,1,MPI_DOUBLE,0,mpi_comm);
+    MPI_Bcast(&scale2,1,MPI_DOUBLE,0,mpi_comm);
+    MPI_Bcast(&scale3,1,MPI_DOUBLE,0,mpi_comm);
+    MPI_Bcast(&eta_ave_w,1,MPI_DOUBLE,0,mpi_comm);
+    MPI_Bcast(&np1,1,MPI_INT,0,mpi_comm);
+
+    const int  n0  = (np1+1)%3;
+    const int  nm1 = (np1+2)%3;
+
+    RKStageData data (nm1, n0, np1, 0, dt, eta_ave_w, scale1, scale2, scale3);
+
+    elems.m_state.randomize(seed,max_pressure,hvcoord.ps0,hvcoord.hybrid_ai0,geo.m_phis);
+    elems.m_derived.randomize(seed,dp3d_min(elems.m_state.m_dp3d));
+
+    // The views updated by caar, and host copies of their initial and reference values.
+    // Note: use create_mirror, since create_mirror_view may alias the device view
+    auto& state = elems.m_state;
+    auto& derived = elems.m_derived;
+    auto dp3d_0      = Kokkos::create_mirror(state.m_dp3d);
+    auto vtheta_dp_0 = Kokkos::create_mirror(state.m_vtheta_dp);
+    auto w_i_0       = Kokkos::create_mirror(state.m_w_i);
+    auto phinh_i_0   = Kokkos::create_mirror(state.m_phinh_i);
+    auto v_0         = Kokkos::create_mirror(state.m_v);
+    auto vn0_0       = Kokkos::create_mirror(derived.m_vn0);
+    auto omega_p_0   = Kokkos::create_mirror(derived.m_omega_p);
+    auto dp3d_ref      = Kokkos::create_mirror(state.m_dp3d);
+    auto vtheta_dp_ref = Kokkos::create_mirror(state.m_vtheta_dp);
+    auto w_i_ref       = Kokkos::create_mirror(state.m_w_i);
+    auto phinh_i_ref   = Kokkos::create_mirror(state.m_phinh_i);
+    auto v_ref         = Kokkos::create_mirror(state.m_v);
+    auto vn0_ref       = Kokkos::create_mirror(derived.m_vn0);
+    auto omega_p_ref   = Kokkos::create_mirror(derived.m_omega_p);
+    Kokkos::deep_copy(dp3d_0,     state.m_dp3d);
+    Kokkos::deep_copy(vtheta_dp_0,state.m_vtheta_dp);
+    Kokkos::deep_copy(w_i_0,      state.m_w_i);
+    Kokkos::deep_copy(phinh_i_0,  state.m_phinh_i);
+    Kokkos::deep_copy(v_0,        state.m_v);
+    Kokkos::deep_copy(vn0_0,      derived.m_vn0);
+    Kokkos::deep_copy(omega_p_0,  derived.m_omega_p);
+
+    // The untuned functor uses the default team sizes. The tuned one is created
+    // after switching the tuner to tuning mode, so it tunes at its first run.
+    CaarFunctorImpl caar(elems,tracers,ref_FE,hvcoord,sphop,params);
+    REQUIRE (not caar.m_tune_policy);
+
+    const std::string cache_file = "caar_ut_team_policy.cache";
+    auto& tuner = c.get<TeamPolicyTuner>();
+    tuner.init(comm,cache_file,true);
+    CaarFunctorImpl caar_tuned(elems,tracers,ref_FE,hvcoord,sphop,params);
+    REQUIRE (caar_tuned.m_tune_policy);
+
+    FunctorsBuffersManager fbm;
+    fbm.request_size( caar.requested_buffer_size() );
+    fbm.request_size( caar_tuned.requested_buffer_size() );
+    fbm.request_size(limiter.requested_buffer_size());
+    fbm.allocate();
+    caar.init_buffers(fbm);
+    caar_tuned.init_buffers(fbm);
+    limiter.init_buffers(fbm);
+    caar.init_boundary_exchanges(c.get_ptr<MpiBuffersManager>());
+    caar_tuned.init_boundary_exchanges(c.get_ptr<MpiBuffersManager>());
+
+    // Untuned run
+    caar.run(data);
+    Kokkos::deep_copy(dp3d_ref,     state.m_dp3d);
+    Kokkos::deep_copy(vtheta_dp_ref,state.m_vtheta_dp);
+    Kokkos::deep_copy(w_i_ref,      state.m_w_i);
+    Kokkos::deep_copy(phinh_i_ref,  state.m_phinh_i);
+    Kokkos::deep_copy(v_ref,        state.m_v);
+    Kokkos::deep_copy(vn0_ref,      derived.m_vn0);
+    Kokkos::deep_copy(omega_p_ref,  derived.m_omega_p);
+
+    // Restore the initial state, and do the tuned run
+    Kokkos::deep_copy(state.m_dp3d,     dp3d_0);
+    Kokkos::deep_copy(state.m_vtheta_dp,vtheta_dp_0);
+    Kokkos::deep_copy(state.m_w_i,      w_i_0);
+    Kokkos::deep_copy(state.m_phinh_i,  phinh_i_0);
+    Kokkos::deep_copy(state.m_v,        v_0);
+    Kokkos::deep_copy(derived.m_vn0,    vn0_0);
+    Kokkos::deep_copy(derived.m_omega_p,omega_p_0);
+
+    caar_tuned.run(data);
+    REQUIRE (not caar_tuned.m_tune_policy);
+
+    // Do not leave the tuner in tuning mode for the other sections
+    tuner = TeamPolicyTuner();
+
+    auto h_dp3d      = Kokkos::create_mirror(state.m_dp3d);
+    auto h_vtheta_dp = Kokkos::create_mirror(state.m_vtheta_dp);
+    auto h_w_i       = Kokkos::create_mirror(state.m_w_i);
+    auto h_phinh_i   = Kokkos::create_mirror(state.m_phinh_i);
+    auto h_v         = Kokkos::create_mirror(state.m_v);
+    auto h_vn0       = Kokkos::create_mirror(derived.m_vn0);
+    auto h_omega_p   = Kokkos::create_mirror(derived.m_omega_p);
+    Kokkos::deep_copy(h_dp3d,     state.m_dp3d);
+    Kokkos::deep_copy(h_vtheta_dp,state.m_vtheta_dp);
+    Kokkos::deep_copy(h_w_i,      state.m_w_i);
+    Kokkos::deep_copy(h_phinh_i,  state.m_phinh_i);
+    Kokkos::deep_copy(h_v,        state.m_v);
+    Kokkos::deep_copy(h_vn0,      derived.m_vn0);
+    Kokkos::deep_copy(h_omega_p,  derived.m_omega_p);
+
+    // Check all time levels, since tuning must not touch nm1 and n0 either
+    for (int ie=0; ie<num_elems; ++ie) {
+      for (int tl=0; tl<NUM_TIME_LEVELS; ++tl) {
+        auto dp3d_cxx      = viewAsReal(Homme::subview(h_dp3d,ie,tl));
+        auto vtheta_dp_cxx = viewAsReal(Homme::subview(h_vtheta_dp,ie,tl));
+        auto w_i_cxx       = viewAsReal(Homme::subview(h_w_i,ie,tl));
+        auto phinh_i_cxx   = viewAsReal(Homme::subview(h_phinh_i,ie,tl));
+        auto v_cxx         = viewAsReal(Homme::subview(h_v,ie,tl));
+
+        auto dp3d_exp      = viewAsReal(Homme::subview(dp3d_ref,ie,tl));
+        auto vtheta_dp_exp = viewAsReal(Homme::subview(vtheta_dp_ref,ie,tl));
+        auto w_i_exp       = viewAsReal(Homme::subview(w_i_ref,ie,tl));
+        auto phinh_i_exp   = viewAsReal(Homme::subview(phinh_i_ref,ie,tl));
+        auto v_exp         = viewAsReal(Homme::subview(v_ref,ie,tl));
+
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
+              REQUIRE(dp3d_cxx(igp,jgp,k)==dp3d_exp(igp,jgp,k));
+              REQUIRE(vtheta_dp_cxx(igp,jgp,k)==vtheta_dp_exp(igp,jgp,k));
+              REQUIRE(w_i_cxx(igp,jgp,k)==w_i_exp(igp,jgp,k));
+              REQUIRE(phinh_i_cxx(igp,jgp,k)==phinh_i_exp(igp,jgp,k));
+              REQUIRE(v_cxx(0,igp,jgp,k)==v_exp(0,igp,jgp,k));
+              REQUIRE(v_cxx(1,igp,jgp,k)==v_exp(1,igp,jgp,k));
+            }
+            // Last interface
+            const int k = NUM_INTERFACE_LEV-1;
+            REQUIRE(w_i_cxx(igp,jgp,k)==w_i_exp(igp,jgp,k));
+            REQUIRE(phinh_i_cxx(igp,jgp,k)==phinh_i_exp(igp,jgp,k));
+          }
+        }
+      }
+
+      auto vn0_cxx     = viewAsReal(Homme::subview(h_vn0,ie));
+      auto omega_p_cxx = viewAsReal(Homme::subview(h_omega_p,ie));
+      auto vn0_exp     = viewAsReal(Homme::subview(vn0_ref,ie));
+      auto omega_p_exp = viewAsReal(Homme::subview(omega_p_ref,ie));
+      for (int igp=0; igp<NP; ++igp) {
+        for (int jgp=0; jgp<NP; ++jgp) {
+          for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
+            REQUIRE(vn0_cxx(0,igp,jgp,k)==vn0_exp(0,igp,jgp,k));
+            REQUIRE(vn0_cxx(1,igp,jgp,k)==vn0_exp(1,igp,jgp,k));
+            REQUIRE(omega_p_cxx(igp,jgp,k)==omega_p_exp(igp,jgp,k));
+          }
+        }
+      }
+    }
+  }
+
   SECTION ("limiter_dp3d") {
 
     // rsplit and hydro_mode are irrelevant for this test, so just pick something
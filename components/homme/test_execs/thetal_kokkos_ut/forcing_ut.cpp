@@ -105,7 +105,7 @@ TEST_CASE("forcing", "forcing") {
   // Create f90-layout views
   HVM<Real*[QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]>                    q_f90 ("",num_elems);
   HVM<Real*[QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]>                    fq_f90 ("",num_elems);
-  HVM<Real*[Q_NUM_TIME_LEVELS][QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]> qdp_f90("",num_elems);
+  HVM<Real***[NUM_PHYSICAL_LEV][NP][NP]>                           qdp_f90("",num_elems,Q_NUM_TIME_LEVELS,QSIZE_D);
 
   HVM<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][2][NP][NP]> v_f90("",num_elems);
   HVM<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>   w_f90("",num_elems);
@@ -47,6 +47,7 @@ void biharmonic_wk_theta_f90 (const int& np1, const Real& hv_scaling, const bool
                               Real*& phitens, Real*& vtens);
 void advance_hypervis_f90 (const int& np1, const Real& dt, const Real& eta_ave_w,
                            const Real& hv_scaling, const bool& hydrostatic,
+                           const int& hv_subcycle_tom,
                            const Real*& dp_ref_ptr, const Real*& theta_ref_ptr, const Real*& phi_ref_ptr,
                            Real*& v_state, Real*& w_state, Real*& vtheta_state,
                            Real*& dp_state, Real*& phinh_state);
@@ -75,7 +76,7 @@ public:
     m_data.np1 = np1;
     m_data.dt = dt;
     m_data.dt_hvs = (m_data.hypervis_subcycle > 0 ) ? dt/m_data.hypervis_subcycle : -1.0;
-    m_data.dt_hvs_tom = -1.0;// set to dt/m_data.hypervis_subcycle_tom;
+    m_data.dt_hvs_tom = (m_data.hypervis_subcycle_tom > 0 ) ? dt/m_data.hypervis_subcycle_tom : -1.0;
     m_data.eta_ave_w = eta_ave_w;
   }
 
@@ -143,8 +144,7 @@ TEST_CASE("hvf", "biharmonic") {
 
   // Init parameters
   auto& params = c.create<SimulationParams>();
-  //keep nu_top=0 till nu_scale_top is set here
-  params.nu_top            = 0.0; //RPDF(1e-6,1e-3)(engine);
+  params.nu_top            = RPDF(1e3,1e5)(engine);
   params.nu                = RPDF(1e-1,1e3)(engine);
   params.nu_p              = RPDF(1e-6,1e-3)(engine);
   params.nu_s              = RPDF(1e-6,1e-3)(engine);
@@ -152,7 +152,9 @@ TEST_CASE("hvf", "biharmonic") {
   params.nu_div            = RPDF(1e-6,1e-3)(engine);
   params.hypervis_scaling  = RPDF(0.1,1.0)(engine);
   params.hypervis_subcycle = IPDF(1,3)(engine);
+  //the sponge layer is only tested in the hypervis section
   params.hypervis_subcycle_tom = 0;
+  int hypervis_subcycle_tom = IPDF(1,3)(engine);
   params.params_set = true;
 
   // Sync params across ranks
@@ -164,6 +166,7 @@ TEST_CASE("hvf", "biharmonic") {
   //reset below, not bcasted
   MPI_Bcast(&params.hypervis_scaling,1,MPI_DOUBLE,0,c.get<Comm>().mpi_comm());
   MPI_Bcast(&params.hypervis_subcycle,1,MPI_INT,0,c.get<Comm>().mpi_comm());
+  MPI_Bcast(&hypervis_subcycle_tom,1,MPI_INT,0,c.get<Comm>().mpi_comm());
 
   // Create and init hvcoord and ref_elem, needed to init the fortran interface
   auto& hvcoord = c.create<HybridVCoord>();
@@ -452,197 +455,217 @@ TEST_CASE("hvf", "biharmonic") {
       std::cout << " -> " << (hydrostatic ? "hydrostatic" : "non-hydrostatic") << "\n";
 
       for (Real hv_scaling : {0.0, 1.2345}) {
-        std::cout << "   -> hypervis scaling = " << hv_scaling << "\n";
-        params.theta_hydrostatic_mode = hydrostatic;
-
-        // Generate timestep settings
-        const Real dt = RPDF(1e-5,1e-3)(engine);
-        //randomize it? also, dpdiss is not tested in here
-        const Real eta_ave_w = 1.0;
-        int  np1 = IPDF(0,2)(engine);
-        // Sync np1 across ranks. If they are not synced, we may get stuck in an mpi wait
-        MPI_Bcast(&np1,1,MPI_INT,0,c.get<Comm>().mpi_comm());
-
-        // Create the HVF tester
-        HVFTester hvf(params,geo,state,derived);
-
-        FunctorsBuffersManager fbm;
-        fbm.request_size( hvf.requested_buffer_size() );
-        fbm.allocate();
-        hvf.init_buffers(fbm);
-
-        hvf.set_timestep_data(np1,dt,eta_ave_w);
-
-        // Generate random states
-        state.randomize(seed);
-
-        // The HV functor as a whole is more delicate than biharmonic_wk.
-        // In particular, the EOS is used a couple of times. This means
-        // that inputs *must* satisfy some minimum requirements, like
-        // dp>0, vtheta>0, and d(phi)>0. This is very unlikely with random
-        // inputs coming from state.randomize(seed), so we generate data
-        // as "realistic" as possible, and perturb it.
-        // This computation mimics that of
-        // src/theta-l/share/element_ops.F90:initialize_reference_states().
-        using PDF = std::uniform_real_distribution<Real>;
-        ExecViewManaged<Scalar*[NP][NP][NUM_LEV_P]> perturb("",num_elems);
-
-        static constexpr Real T1 =
-          PhysicalConstants::Tref_lapse_rate*PhysicalConstants::Tref*PhysicalConstants::cp/PhysicalConstants::g;
-        static constexpr Real T0 = PhysicalConstants::Tref-T1;
-
-        constexpr Real noise_lvl = 0.05;
-        genRandArray(perturb,engine,PDF(-noise_lvl,noise_lvl));
-        EquationOfState eos;
-        eos.init(hydrostatic,hvcoord);
-
-        ElementOps elem_ops;
-        elem_ops.init(hvcoord);
-
-        ExecViewManaged<Scalar[NUM_LEV]> buf_m("");
-        ExecViewManaged<Scalar[NUM_LEV_P]> buf_i("");
-        Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace>(num_elems),
-                             KOKKOS_LAMBDA(const TeamMember& team){
-          KernelVariables kv(team);
-          Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
-                               [&](const int idx){
-            const int igp = idx / NP;
-            const int jgp = idx % NP;
-
-            auto noise = Homme::subview(perturb,kv.ie,igp,jgp);
-            auto dp = Homme::subview(state.m_dp3d,kv.ie,np1,igp,jgp);
-            auto theta = Homme::subview(state.m_vtheta_dp,kv.ie,np1,igp,jgp);
-            auto phi = Homme::subview(state.m_phinh_i,kv.ie,np1,igp,jgp);
-
-            // First, compute dp = dp_ref+noise
-            hvcoord.compute_dp_ref(kv,state.m_ps_v(kv.ie,np1,igp,jgp),dp);
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
-                                 [&](const int ilev){
-              dp(ilev) *= 1.0 + noise(ilev);
-            });
-            // Compute pressure
-            elem_ops.compute_hydrostatic_p(kv,dp,buf_i,buf_m);
-
-            // Compute vtheta_dp = theta_ref*dp, where
-            // theta_ref = T0/exner + T1, exner = (p/p0)^k
-            // theta_ref mimics computation in src/theta-l/share/element_ops.F90:set_theta_ref()
-            Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
-                                 [&](const int ilev){
-              theta(ilev) = pow(buf_m(ilev)/PhysicalConstants::p0,PhysicalConstants::kappa);
-              theta(ilev) = T0/theta(ilev) + T1;
-              theta(ilev) *= dp(ilev);
+        // Test the sponge layer too: nu_top>0, so it is active if hypervis_subcycle_tom>0
+        for (const int subcycle_tom : {0, hypervis_subcycle_tom}) {
+          std::cout << "     -> hypervis_subcycle_tom = " << subcycle_tom << "\n";
+          params.hypervis_subcycle_tom = subcycle_tom;
+
+          std::cout << "   -> hypervis scaling = " << hv_scaling << "\n";
+          params.theta_hydrostatic_mode = hydrostatic;
+
+          // Generate timestep settings
+          const Real dt = RPDF(1e-5,1e-3)(engine);
+          //randomize it? also, dpdiss is not tested in here
+          const Real eta_ave_w = 1.0;
+          int  np1 = IPDF(0,2)(engine);
+          // Sync np1 across ranks. If they are not synced, we may get stuck in an mpi wait
+          MPI_Bcast(&np1,1,MPI_INT,0,c.get<Comm>().mpi_comm());
+
+          // Create the HVF tester
+          HVFTester hvf(params,geo,state,derived);
+
+          FunctorsBuffersManager fbm;
+          fbm.request_size( hvf.requested_buffer_size() );
+          fbm.allocate();
+          hvf.init_buffers(fbm);
+
+          hvf.set_timestep_data(np1,dt,eta_ave_w);
+
+          // Generate random states
+          state.randomize(seed);
+
+          // The HV functor as a whole is more delicate than biharmonic_wk.
+          // In particular, the EOS is used a couple of times. This means
+          // that inputs *must* satisfy some minimum requirements, like
+          // dp>0, vtheta>0, and d(phi)>0. This is very unlikely with random
+          // inputs coming from state.randomize(seed), so we generate data
+          // as "realistic" as possible, and perturb it.
+          // This computation mimics that of
+          // src/theta-l/share/element_ops.F90:initialize_reference_states().
+          using PDF = std::uniform_real_distribution<Real>;
+          ExecViewManaged<Scalar*[NP][NP][NUM_LEV_P]> perturb("",num_elems);
+
+          static constexpr Real T1 =
+            PhysicalConstants::Tref_lapse_rate*PhysicalConstants::Tref*PhysicalConstants::cp/PhysicalConstants::g;
+          static constexpr Real T0 = PhysicalConstants::Tref-T1;
+
+          constexpr Real noise_lvl = 0.05;
+          genRandArray(perturb,engine,PDF(-noise_lvl,noise_lvl));
+          EquationOfState eos;
+          eos.init(hydrostatic,hvcoord);
+
+          ElementOps elem_ops;
+          elem_ops.init(hvcoord);
+
+          ExecViewManaged<Scalar[NUM_LEV]> buf_m("");
+          ExecViewManaged<Scalar[NUM_LEV_P]> buf_i("");
+          Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace>(num_elems),
+                               KOKKOS_LAMBDA(const TeamMember& team){
+            KernelVariables kv(team);
+            Kokkos::parallel_for(Kokkos::TeamThreadRange(kv.team,NP*NP),
+                                 [&](const int idx){
+              const int igp = idx / NP;
+              const int jgp = idx % NP;
+
+              auto noise = Homme::subview(perturb,kv.ie,igp,jgp);
+              auto dp = Homme::subview(state.m_dp3d,kv.ie,np1,igp,jgp);
+              auto theta = Homme::subview(state.m_vtheta_dp,kv.ie,np1,igp,jgp);
+              auto phi = Homme::subview(state.m_phinh_i,kv.ie,np1,igp,jgp);
+
+              // First, compute dp = dp_ref+noise
+              hvcoord.compute_dp_ref(kv,state.m_ps_v(kv.ie,np1,igp,jgp),dp);
+              Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
+                                   [&](const int ilev){
+                dp(ilev) *= 1.0 + noise(ilev);
+              });
+              // Compute pressure
+              elem_ops.compute_hydrostatic_p(kv,dp,buf_i,buf_m);
+
+              // Compute vtheta_dp = theta_ref*dp, where
+              // theta_ref = T0/exner + T1, exner = (p/p0)^k
+              // theta_ref mimics computation in src/theta-l/share/element_ops.F90:set_theta_ref()
+              Kokkos::parallel_for(Kokkos::ThreadVectorRange(kv.team,NUM_LEV),
+                                   [&](const int ilev){
+                theta(ilev) = pow(buf_m(ilev)/PhysicalConstants::p0,PhysicalConstants::kappa);
+                theta(ilev) = T0/theta(ilev) + T1;
+                theta(ilev) *= dp(ilev);
+              });
+
+              // Compute phi
+              eos.compute_phi_i(kv,geo.m_phis(kv.ie,igp,jgp),
+                                theta,buf_m,phi);
             });
-
-            // Compute phi
-            eos.compute_phi_i(kv,geo.m_phis(kv.ie,igp,jgp),
-                              theta,buf_m,phi);
           });
-        });
 
-        // The be needs to be inited after the hydrostatic option has been set
-        hvf.init_boundary_exchanges();
-
-        // Copy states into f90 pointers
-        HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][2][NP][NP]> v_f90("",num_elems);
-        HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>   w_f90("",num_elems);
-        HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][NP][NP]>    dp_f90("",num_elems);
-        HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][NP][NP]>    vtheta_f90("",num_elems);
-        HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>   phinh_f90("",num_elems);
-
-        sync_to_host(state.m_v,v_f90);
-        sync_to_host(state.m_w_i,w_f90);
-        sync_to_host(state.m_dp3d,dp_f90);
-        sync_to_host(state.m_vtheta_dp,vtheta_f90);
-        sync_to_host(state.m_phinh_i,phinh_f90);
-
-        Real* v_f90_ptr      = v_f90.data();
-        Real* w_f90_ptr      = w_f90.data();
-        Real* dp_f90_ptr     = dp_f90.data();
-        Real* vtheta_f90_ptr = vtheta_f90.data();
-        Real* phinh_f90_ptr  = phinh_f90.data();
-
-        // Update hv settings
-        params.hypervis_scaling = hv_scaling;
-        if (params.nu != params.nu_div) {
-          Real ratio = params.nu_div / params.nu;
-          if (params.hypervis_scaling != 0.0) {
-            params.nu_ratio1 = ratio;
-            params.nu_ratio2 = 1.0;
+          // The be needs to be inited after the hydrostatic option has been set
+          hvf.init_boundary_exchanges();
+
+          // Copy states into f90 pointers
+          HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][2][NP][NP]> v_f90("",num_elems);
+          HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>   w_f90("",num_elems);
+          HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][NP][NP]>    dp_f90("",num_elems);
+          HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][NP][NP]>    vtheta_f90("",num_elems);
+          HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>   phinh_f90("",num_elems);
+
+          sync_to_host(state.m_v,v_f90);
+          sync_to_host(state.m_w_i,w_f90);
+          sync_to_host(state.m_dp3d,dp_f90);
+          sync_to_host(state.m_vtheta_dp,vtheta_f90);
+          sync_to_host(state.m_phinh_i,phinh_f90);
+
+          Real* v_f90_ptr      = v_f90.data();
+          Real* w_f90_ptr      = w_f90.data();
+          Real* dp_f90_ptr     = dp_f90.data();
+          Real* vtheta_f90_ptr = vtheta_f90.data();
+          Real* phinh_f90_ptr  = phinh_f90.data();
+
+          // Update hv settings
+          params.hypervis_scaling = hv_scaling;
+          if (params.nu != params.nu_div) {
+            Real ratio = params.nu_div / params.nu;
+            if (params.hypervis_scaling != 0.0) {
+              params.nu_ratio1 = ratio;
+              params.nu_ratio2 = 1.0;
+            }else{
+              params.nu_ratio1 = ratio;
+              params.nu_ratio2 = 1.0;
+            }
           }else{
-            params.nu_ratio1 = ratio;
+            params.nu_ratio1 = 1.0;
             params.nu_ratio2 = 1.0;
           }
-        }else{
-          params.nu_ratio1 = 1.0;
-          params.nu_ratio2 = 1.0;
-        }
 
-        // Set the viscosity params
-        hvf.set_hv_data(hv_scaling,params.nu_ratio1,params.nu_ratio2);
-
-        // Run the cxx functor
-        hvf.run(np1,dt,eta_ave_w);
-
-        // Run the f90 functor
-        advance_hypervis_f90(np1+1,dt,eta_ave_w, hv_scaling, hydrostatic,
-                             dp_ref_ptr, theta_ref_ptr, phi_ref_ptr,
-                             v_f90_ptr, w_f90_ptr, vtheta_f90_ptr, dp_f90_ptr, phinh_f90_ptr);
-
-        // Compare answers
-        auto v_cxx      = Kokkos::create_mirror_view(state.m_v);
-        auto w_cxx      = Kokkos::create_mirror_view(state.m_w_i);
-        auto vtheta_cxx = Kokkos::create_mirror_view(state.m_vtheta_dp);
-        auto dp_cxx     = Kokkos::create_mirror_view(state.m_dp3d);
-        auto phinh_cxx  = Kokkos::create_mirror_view(state.m_phinh_i);
-
-        Kokkos::deep_copy(v_cxx,      state.m_v);
-        Kokkos::deep_copy(w_cxx,      state.m_w_i);
-        Kokkos::deep_copy(vtheta_cxx, state.m_vtheta_dp);
-        Kokkos::deep_copy(dp_cxx,     state.m_dp3d);
-        Kokkos::deep_copy(phinh_cxx,  state.m_phinh_i);
-
-        for (int ie=0; ie<num_elems; ++ie) {
-          for (int igp=0; igp<NP; ++igp) {
-            for (int jgp=0; jgp<NP; ++jgp) {
-              for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
-                const int ilev = k / VECTOR_SIZE;
-                const int ivec = k % VECTOR_SIZE;
-
-                if (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]!=v_f90(ie,np1,k,0,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("v_cxx: %3.40f\n",v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]);
-                  printf ("v_f90: %3.40f\n",v_f90(ie,np1,k,0,igp,jgp));
-                }
-                REQUIRE (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]==v_f90(ie,np1,k,0,igp,jgp));
+          // Set the viscosity params
+          hvf.set_hv_data(hv_scaling,params.nu_ratio1,params.nu_ratio2);
+
+          // Run the cxx functor
+          hvf.run(np1,dt,eta_ave_w);
+
+          // Run the f90 functor
+          advance_hypervis_f90(np1+1,dt,eta_ave_w, hv_scaling, hydrostatic, subcycle_tom,
+                               dp_ref_ptr, theta_ref_ptr, phi_ref_ptr,
+                               v_f90_ptr, w_f90_ptr, vtheta_f90_ptr, dp_f90_ptr, phinh_f90_ptr);
+
+          // Compare answers
+          auto v_cxx      = Kokkos::create_mirror_view(state.m_v);
+          auto w_cxx      = Kokkos::create_mirror_view(state.m_w_i);
+          auto vtheta_cxx = Kokkos::create_mirror_view(state.m_vtheta_dp);
+          auto dp_cxx     = Kokkos::create_mirror_view(state.m_dp3d);
+          auto phinh_cxx  = Kokkos::create_mirror_view(state.m_phinh_i);
+
+          Kokkos::deep_copy(v_cxx,      state.m_v);
+          Kokkos::deep_copy(w_cxx,      state.m_w_i);
+          Kokkos::deep_copy(vtheta_cxx, state.m_vtheta_dp);
+          Kokkos::deep_copy(dp_cxx,     state.m_dp3d);
+          Kokkos::deep_copy(phinh_cxx,  state.m_phinh_i);
+
+          for (int ie=0; ie<num_elems; ++ie) {
+            for (int igp=0; igp<NP; ++igp) {
+              for (int jgp=0; jgp<NP; ++jgp) {
+                for (int k=0; k<NUM_PHYSICAL_LEV; ++k) {
+                  const int ilev = k / VECTOR_SIZE;
+                  const int ivec = k % VECTOR_SIZE;
+
+                  if (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]!=v_f90(ie,np1,k,0,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("v_cxx: %3.40f\n",v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]);
+                    printf ("v_f90: %3.40f\n",v_f90(ie,np1,k,0,igp,jgp));
+                  }
+                  REQUIRE (v_cxx(ie,np1,0,igp,jgp,ilev)[ivec]==v_f90(ie,np1,k,0,igp,jgp));
 
-                if (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]!=v_f90(ie,np1,k,1,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("v_cxx: %3.40f\n",v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]);
-                  printf ("v_f90: %3.40f\n",v_f90(ie,np1,k,1,igp,jgp));
-                }
-                REQUIRE (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]==v_f90(ie,np1,k,1,igp,jgp));
+                  if (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]!=v_f90(ie,np1,k,1,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("v_cxx: %3.40f\n",v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]);
+                    printf ("v_f90: %3.40f\n",v_f90(ie,np1,k,1,igp,jgp));
+                  }
+                  REQUIRE (v_cxx(ie,np1,1,igp,jgp,ilev)[ivec]==v_f90(ie,np1,k,1,igp,jgp));
 
-                if (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]!=dp_f90(ie,np1,k,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("dp_cxx: %3.16f\n",dp_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                  printf ("dp_f90: %3.16f\n",dp_f90(ie,np1,k,igp,jgp));
-                }
-                REQUIRE (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]==dp_f90(ie,np1,k,igp,jgp));
+                  if (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]!=dp_f90(ie,np1,k,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("dp_cxx: %3.16f\n",dp_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                    printf ("dp_f90: %3.16f\n",dp_f90(ie,np1,k,igp,jgp));
+                  }
+                  REQUIRE (dp_cxx(ie,np1,igp,jgp,ilev)[ivec]==dp_f90(ie,np1,k,igp,jgp));
 
-                if (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]!=vtheta_f90(ie,np1,k,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("vtheta_cxx: %3.16f\n",vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                  printf ("vtheta_f90: %3.16f\n",vtheta_f90(ie,np1,k,igp,jgp));
+                  if (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]!=vtheta_f90(ie,np1,k,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("vtheta_cxx: %3.16f\n",vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                    printf ("vtheta_f90: %3.16f\n",vtheta_f90(ie,np1,k,igp,jgp));
+                  }
+                  REQUIRE (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]==vtheta_f90(ie,np1,k,igp,jgp));
+
+                  if (hvf.process_nh_vars()) {
+                    if (w_cxx(ie,np1,igp,jgp,ilev)[ivec]!=w_f90(ie,np1,k,igp,jgp)) {
+                      printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                      printf ("w_cxx: %3.16f\n",w_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                      printf ("w_f90: %3.16f\n",w_f90(ie,np1,k,igp,jgp));
+                    }
+                    REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_f90(ie,np1,k,igp,jgp));
+
+                    if (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]!=phinh_f90(ie,np1,k,igp,jgp)) {
+                      printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                      printf ("phinh_cxx: %3.16f\n",phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                      printf ("phinh_f90: %3.16f\n",phinh_f90(ie,np1,k,igp,jgp));
+                    }
+                    REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_f90(ie,np1,k,igp,jgp));
+                  }
                 }
-                REQUIRE (vtheta_cxx(ie,np1,igp,jgp,ilev)[ivec]==vtheta_f90(ie,np1,k,igp,jgp));
 
                 if (hvf.process_nh_vars()) {
-                  if (w_cxx(ie,np1,igp,jgp,ilev)[ivec]!=w_f90(ie,np1,k,igp,jgp)) {
-                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                    printf ("w_cxx: %3.16f\n",w_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                    printf ("w_f90: %3.16f\n",w_f90(ie,np1,k,igp,jgp));
-                  }
-                  REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_f90(ie,np1,k,igp,jgp));
+                  // Last interface
+                  const int k = NUM_INTERFACE_LEV-1;
+                  const int ilev = ColInfo<NUM_INTERFACE_LEV>::LastPack;
+                  const int ivec = ColInfo<NUM_INTERFACE_LEV>::LastPackEnd;
 
                   if (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]!=phinh_f90(ie,np1,k,igp,jgp)) {
                     printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
@@ -650,28 +673,14 @@ TEST_CASE("hvf", "biharmonic") {
                     printf ("phinh_f90: %3.16f\n",phinh_f90(ie,np1,k,igp,jgp));
                   }
                   REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_f90(ie,np1,k,igp,jgp));
-                }
-              }
-
-              if (hvf.process_nh_vars()) {
-                // Last interface
-                const int k = NUM_INTERFACE_LEV-1;
-                const int ilev = ColInfo<NUM_INTERFACE_LEV>::LastPack;
-                const int ivec = ColInfo<NUM_INTERFACE_LEV>::LastPackEnd;
 
-                if (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]!=phinh_f90(ie,np1,k,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("phinh_cxx: %3.16f\n",phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                  printf ("phinh_f90: %3.16f\n",phinh_f90(ie,np1,k,igp,jgp));
-                }
-                REQUIRE (phinh_cxx(ie,np1,igp,jgp,ilev)[ivec]==phinh_f90(ie,np1,k,igp,jgp));
-
-                if (w_cxx(ie,np1,igp,jgp,ilev)[ivec]!=w_f90(ie,np1,k,igp,jgp)) {
-                  printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
-                  printf ("w_cxx: %3.16f\n",w_cxx(ie,np1,igp,jgp,ilev)[ivec]);
-                  printf ("w_f90: %3.16f\n",w_f90(ie,np1,k,igp,jgp));
+                  if (w_cxx(ie,np1,igp,jgp,ilev)[ivec]!=w_f90(ie,np1,k,igp,jgp)) {
+                    printf ("ie,k,igp,jgp: %d, %d, %d, %d\n",ie,k,igp,jgp);
+                    printf ("w_cxx: %3.16f\n",w_cxx(ie,np1,igp,jgp,ilev)[ivec]);
+                    printf ("w_f90: %3.16f\n",w_f90(ie,np1,k,igp,jgp));
+                  }
+                  REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_f90(ie,np1,k,igp,jgp));
                 }
-                REQUIRE (w_cxx(ie,np1,igp,jgp,ilev)[ivec]==w_f90(ie,np1,k,igp,jgp));
               }
             }
           }
@@ -143,7 +143,7 @@ TEST_CASE("remap", "remap_testing") {
   using ScalarStateF90    = HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][NP][NP]>;
   using ScalarStateIntF90 = HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_INTERFACE_LEV][NP][NP]>;
   using VectorStateF90    = HostViewManaged<Real*[NUM_TIME_LEVELS][NUM_PHYSICAL_LEV][2][NP][NP]>;
-  using TracerStateF90    = HostViewManaged<Real*[Q_NUM_TIME_LEVELS][QSIZE_D][NUM_PHYSICAL_LEV][NP][NP]>;
+  using TracerStateF90    = HostViewManaged<Real***[NUM_PHYSICAL_LEV][NP][NP]>;
 
   Scalar2dF90       ps_f90("",elems.num_elems());
   ScalarStateF90    dp3d_f90("",elems.num_elems());
@@ -151,7 +151,7 @@ TEST_CASE("remap", "remap_testing") {
   ScalarStateIntF90 w_i_f90("",elems.num_elems());
   ScalarStateIntF90 phinh_i_f90("",elems.num_elems());
   VectorStateF90    v_f90("",elems.num_elems());
-  TracerStateF90    qdp_f90("",elems.num_elems());
+  TracerStateF90    qdp_f90("",elems.num_elems(),Q_NUM_TIME_LEVELS,QSIZE_D);
 
   ScalarIntF90 eta_dot_dpdn_f90("",elems.num_elems());
 
@@ -266,7 +266,10 @@ TEST_CASE("remap", "remap_testing") {
             auto w_i_cxx       = viewAsReal(Homme::subview(h_w_i,ie,np1));
             auto phinh_i_cxx   = viewAsReal(Homme::subview(h_phinh_i,ie,np1));
             auto v_cxx         = viewAsReal(Homme::subview(h_v,ie,np1));
-            auto qdp_cxx       = viewAsReal(Homme::subview(h_qdp,ie,np1_qdp));
+            // The tracer dim of qdp is sized at runtime, so viewAsReal can't be used
+            auto qdp_cxx       = [&](const int iq, const int igp, const int jgp, const int k) {
+              return h_qdp(ie,np1_qdp,iq,igp,jgp,k/VECTOR_SIZE)[k%VECTOR_SIZE];
+            };
 
             for (int igp=0; igp<NP; ++igp) {
               for (int jgp=0; jgp<NP; ++jgp) {
@@ -145,6 +145,7 @@ static int prefix_len_nt;        /* length of timer name prefix set outside para
 static char *prefix_nt;          /* timer name prefix set outside of parallel region */
 static int *prefix_len;          /* length of timer name prefix for each thread */
 static char **prefix;            /* timer name prefix for each thread */
+static int prefix_used = 0;      /* whether a prefix was ever set (handles must then be checked) */
 
 static Method method = GPTLmost_frequent;  /* default parent/child printing mechanism */
 static PRMode print_mode = GPTLprint_write;  /* default output mode */
@@ -213,6 +214,7 @@ static int ncmp (const void *, const void *);
 static int get_index ( const char *, const char *);
 
 static int add_prefix( char *, const char *, const int, const int);
+static inline int has_prefixed_name (const Timer *, const char *, const int);
 
 typedef struct {
   const Funcoption option;
@@ -512,6 +514,7 @@ int GPTLinitialize (void)
   }
 
   prefix_len_nt = 0;
+  prefix_used = 0;
   prefix_nt = (char *) GPTLallocate ((MAX_CHARS+1) * sizeof (char));
   prefix_nt[0] = '\0';
 
@@ -675,6 +678,7 @@ int GPTLprefix_set (const char *prefixname)      /* prefix string */
 #endif
 
   len_prefix = MIN (strlen (prefixname), MAX_CHARS);
+  prefix_used = 1;
 
   /*
   ** Note: if in a parallel region with only one active thread, e.g.
@@ -740,6 +744,7 @@ int GPTLprefix_setf (const char *prefixname, const int prefixlen)  /* prefix str
 #endif
 
   len_prefix = MIN (prefixlen, MAX_CHARS);
+  prefix_used = 1;
 
   /*
   ** Note: if in a parallel region with only one active thread, e.g.
@@ -1057,6 +1062,7 @@ int GPTLstart (const char *timername)                  /* timer name */
 int GPTLstart_handle (const char *name,  /* timer name */
 		      void **handle)     /* handle (output if input value is 0) */
 {
+  char new_name[MAX_CHARS+1];            /* timer name with prefix, if there is one */
   Timer *ptr;                            /* linked list pointer */
   int t;                                 /* thread index (of this thread) */
   int numchars;                          /* number of characters to copy */
@@ -1085,14 +1091,19 @@ int GPTLstart_handle (const char *name,  /* timer name */
   }
 
   /*
-  ** If prefix string is defined, then call GPTLstart and
-  ** return a handle of 0. Otherwise a change in the prefix
-  ** might be ignored if the handle has already been set.
+  ** If a prefix was ever defined, the handle may refer to the timer of another
+  ** prefix, so only keep it if its name is the current prefix followed by name.
+  ** Otherwise, look up (or create) the timer with the prefixed name, and return
+  ** it in the handle, so that later calls with the same prefix skip the lookup.
   */
 
-  if ((prefix_len[t] > 0) || (prefix_len_nt > 0)){
-    *handle = 0;
-    return GPTLstart (name);
+  if (prefix_used) {
+    if (*handle && ! has_prefixed_name ((Timer *) *handle, name, t))
+      *handle = 0;
+    if ( ! *handle && ((prefix_len[t] > 0) || (prefix_len_nt > 0))) {
+      add_prefix (new_name, name, strlen (name), t);
+      name = new_name;
+    }
   }
 
   if (wallstats.enabled && profileovhd.enabled){
@@ -1508,6 +1519,33 @@ static int add_prefix (char *new_name, const char *timername, const int namelen,
   return numchars;
 }
 
+/*
+** has_prefixed_name: check whether the name of a timer is the current prefix
+**                    (serial, then thread-specific) followed by timername
+**
+** Input arguments:
+**   ptr:       pointer to timer
+**   timername: timer name (without prefix)
+**   t:         thread id
+**
+** Return value: 1 (match) or 0 (no match)
+*/
+
+static inline int has_prefixed_name (const Timer *ptr, const char *timername, const int t)
+{
+  const char *c = ptr->name;
+
+  if (strncmp (c, prefix_nt, prefix_len_nt) != 0)
+    return 0;
+  c += prefix_len_nt;
+
+  if (strncmp (c, prefix[t], prefix_len[t]) != 0)
+    return 0;
+  c += prefix_len[t];
+
+  return strcmp (c, timername) == 0;
+}
+
 /*
 ** update_ll_hash: Update linked list and hash table.
 **                 Called by GPTLstart(f), GPTLstart_instr, 
@@ -1865,6 +1903,7 @@ int GPTLstop_handle (const char *name,     /* timer name */
 		     void **handle)        /* handle (output if input value is 0) */
 {
   double tp1 = 0.0;          /* time stamp */
+  char new_name[MAX_CHARS+1]; /* timer name with prefix, if there is one */
   Timer *ptr;                /* linked list pointer */
   int t;                     /* thread number for this process */
   unsigned int indx;         /* index into hash table */
@@ -1884,14 +1923,18 @@ int GPTLstop_handle (const char *name,     /* timer name */
     return GPTLerror ("%s: bad return from get_thread_num\n", thisfunc);
 
   /*
-  ** If prefix string is defined, then call GPTLstop and
-  ** return a handle of 0. Otherwise a change in the prefix
-  ** might be ignored if the handle has already been set.
+  ** If a prefix was ever defined, the handle may refer to the timer of another
+  ** prefix, so only keep it if its name is the current prefix followed by name
+  ** (see GPTLstart_handle).
   */
 
-  if ((prefix_len[t] > 0) || (prefix_len_nt > 0)){
-    *handle = 0;
-    return GPTLstop (name);
+  if (prefix_used) {
+    if (*handle && ! has_prefixed_name ((Timer *) *handle, name, t))
+      *handle = 0;
+    if ( ! *handle && ((prefix_len[t] > 0) || (prefix_len_nt > 0))) {
+      add_prefix (new_name, name, strlen (name), t);
+      name = new_name;
+    }
   }
 
   /* Get the timestamp */